@@ -0,0 +1,1599 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Microbenchmark suite of ErrorRateModel2..9::GetChunkSuccessRate.
+//
+// Place this file in the ns-3 "scratch/" directory and run e.g.
+//   ./waf --run "error-rate-model-bench --calls=200000 --format=json"
+//
+// Every model is timed on every OFDM row (BPSK 1/2 .. 64-QAM 3/4) in both
+// PER regimes, and on the four DSSS rates, for several chunk sizes and
+// through these paths:
+//   scalar  GetChunkSuccessRate, one call per chunk
+//   batch   GetChunkSuccessRateBatch with the libm kernels
+//   vector  GetChunkSuccessRateBatch with the polynomial kernels
+//   lut     GetChunkSuccessRateBatch with the lookup tables
+//   log     GetChunkLogSuccessRateBatch (compared with the golden file
+//           through exp ())
+// One CSV row (or JSON record) is written to stdout per measurement with
+// ns/call, calls/s and cycles/call.  Cycles are read from the time stamp
+// counter on x86-64; elsewhere they are derived from --ghz, and left empty
+// if it is not given.  The accuracy of each polynomial kernel the CPU
+// supports is reported on stderr.
+//
+// Golden regression:
+//   --write-golden=FILE  evaluate every model over a fixed sweep (SNR dB
+//                        grid x typical MPDU sizes x every OFDM and DSSS
+//                        mode) and store the success rates in FILE, with
+//                        NaN for those that are not finite
+//   --golden=FILE        evaluate the sweep of FILE through each timed path
+//                        and add its largest absolute and relative
+//                        deviation from FILE to every measurement, leaving
+//                        out the NaN entries and counting a value that is
+//                        not finite against a finite one as an infinite
+//                        deviation; --max-deviation=X makes the program
+//                        exit with status 2 if any absolute deviation
+//                        exceeds X.  test/baseline.golden holds the models
+//                        before they were optimised (see
+//                        write-baseline-golden.sh)
+//
+// Thread scaling:
+//   --threads=N          instead of the above, evaluate chunks of mixed
+//                        sizes through the scalar and lookup table paths
+//                        of the selected models from 1, 2, 4 .. N threads
+//                        at once, one model per thread, and report the
+//                        aggregate calls/s and the speedup over 1 thread
+//
+// Frame evaluation:
+//   --frames             instead of the above, time the success rate of
+//                        frames of 1, 10 and 100 chunks, chunk by chunk
+//                        through ErrorRateModel::GetChunkSuccessRate as
+//                        InterferenceHelper does, and in one call through
+//                        GetFrameSuccessRate (with both kernels) and
+//                        GetFrameLogSuccessRate
+//
+// Specialised curves:
+//   --static             instead of the above, time the uncached success
+//                        rate of chunks of mixed rows and sizes through the
+//                        generic curve computation, which reads the bank at
+//                        run time, through TanhPerStaticCurves<N>, which is
+//                        compiled against it, and, for reference, through
+//                        the cached GetChunkSuccessRate
+//
+// Coefficient files:
+//   --load               instead of the above, write the bank of each
+//                        selected model to a CSV file and time parsing it,
+//                        mapping its binary cache, and constructing a model
+//                        on a built-in bank, as a short simulation does
+//
+// Analytic FEC bound:
+//   --fec                instead of the above, time the union bound on the
+//                        decoded bit error rate (CalculatePe) per code
+//                        rate, with one std::pow per term as before and
+//                        in Horner form, one call at a time and in
+//                        batches, and the chunk success rate of the
+//                        analytic FEC model built on each (one call at a
+//                        time, and GetFecChunkSuccessRateBatch) over the
+//                        OFDM modes; report the ns per call and the
+//                        largest deviation from the per-term form on
+//                        stderr (relative for the bound, absolute for the
+//                        success rate), and, with --max-deviation=X, exit
+//                        with status 2 if a deviation exceeds X
+//
+// Table files (see tanh-per-table-bench.sh):
+//   --write-tables=FILE  write the lookup tables of the first selected
+//                        model for --table-sizes (bytes, comma separated)
+//                        to FILE and exit
+//   --cold-start         instead of the above, set up the first selected
+//                        model with lookup tables, attached from
+//                        --table-file=FILE if given and built privately
+//                        otherwise, and evaluate every OFDM row at every
+//                        --table-sizes size; then wait --hold seconds and
+//                        report the setup time and the RSS, PSS and
+//                        private memory of the process on stdout
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/error-rate-model2.h"
+#include "ns3/error-rate-model3.h"
+#include "ns3/error-rate-model4.h"
+#include "ns3/error-rate-model5.h"
+#include "ns3/error-rate-model6.h"
+#include "ns3/error-rate-model7.h"
+#include "ns3/error-rate-model8.h"
+#include "ns3/error-rate-model9.h"
+#include "ns3/object-factory.h"
+#include "ns3/boolean.h"
+#include "ns3/fnv-hash.h"
+#include "ns3/ofdm-fec-bound.h"
+#include "ns3/tanh-per-coefficient-file.h"
+#include "ns3/tanh-per-curve-cache.h"
+#include "ns3/tanh-per-simd.h"
+#include "ns3/tanh-per-table-file.h"
+#include "ns3/tanh-per-static-curves.h"
+
+#if defined (__x86_64__) && (defined (__GNUC__) || defined (__clang__))
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+using namespace ns3;
+
+/// Number of distinct SNRs each measurement cycles through
+static const uint32_t SWEEP_POINTS = 1000;
+/// Width (dB) of the SNR sweep on each side of the regime switch
+static const double SWEEP_WIDTH_DB = 3.0;
+
+/**
+ * The ways GetChunkSuccessRate can be reached.
+ */
+enum BenchPath
+{
+  PATH_SCALAR, //!< GetChunkSuccessRate
+  PATH_BATCH,  //!< GetChunkSuccessRateBatch, libm kernels
+  PATH_VECTOR, //!< GetChunkSuccessRateBatch, polynomial kernels
+  PATH_LUT,    //!< GetChunkSuccessRateBatch, polynomial kernels and lookup tables
+  PATH_LOG     //!< GetChunkLogSuccessRateBatch, libm kernels
+};
+
+/**
+ * One timed configuration.
+ */
+struct BenchCase
+{
+  uint32_t model;          //!< N of ErrorRateModelN
+  BenchPath path;          //!< the entry point timed
+  std::string mode;        //!< name of the WifiMode
+  int row;                 //!< OFDM coefficient row, or -1 for DSSS
+  std::string regime;      //!< "low", "high" or "dsss"
+  uint32_t nbits;          //!< chunk size
+  uint32_t calls;          //!< number of chunks evaluated
+  double ns;               //!< average ns per chunk
+  double cycles;           //!< average cycles per chunk, negative if unknown
+};
+
+/**
+ * Largest deviation of one (model, path) from the golden file.
+ */
+struct Deviation
+{
+  double maxAbs; //!< largest |new - golden|
+  double maxRel; //!< largest |new - golden| / |golden| over nonzero golden values
+};
+
+static const char *
+GetPathName (BenchPath path)
+{
+  switch (path)
+    {
+    case PATH_SCALAR:
+      return "scalar";
+    case PATH_BATCH:
+      return "batch";
+    case PATH_VECTOR:
+      return "vector";
+    case PATH_LOG:
+      return "log";
+    default:
+      return "lut";
+    }
+}
+
+static uint64_t
+ReadCycles (void)
+{
+#ifdef BENCH_HAVE_TSC
+  return __rdtsc ();
+#else
+  return 0;
+#endif
+}
+
+/// Written with the result of every timed loop
+static volatile double g_sink;
+
+/**
+ * Store a result of a timed loop where the compiler cannot drop it.
+ *
+ * \param value the result
+ */
+static void
+KeepResult (double value)
+{
+  g_sink = value;
+}
+
+/**
+ * \param fromDb first SNR of the sweep (dB)
+ * \param toDb last SNR of the sweep (dB)
+ *
+ * \return SWEEP_POINTS SNRs (ratio) evenly spaced in dB
+ */
+static std::vector<double>
+GetSnrSweep (double fromDb, double toDb)
+{
+  std::vector<double> snrs (SWEEP_POINTS);
+  for (uint32_t i = 0; i < SWEEP_POINTS; i++)
+    {
+      double db = fromDb + (toDb - fromDb) * i / (SWEEP_POINTS - 1);
+      snrs[i] = std::pow (10.0, db / 10);
+    }
+  return snrs;
+}
+
+/**
+ * Time one configuration and fill in c.ns and c.cycles.
+ *
+ * \param model the model to time
+ * \param mode the WifiMode of every chunk
+ * \param snrs the SNRs cycled through
+ * \param c the configuration; c.calls chunks are evaluated
+ * \param ghz clock used to derive cycles when there is no TSC, or 0
+ */
+static void
+TimeCase (Ptr<TanhPerErrorRateModel> model, WifiMode mode,
+          const std::vector<double> &snrs, BenchCase &c, double ghz)
+{
+  WifiTxVector txVector;
+  std::vector<uint32_t> nbits (snrs.size (), c.nbits);
+  std::vector<double> successRates (snrs.size ());
+  uint32_t rounds = std::max<uint32_t> (c.calls / snrs.size (), 1);
+  c.calls = rounds * snrs.size ();
+  model->SetVectorKernel (c.path == PATH_VECTOR || c.path == PATH_LUT);
+
+  // warm the mode table and the curve cache outside of the timed region
+  model->GetChunkSuccessRateBatch (mode, txVector, &snrs[0], &nbits[0],
+                                   &successRates[0], snrs.size ());
+
+  double sum = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  uint64_t startCycles = ReadCycles ();
+  for (uint32_t r = 0; r < rounds; r++)
+    {
+      if (c.path == PATH_SCALAR)
+        {
+          for (uint32_t i = 0; i < snrs.size (); i++)
+            {
+              sum += model->GetChunkSuccessRate (mode, txVector, snrs[i], c.nbits);
+            }
+        }
+      else if (c.path == PATH_LOG)
+        {
+          model->GetChunkLogSuccessRateBatch (mode, txVector, &snrs[0], &nbits[0],
+                                              &successRates[0], snrs.size ());
+          sum -= successRates[r % successRates.size ()];
+        }
+      else
+        {
+          model->GetChunkSuccessRateBatch (mode, txVector, &snrs[0], &nbits[0],
+                                           &successRates[0], snrs.size ());
+          sum += successRates[r % successRates.size ()];
+        }
+    }
+  uint64_t endCycles = ReadCycles ();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+  KeepResult (sum);
+  c.ns = std::chrono::duration<double, std::nano> (end - start).count () / c.calls;
+#ifdef BENCH_HAVE_TSC
+  c.cycles = static_cast<double> (endCycles - startCycles) / c.calls;
+  NS_UNUSED (ghz);
+#else
+  c.cycles = (ghz > 0) ? c.ns * ghz : -1;
+  NS_UNUSED (startCycles);
+  NS_UNUSED (endCycles);
+#endif
+}
+
+/**
+ * Evaluate chunks of mixed sizes and modes through one model, as one
+ * thread of a parallel simulation would.
+ *
+ * \param model the model, used by this thread only
+ * \param modes the modes cycled through
+ * \param calls the number of chunks to evaluate
+ * \param seed the seed of the chunk sequence
+ * \param sum set to the sum of the success rates
+ */
+static void
+RunThread (Ptr<const TanhPerErrorRateModel> model, const std::vector<WifiMode> *modes,
+           uint32_t calls, uint32_t seed, double *sum)
+{
+  WifiTxVector txVector;
+  const uint32_t block = 256;
+  std::vector<double> snr (block);
+  std::vector<uint32_t> nbits (block);
+  std::vector<double> successRates (block);
+  uint32_t state = seed;
+  double total = 0;
+  for (uint32_t i = 0; i < calls; i += block)
+    {
+      state = state * 1103515245 + 12345;
+      WifiMode mode = (*modes)[(state >> 16) % modes->size ()];
+      for (uint32_t j = 0; j < block; j++)
+        {
+          state = state * 1103515245 + 12345;
+          snr[j] = std::pow (10.0, ((state >> 8) % 3000) / 1000.0);
+          nbits[j] = 8 * (50 + ((state >> 12) % 64) * 46);
+        }
+      model->GetChunkSuccessRateBatch (mode, txVector, &snr[0], &nbits[0], &successRates[0], block);
+      total += successRates[i % block];
+    }
+  *sum = total;
+}
+
+/**
+ * Time RunThread from 1, 2, 4 .. maxThreads threads at once and report
+ * the aggregate throughput on stderr.
+ *
+ * \param n N of ErrorRateModelN
+ * \param lookupTable whether the models answer from the lookup tables
+ * \param calls the number of chunks evaluated by each thread
+ * \param maxThreads the largest number of threads
+ */
+static void
+TimeThreads (uint32_t n, bool lookupTable, uint32_t calls, uint32_t maxThreads)
+{
+  std::vector<WifiMode> modes;
+  modes.push_back (WifiPhy::GetOfdmRate6Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate12Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate24Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate54Mbps ());
+  double single = 0;
+  for (uint32_t threads = 1; ; threads = std::min (2 * threads, maxThreads))
+    {
+      // one model per thread, configured before the threads start
+      std::vector<Ptr<TanhPerErrorRateModel> > models;
+      for (uint32_t t = 0; t < threads; t++)
+        {
+          Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+          model->SetCoefficientSet (n);
+          model->SetLookupTable (lookupTable);
+          models.push_back (model);
+        }
+      // warm the shared stores outside of the timed region
+      double warm;
+      RunThread (models[0], &modes, calls, 0, &warm);
+
+      std::vector<double> sums (threads);
+      std::vector<std::thread> workers;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      for (uint32_t t = 0; t < threads; t++)
+        {
+          workers.push_back (std::thread (RunThread, models[t], &modes, calls, t, &sums[t]));
+        }
+      for (uint32_t t = 0; t < threads; t++)
+        {
+          workers[t].join ();
+        }
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+      double callsPerSecond = double (threads) * calls / std::chrono::duration<double> (end - start).count ();
+      if (threads == 1)
+        {
+          single = callsPerSecond;
+        }
+      std::cerr << "ErrorRateModel" << n << " " << (lookupTable ? "lut" : "batch") << " "
+                << threads << " threads: " << callsPerSecond << " calls/s, speedup "
+                << callsPerSecond / single << std::endl;
+      if (threads == maxThreads)
+        {
+          break;
+        }
+    }
+}
+
+/**
+ * Time the success rate of frames of the given number of chunks through
+ * the chunk-by-chunk and the frame entry points, and report the ns per
+ * frame of each on stderr.
+ *
+ * \param n N of ErrorRateModelN
+ * \param chunks the number of chunks per frame
+ * \param calls the number of chunks evaluated per measurement
+ */
+static void
+TimeFrames (uint32_t n, uint32_t chunks, uint32_t calls)
+{
+  Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+  model->SetCoefficientSet (n);
+  Ptr<ErrorRateModel> base = model;
+  WifiMode mode = WifiPhy::GetOfdmRate24Mbps ();
+  WifiTxVector txVector;
+
+  // a pool of frames whose chunks have SINRs around the steep part of
+  // the curve and the sizes interference leaves between 16 and 1500 bytes
+  const uint32_t frames = 64;
+  std::vector<double> snr (frames * chunks);
+  std::vector<uint32_t> nbits (frames * chunks);
+  uint32_t state = 1;
+  for (uint32_t i = 0; i < snr.size (); i++)
+    {
+      state = state * 1103515245 + 12345;
+      snr[i] = std::pow (10.0, 0.8 + ((state >> 8) % 1000) / 1000.0);
+      nbits[i] = 8 * (16 + (state >> 16) % 1485);
+    }
+  uint32_t rounds = std::max<uint32_t> (calls / (frames * chunks), 1);
+
+  const char *names[] = { "chunks", "frame", "frame-vector", "frame-log" };
+  double ns[4];
+  for (uint32_t path = 0; path < 4; path++)
+    {
+      model->SetVectorKernel (path == 2);
+      double sum = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      for (uint32_t r = 0; r < rounds; r++)
+        {
+          for (uint32_t f = 0; f < frames; f++)
+            {
+              const double *frameSnr = &snr[f * chunks];
+              const uint32_t *frameNbits = &nbits[f * chunks];
+              if (path == 0)
+                {
+                  double psr = 1;
+                  for (uint32_t i = 0; i < chunks; i++)
+                    {
+                      psr *= base->GetChunkSuccessRate (mode, txVector, frameSnr[i], frameNbits[i]);
+                    }
+                  sum += psr;
+                }
+              else if (path == 3)
+                {
+                  sum += model->GetFrameLogSuccessRate (mode, txVector, frameSnr, frameNbits, chunks);
+                }
+              else
+                {
+                  sum += model->GetFrameSuccessRate (mode, txVector, frameSnr, frameNbits, chunks);
+                }
+            }
+        }
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+      KeepResult (sum);
+      ns[path] = std::chrono::duration<double, std::nano> (end - start).count () / (rounds * frames);
+    }
+  for (uint32_t path = 0; path < 4; path++)
+    {
+      std::cerr << "ErrorRateModel" << n << " " << chunks << " chunks " << names[path] << ": "
+                << ns[path] << " ns/frame, speedup " << ns[0] / ns[path] << std::endl;
+    }
+}
+
+/**
+ * Time the success rate of chunks of mixed rows, sizes and SNRs with the
+ * curve computed on every call from the runtime bank and from the bank
+ * compiled into TanhPerStaticCurves<N>, and with the cached curves, and
+ * report the ns per call of each on stderr.
+ *
+ * \tparam N N of ErrorRateModelN
+ * \param calls the number of chunks evaluated per measurement
+ */
+template <uint32_t N>
+static void
+TimeStaticCurves (uint32_t calls)
+{
+  const TanhPerCoefficientSet &bank = *GetTanhPerCoefficientSet (N);
+  Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+  model->SetCoefficientSet (N);
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps ()
+  };
+  WifiTxVector txVector;
+
+  const uint32_t points = 4096;
+  std::vector<uint8_t> rows (points);
+  std::vector<double> snrDb (points);
+  std::vector<double> snr (points);
+  std::vector<uint32_t> nbits (points);
+  uint32_t state = 1;
+  for (uint32_t i = 0; i < points; i++)
+    {
+      state = state * 1103515245 + 12345;
+      rows[i] = (state >> 8) % 8;
+      snrDb[i] = -5 + ((state >> 12) % 3000) / 100.0;
+      snr[i] = std::pow (10.0, snrDb[i] / 10);
+      nbits[i] = 8 * (16 + (state >> 16) % 1485);
+    }
+
+  const char *names[] = { "generic", "static", "cached" };
+  double ns[3];
+  for (uint32_t path = 0; path < 3; path++)
+    {
+      double sum = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      for (uint32_t call = 0; call < calls; call++)
+        {
+          uint32_t i = call % points;
+          if (path == 0)
+            {
+              TanhPerCurve curve;
+              TanhPerCurveCache::ComputeParameters (bank.low[rows[i]], nbits[i], curve.aLow, curve.bLow);
+              TanhPerCurveCache::ComputeParameters (bank.high[rows[i]], nbits[i], curve.aHigh, curve.bHigh);
+              TanhPerCurveCache::SetRegimeSwitch (curve);
+              bool high = curve.IsHighRegime (snrDb[i]);
+              double a = high ? curve.aHigh : curve.aLow;
+              double b = high ? curve.bHigh : curve.bLow;
+              sum += 1 - (1 - std::tanh (a - b * snrDb[i])) / 2;
+            }
+          else if (path == 1)
+            {
+              sum += TanhPerStaticCurves<N>::GetSuccessRate (rows[i], snrDb[i], nbits[i]);
+            }
+          else
+            {
+              sum += model->GetChunkSuccessRate (modes[rows[i]], txVector, snr[i], nbits[i]);
+            }
+        }
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+      KeepResult (sum);
+      ns[path] = std::chrono::duration<double, std::nano> (end - start).count () / calls;
+    }
+  for (uint32_t path = 0; path < 3; path++)
+    {
+      std::cerr << "ErrorRateModel" << N << " " << names[path] << ": "
+                << ns[path] << " ns/call, speedup " << ns[0] / ns[path] << std::endl;
+    }
+}
+
+/**
+ * \param value a result
+ * \param reference the result it should match
+ *
+ * \return |value - reference| / |reference|, or |value| if reference is 0
+ */
+static double
+GetRelativeDeviation (double value, double reference)
+{
+  double deviation = std::fabs (value - reference);
+  return reference != 0 ? deviation / std::fabs (reference) : deviation;
+}
+
+/**
+ * Time the union bound of every code rate, and the chunk success rate of
+ * the analytic FEC model of every OFDM mode, with the per-term std::pow
+ * form and the Horner form, and report the ns per call of each and the
+ * largest deviation on stderr.
+ *
+ * \param calls the number of calls timed per measurement
+ *
+ * \return the largest relative deviation of the bound or absolute
+ *         deviation of the success rate
+ */
+static double
+TimeFecBound (uint32_t calls)
+{
+  // uncoded bit error rates of BPSK from -10 to 15 dB: the whole bound,
+  // from where it exceeds 1 to where it underflows
+  const uint32_t points = 4096;
+  std::vector<double> p (points);
+  std::vector<double> pe (points);
+  for (uint32_t i = 0; i < points; i++)
+    {
+      p[i] = OfdmFecBound::GetBer (2, std::pow (10.0, (-10 + 25.0 * i / points) / 10));
+    }
+  uint32_t rounds = std::max<uint32_t> (calls / points, 1);
+  double worst = 0;
+
+  const uint32_t bValues[] = { 1, 2, 3, 5 };
+  const char *names[] = { "pow", "horner", "horner-batch" };
+  for (uint32_t r = 0; r < sizeof (bValues) / sizeof (bValues[0]); r++)
+    {
+      double ns[3];
+      double deviation = 0;
+      for (uint32_t path = 0; path < 3; path++)
+        {
+          double sum = 0;
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+          for (uint32_t round = 0; round < rounds; round++)
+            {
+              if (path == 2)
+                {
+                  OfdmFecBound::CalculatePeBatch (&p[0], bValues[r], &pe[0], points);
+                  sum += pe[round % points];
+                  continue;
+                }
+              for (uint32_t i = 0; i < points; i++)
+                {
+                  sum += (path == 0) ? OfdmFecBound::CalculatePeReference (p[i], bValues[r])
+                                     : OfdmFecBound::CalculatePe (p[i], bValues[r]);
+                }
+            }
+          std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+          KeepResult (sum);
+          ns[path] = std::chrono::duration<double, std::nano> (end - start).count () / (rounds * points);
+        }
+      OfdmFecBound::CalculatePeBatch (&p[0], bValues[r], &pe[0], points);
+      for (uint32_t i = 0; i < points; i++)
+        {
+          double reference = OfdmFecBound::CalculatePeReference (p[i], bValues[r]);
+          deviation = std::max (deviation, GetRelativeDeviation (OfdmFecBound::CalculatePe (p[i], bValues[r]), reference));
+          deviation = std::max (deviation, GetRelativeDeviation (pe[i], reference));
+        }
+      for (uint32_t path = 0; path < 3; path++)
+        {
+          std::cerr << "CalculatePe b=" << bValues[r] << " " << names[path] << ": " << ns[path]
+                    << " ns/call, speedup " << ns[0] / ns[path] << std::endl;
+        }
+      std::cerr << "CalculatePe b=" << bValues[r] << " largest relative deviation " << deviation << std::endl;
+      worst = std::max (worst, deviation);
+    }
+
+  // the chunk success rate of the model, over the OFDM rows and SNRs
+  // around their waterfalls
+  Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps ()
+  };
+  WifiTxVector txVector;
+  std::vector<double> snr (points);
+  std::vector<uint32_t> nbits (points);
+  std::vector<double> successRate (points);
+  uint32_t state = 1;
+  for (uint32_t i = 0; i < points; i++)
+    {
+      state = state * 1103515245 + 12345;
+      snr[i] = std::pow (10.0, (((state >> 8) % 3000) / 100.0) / 10);
+      nbits[i] = 8 * (16 + (state >> 16) % 1485);
+    }
+  const char *chunkNames[] = { "chunk-pow", "chunk", "chunk-batch" };
+  double ns[3];
+  double deviation = 0;
+  for (uint32_t path = 0; path < 3; path++)
+    {
+      double sum = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      for (uint32_t round = 0; round < rounds; round++)
+        {
+          WifiMode mode = modes[round % 8];
+          uint16_t constellation;
+          uint32_t bValue;
+          OfdmFecBound::GetParameters (mode, constellation, bValue);
+          if (path == 2)
+            {
+              model->GetFecChunkSuccessRateBatch (mode, txVector, &snr[0], &nbits[0], &successRate[0], points);
+              sum += successRate[round % points];
+              continue;
+            }
+          for (uint32_t i = 0; i < points; i++)
+            {
+              if (path == 1)
+                {
+                  sum += model->GetFecChunkSuccessRate (mode, txVector, snr[i], nbits[i]);
+                  continue;
+                }
+              // GetFec*Ber as the models had it
+              double ber = OfdmFecBound::GetBer (constellation, snr[i]);
+              if (ber == 0.0)
+                {
+                  sum += 1.0;
+                  continue;
+                }
+              double pe = std::min (OfdmFecBound::CalculatePeReference (ber, bValue), 1.0);
+              sum += std::pow (1 - pe, static_cast<double> (nbits[i]));
+            }
+        }
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+      KeepResult (sum);
+      ns[path] = std::chrono::duration<double, std::nano> (end - start).count () / (rounds * points);
+    }
+  for (uint32_t m = 0; m < 8; m++)
+    {
+      uint16_t constellation;
+      uint32_t bValue;
+      OfdmFecBound::GetParameters (modes[m], constellation, bValue);
+      model->GetFecChunkSuccessRateBatch (modes[m], txVector, &snr[0], &nbits[0], &successRate[0], points);
+      for (uint32_t i = 0; i < points; i++)
+        {
+          double ber = OfdmFecBound::GetBer (constellation, snr[i]);
+          double pe = std::min (OfdmFecBound::CalculatePeReference (ber, bValue), 1.0);
+          double reference = (ber == 0.0) ? 1.0 : std::pow (1 - pe, static_cast<double> (nbits[i]));
+          // (1 - Pe)^nbits multiplies the relative error of Pe by up to
+          // nbits Pe, but keeps the absolute error below it
+          deviation = std::max (deviation, std::fabs (successRate[i] - reference));
+        }
+    }
+  for (uint32_t path = 0; path < 3; path++)
+    {
+      std::cerr << "GetFecChunkSuccessRate " << chunkNames[path] << ": " << ns[path]
+                << " ns/call, speedup " << ns[0] / ns[path] << std::endl;
+    }
+  std::cerr << "GetFecChunkSuccessRate largest absolute deviation " << deviation << std::endl;
+  return std::max (worst, deviation);
+}
+
+/**
+ * Time the ways a model gets its coefficient set at construction, and
+ * report the us per load of each on stderr.
+ *
+ * \param n N of ErrorRateModelN, whose bank is written to the file
+ * \param calls the number of loads timed per way
+ *
+ * \return false if the file or its cache could not be written
+ */
+static bool
+TimeCoefficientLoad (uint32_t n, uint32_t calls)
+{
+  const char *tmp = getenv ("TMPDIR");
+  std::ostringstream fileName;
+  fileName << (tmp != 0 ? tmp : "/tmp") << "/error-rate-model-bench-" << getpid () << ".csv";
+  std::string cacheName = TanhPerCoefficientFile::GetCacheFileName (fileName.str ());
+  if (!TanhPerCoefficientFile::WriteCsv (fileName.str (), *GetTanhPerCoefficientSet (n))
+      || !TanhPerCoefficientFile::WriteCache (fileName.str (), *GetTanhPerCoefficientSet (n)))
+    {
+      std::cerr << "could not write " << fileName.str () << std::endl;
+      return false;
+    }
+
+  const char *names[] = { "parse", "map", "built-in model" };
+  double us[3];
+  for (uint32_t way = 0; way < 3; way++)
+    {
+      uint64_t sum = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      for (uint32_t call = 0; call < calls; call++)
+        {
+          if (way == 0)
+            {
+              TanhPerCoefficientSet coefficients;
+              std::string error;
+              sum += TanhPerCoefficientFile::Parse (fileName.str (), coefficients, error);
+            }
+          else if (way == 1)
+            {
+              const TanhPerCoefficientSet *coefficients = TanhPerCoefficientFile::Map (fileName.str ());
+              sum += (coefficients != 0);
+              TanhPerCoefficientFile::Unmap (coefficients);
+            }
+          else
+            {
+              Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+              model->SetCoefficientSet (n);
+              sum += model->GetCoefficientSet ();
+            }
+        }
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+      KeepResult (sum);
+      us[way] = std::chrono::duration<double, std::micro> (end - start).count () / calls;
+    }
+  for (uint32_t way = 0; way < 3; way++)
+    {
+      std::cerr << "ErrorRateModel" << n << " " << names[way] << ": " << us[way] << " us/load" << std::endl;
+    }
+  unlink (fileName.str ().c_str ());
+  unlink (cacheName.c_str ());
+  return true;
+}
+
+/**
+ * \param text chunk sizes in bytes, comma separated
+ *
+ * \return the sizes in bits
+ */
+static std::vector<uint32_t>
+GetTableSizes (const std::string &text)
+{
+  std::vector<uint32_t> sizes;
+  std::istringstream is (text);
+  std::string size;
+  while (std::getline (is, size, ','))
+    {
+      sizes.push_back (8 * std::atoi (size.c_str ()));
+    }
+  return sizes;
+}
+
+/**
+ * \param field the name of a field of /proc/self/smaps_rollup or
+ *        /proc/self/status, with its colon
+ *
+ * \return its value (kB), or 0 if it cannot be read
+ */
+static uint64_t
+ReadProcKb (const std::string &field)
+{
+  const char *files[] = { "/proc/self/smaps_rollup", "/proc/self/status" };
+  for (uint32_t f = 0; f < 2; f++)
+    {
+      std::ifstream is (files[f]);
+      std::string line;
+      while (std::getline (is, line))
+        {
+          if (line.compare (0, field.size (), field) == 0)
+            {
+              return std::strtoull (line.c_str () + field.size (), 0, 10);
+            }
+        }
+    }
+  return 0;
+}
+
+/**
+ * Set up a model with lookup tables as a simulation process would, use
+ * them for every OFDM row and the given sizes, and report the setup time
+ * and the memory of the process on stdout.
+ *
+ * \param n N of ErrorRateModelN
+ * \param tableFile the table file to attach, or "" to build the tables
+ * \param sizes the chunk sizes (bits)
+ * \param hold the time (s) to wait before reading the memory, so that
+ *        processes started together all have their tables in use
+ */
+static void
+RunColdStart (uint32_t n, const std::string &tableFile, const std::vector<uint32_t> &sizes, double hold)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+  model->SetCoefficientSet (n);
+  if (tableFile != "")
+    {
+      model->SetTableFile (tableFile);
+    }
+  else
+    {
+      model->SetLookupTable (true);
+    }
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps ()
+  };
+  WifiTxVector txVector;
+  double sum = 0;
+  for (uint32_t row = 0; row < 8; row++)
+    {
+      for (uint32_t s = 0; s < sizes.size (); s++)
+        {
+          for (double db = -5; db <= 35; db += 0.05)
+            {
+              sum += model->GetChunkSuccessRate (modes[row], txVector, std::pow (10.0, db / 10), sizes[s]);
+            }
+        }
+    }
+  double setupMs = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now () - start).count ();
+  std::this_thread::sleep_for (std::chrono::duration<double> (hold));
+  std::cout << "tables=" << (tableFile != "" ? "shared" : "private")
+            << " setup_ms=" << setupMs
+            << " rss_kb=" << ReadProcKb ("Rss:")
+            << " pss_kb=" << ReadProcKb ("Pss:")
+            << " private_kb=" << ReadProcKb ("Private_Clean:") + ReadProcKb ("Private_Dirty:")
+            << " own_table_bytes=" << model->GetLookupTableBytes ()
+            << " checksum=" << sum << std::endl;
+}
+
+/*
+ * Golden regression files
+ */
+
+/// First bytes of a golden file
+static const char GOLDEN_MAGIC[8] = { 'T', 'P', 'E', 'R', 'G', 'L', 'D', '1' };
+/// Written in native byte order to detect a file from another endianness
+static const uint32_t GOLDEN_BYTE_ORDER = 0x01020304;
+
+/**
+ * The sweep stored in a golden file; success rates are laid out as
+ * values[((model * modes + mode) * sizes + size) * snrs + snr].
+ */
+struct GoldenSweep
+{
+  std::vector<uint32_t> models;      //!< N of each ErrorRateModelN
+  std::vector<std::string> modes;    //!< unique name of each WifiMode
+  std::vector<uint32_t> sizes;       //!< chunk sizes (bits)
+  std::vector<double> snrDb;         //!< SNR grid (dB)
+  std::vector<double> values;        //!< success rates
+};
+
+/**
+ * \return every OFDM, ERP-OFDM, HT, VHT and DSSS mode
+ */
+static std::vector<WifiMode>
+GetAllModes (void)
+{
+  WifiMode modes[] = {
+    WifiPhy::GetDsssRate1Mbps (), WifiPhy::GetDsssRate2Mbps (),
+    WifiPhy::GetDsssRate5_5Mbps (), WifiPhy::GetDsssRate11Mbps (),
+    WifiPhy::GetErpOfdmRate6Mbps (), WifiPhy::GetErpOfdmRate9Mbps (),
+    WifiPhy::GetErpOfdmRate12Mbps (), WifiPhy::GetErpOfdmRate18Mbps (),
+    WifiPhy::GetErpOfdmRate24Mbps (), WifiPhy::GetErpOfdmRate36Mbps (),
+    WifiPhy::GetErpOfdmRate48Mbps (), WifiPhy::GetErpOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate3MbpsBW10MHz (), WifiPhy::GetOfdmRate4_5MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW10MHz (), WifiPhy::GetOfdmRate9MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW10MHz (), WifiPhy::GetOfdmRate18MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate24MbpsBW10MHz (), WifiPhy::GetOfdmRate27MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate1_5MbpsBW5MHz (), WifiPhy::GetOfdmRate2_25MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate3MbpsBW5MHz (), WifiPhy::GetOfdmRate4_5MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW5MHz (), WifiPhy::GetOfdmRate9MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW5MHz (), WifiPhy::GetOfdmRate13_5MbpsBW5MHz (),
+    WifiPhy::GetHtMcs0 (), WifiPhy::GetHtMcs1 (), WifiPhy::GetHtMcs2 (),
+    WifiPhy::GetHtMcs3 (), WifiPhy::GetHtMcs4 (), WifiPhy::GetHtMcs5 (),
+    WifiPhy::GetHtMcs6 (), WifiPhy::GetHtMcs7 (),
+    WifiPhy::GetVhtMcs0 (), WifiPhy::GetVhtMcs1 (), WifiPhy::GetVhtMcs2 (),
+    WifiPhy::GetVhtMcs3 (), WifiPhy::GetVhtMcs4 (), WifiPhy::GetVhtMcs5 (),
+    WifiPhy::GetVhtMcs6 (), WifiPhy::GetVhtMcs7 (), WifiPhy::GetVhtMcs8 (),
+    WifiPhy::GetVhtMcs9 ()
+  };
+  return std::vector<WifiMode> (modes, modes + sizeof (modes) / sizeof (modes[0]));
+}
+
+/**
+ * \return the sweep written by --write-golden, without values
+ */
+static GoldenSweep
+GetDefaultGoldenSweep (void)
+{
+  GoldenSweep sweep;
+  for (uint32_t n = 2; n <= 9; n++)
+    {
+      sweep.models.push_back (n);
+    }
+  std::vector<WifiMode> modes = GetAllModes ();
+  for (uint32_t i = 0; i < modes.size (); i++)
+    {
+      sweep.modes.push_back (modes[i].GetUniqueName ());
+    }
+  // ACK, RTS, IPv4 minimum datagram, Ethernet MTU and 802.11 MSDU maximum
+  const uint32_t bytes[] = { 14, 20, 576, 1500, 2304 };
+  for (uint32_t i = 0; i < sizeof (bytes) / sizeof (bytes[0]); i++)
+    {
+      sweep.sizes.push_back (8 * bytes[i]);
+    }
+  for (int32_t i = -40; i <= 160; i++)
+    {
+      sweep.snrDb.push_back (i * 0.25);
+    }
+  return sweep;
+}
+
+/**
+ * Evaluate a sweep for one model through one path.
+ *
+ * \param sweep the sweep
+ * \param m index of the model in sweep.models
+ * \param path the entry point used
+ *
+ * \return the success rates of model m, in the layout of sweep.values
+ */
+static std::vector<double>
+EvaluateGolden (const GoldenSweep &sweep, uint32_t m, BenchPath path)
+{
+  std::ostringstream name;
+  name << "ns3::ErrorRateModel" << sweep.models[m];
+  ObjectFactory factory;
+  factory.SetTypeId (name.str ());
+  factory.Set ("VectorKernel", BooleanValue (path == PATH_VECTOR || path == PATH_LUT));
+  factory.Set ("LookupTable", BooleanValue (path == PATH_LUT));
+  Ptr<TanhPerErrorRateModel> model = factory.Create<TanhPerErrorRateModel> ();
+
+  std::vector<WifiMode> all = GetAllModes ();
+  std::vector<double> snrs (sweep.snrDb.size ());
+  for (uint32_t i = 0; i < snrs.size (); i++)
+    {
+      snrs[i] = std::pow (10.0, sweep.snrDb[i] / 10);
+    }
+  WifiTxVector txVector;
+  std::vector<double> values;
+  for (uint32_t i = 0; i < sweep.modes.size (); i++)
+    {
+      uint32_t j = 0;
+      while (j < all.size () && all[j].GetUniqueName () != sweep.modes[i])
+        {
+          j++;
+        }
+      NS_ABORT_MSG_IF (j == all.size (), "golden file mode " << sweep.modes[i] << " is unknown");
+      WifiMode mode = all[j];
+      for (uint32_t s = 0; s < sweep.sizes.size (); s++)
+        {
+          std::vector<uint32_t> nbits (snrs.size (), sweep.sizes[s]);
+          std::vector<double> successRates (snrs.size ());
+          if (path == PATH_SCALAR)
+            {
+              for (uint32_t k = 0; k < snrs.size (); k++)
+                {
+                  successRates[k] = model->GetChunkSuccessRate (mode, txVector, snrs[k], sweep.sizes[s]);
+                }
+            }
+          else if (path == PATH_LOG)
+            {
+              model->GetChunkLogSuccessRateBatch (mode, txVector, &snrs[0], &nbits[0],
+                                                  &successRates[0], snrs.size ());
+              for (uint32_t k = 0; k < snrs.size (); k++)
+                {
+                  successRates[k] = std::exp (successRates[k]);
+                }
+            }
+          else
+            {
+              model->GetChunkSuccessRateBatch (mode, txVector, &snrs[0], &nbits[0],
+                                               &successRates[0], snrs.size ());
+            }
+          values.insert (values.end (), successRates.begin (), successRates.end ());
+        }
+    }
+  return values;
+}
+
+template <typename T>
+static void
+WriteRaw (std::ostream &os, const T &value)
+{
+  os.write (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+template <typename T>
+static bool
+ReadRaw (std::istream &is, T &value)
+{
+  is.read (reinterpret_cast<char *> (&value), sizeof (value));
+  return is.good ();
+}
+
+/**
+ * Write a golden file: magic, byte order, the four axis lengths, the
+ * axes, the values and an FNV-1a checksum of the values.
+ */
+static bool
+WriteGolden (const std::string &fileName, const GoldenSweep &sweep)
+{
+  std::ofstream os (fileName.c_str (), std::ios::binary);
+  os.write (GOLDEN_MAGIC, sizeof (GOLDEN_MAGIC));
+  WriteRaw (os, GOLDEN_BYTE_ORDER);
+  WriteRaw (os, static_cast<uint32_t> (sweep.models.size ()));
+  WriteRaw (os, static_cast<uint32_t> (sweep.modes.size ()));
+  WriteRaw (os, static_cast<uint32_t> (sweep.sizes.size ()));
+  WriteRaw (os, static_cast<uint32_t> (sweep.snrDb.size ()));
+  os.write (reinterpret_cast<const char *> (&sweep.models[0]), sweep.models.size () * sizeof (uint32_t));
+  for (uint32_t i = 0; i < sweep.modes.size (); i++)
+    {
+      WriteRaw (os, static_cast<uint16_t> (sweep.modes[i].size ()));
+      os.write (sweep.modes[i].data (), sweep.modes[i].size ());
+    }
+  os.write (reinterpret_cast<const char *> (&sweep.sizes[0]), sweep.sizes.size () * sizeof (uint32_t));
+  os.write (reinterpret_cast<const char *> (&sweep.snrDb[0]), sweep.snrDb.size () * sizeof (double));
+  os.write (reinterpret_cast<const char *> (&sweep.values[0]), sweep.values.size () * sizeof (double));
+  WriteRaw (os, HashBytes (&sweep.values[0], sweep.values.size () * sizeof (double)));
+  return os.good ();
+}
+
+/**
+ * Read a golden file written by WriteGolden.
+ *
+ * \return false if the file is missing, truncated or corrupt
+ */
+static bool
+ReadGolden (const std::string &fileName, GoldenSweep &sweep)
+{
+  std::ifstream is (fileName.c_str (), std::ios::binary);
+  char magic[sizeof (GOLDEN_MAGIC)];
+  uint32_t byteOrder, models, modes, sizes, snrs;
+  is.read (magic, sizeof (magic));
+  if (!is.good () || memcmp (magic, GOLDEN_MAGIC, sizeof (magic)) != 0
+      || !ReadRaw (is, byteOrder) || byteOrder != GOLDEN_BYTE_ORDER
+      || !ReadRaw (is, models) || !ReadRaw (is, modes)
+      || !ReadRaw (is, sizes) || !ReadRaw (is, snrs)
+      || models == 0 || modes == 0 || sizes == 0 || snrs == 0)
+    {
+      return false;
+    }
+  sweep.models.resize (models);
+  is.read (reinterpret_cast<char *> (&sweep.models[0]), models * sizeof (uint32_t));
+  sweep.modes.resize (modes);
+  for (uint32_t i = 0; i < modes && is.good (); i++)
+    {
+      uint16_t length;
+      ReadRaw (is, length);
+      sweep.modes[i].resize (length);
+      is.read (&sweep.modes[i][0], length);
+    }
+  sweep.sizes.resize (sizes);
+  is.read (reinterpret_cast<char *> (&sweep.sizes[0]), sizes * sizeof (uint32_t));
+  sweep.snrDb.resize (snrs);
+  is.read (reinterpret_cast<char *> (&sweep.snrDb[0]), snrs * sizeof (double));
+  sweep.values.resize (static_cast<size_t> (models) * modes * sizes * snrs);
+  is.read (reinterpret_cast<char *> (&sweep.values[0]), sweep.values.size () * sizeof (double));
+  uint64_t hash;
+  return ReadRaw (is, hash)
+         && hash == HashBytes (&sweep.values[0], sweep.values.size () * sizeof (double));
+}
+
+/**
+ * \return the largest deviation of the model at index m, evaluated
+ *         through path, from the golden values
+ */
+static Deviation
+CompareGolden (const GoldenSweep &golden, uint32_t m, BenchPath path)
+{
+  std::vector<double> values = EvaluateGolden (golden, m, path);
+  size_t offset = static_cast<size_t> (m) * values.size ();
+  Deviation deviation = { 0, 0 };
+  for (size_t i = 0; i < values.size (); i++)
+    {
+      double expected = golden.values[offset + i];
+      if (expected != expected)
+        {
+          // no reference value: the golden model was not finite here
+          continue;
+        }
+      if (!std::isfinite (values[i]))
+        {
+          deviation.maxAbs = std::numeric_limits<double>::infinity ();
+          deviation.maxRel = std::numeric_limits<double>::infinity ();
+          continue;
+        }
+      if (values[i] == expected)
+        {
+          continue;
+        }
+      double abs = std::fabs (values[i] - expected);
+      if (path == PATH_LOG)
+        {
+          // exp (log (p)) is off by about |log (p)| ULP of p, which only
+          // matters for the DSSS values far above 1 that the SNR in dB
+          // quirk produces; measure those relative to their size
+          abs /= std::max (1.0, std::fabs (expected));
+        }
+      deviation.maxAbs = std::max (deviation.maxAbs, abs);
+      // A golden zero only bounds the absolute deviation
+      if (expected != 0)
+        {
+          deviation.maxRel = std::max (deviation.maxRel, abs / std::fabs (expected));
+        }
+    }
+  return deviation;
+}
+
+static std::string
+FormatDeviation (const std::map<std::pair<uint32_t, BenchPath>, Deviation> &deviations,
+                 const BenchCase &c, bool relative, const char *unknown)
+{
+  std::map<std::pair<uint32_t, BenchPath>, Deviation>::const_iterator it =
+    deviations.find (std::make_pair (c.model, c.path));
+  if (it == deviations.end ())
+    {
+      return unknown;
+    }
+  double value = relative ? it->second.maxRel : it->second.maxAbs;
+  if (std::isinf (value))
+    {
+      // JSON has no infinity
+      return "1e999";
+    }
+  std::ostringstream os;
+  os << std::scientific << std::setprecision (3) << value;
+  return os.str ();
+}
+
+static std::string
+FormatCycles (double cycles, const char *unknown)
+{
+  if (cycles < 0)
+    {
+      return unknown;
+    }
+  std::ostringstream os;
+  os << std::fixed << std::setprecision (2) << cycles;
+  return os.str ();
+}
+
+static void
+WriteCsv (std::ostream &os, const std::vector<BenchCase> &cases,
+          const std::map<std::pair<uint32_t, BenchPath>, Deviation> &deviations)
+{
+  os << "model,path,mode,row,regime,nbits,calls,ns_per_call,calls_per_s,cycles_per_call,"
+     << "max_abs_dev,max_rel_dev" << std::endl;
+  for (uint32_t i = 0; i < cases.size (); i++)
+    {
+      const BenchCase &c = cases[i];
+      os << "ErrorRateModel" << c.model << "," << GetPathName (c.path) << ","
+         << c.mode << "," << c.row << "," << c.regime << "," << c.nbits << ","
+         << c.calls << "," << std::fixed << std::setprecision (3) << c.ns << ","
+         << std::setprecision (0) << 1e9 / c.ns << ","
+         << FormatCycles (c.cycles, "") << ","
+         << FormatDeviation (deviations, c, false, "") << ","
+         << FormatDeviation (deviations, c, true, "") << std::endl;
+    }
+}
+
+static void
+WriteJson (std::ostream &os, const std::vector<BenchCase> &cases,
+           const std::map<std::pair<uint32_t, BenchPath>, Deviation> &deviations,
+           const char *vectorKernels)
+{
+  os << "{" << std::endl
+     << "  \"vector_kernels\": \"" << vectorKernels << "\"," << std::endl
+#ifdef BENCH_HAVE_TSC
+     << "  \"cycle_source\": \"tsc\"," << std::endl
+#else
+     << "  \"cycle_source\": \"ghz\"," << std::endl
+#endif
+     << "  \"results\": [" << std::endl;
+  for (uint32_t i = 0; i < cases.size (); i++)
+    {
+      const BenchCase &c = cases[i];
+      os << "    {\"model\": \"ErrorRateModel" << c.model << "\", \"path\": \""
+         << GetPathName (c.path) << "\", \"mode\": \"" << c.mode << "\", \"row\": "
+         << c.row << ", \"regime\": \"" << c.regime << "\", \"nbits\": " << c.nbits
+         << ", \"calls\": " << c.calls << ", \"ns_per_call\": "
+         << std::fixed << std::setprecision (3) << c.ns << ", \"calls_per_s\": "
+         << std::setprecision (0) << 1e9 / c.ns << ", \"cycles_per_call\": "
+         << FormatCycles (c.cycles, "null") << ", \"max_abs_dev\": "
+         << FormatDeviation (deviations, c, false, "null") << ", \"max_rel_dev\": "
+         << FormatDeviation (deviations, c, true, "null") << "}"
+         << (i + 1 < cases.size () ? "," : "") << std::endl;
+    }
+  os << "  ]" << std::endl << "}" << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t calls = 100000;
+  std::string format = "csv";
+  std::string models = "23456789";
+  double ghz = 0;
+  std::string writeGolden;
+  std::string golden;
+  double maxDeviation = -1;
+  uint32_t threads = 0;
+  bool frames = false;
+  bool staticCurves = false;
+  bool load = false;
+  bool fec = false;
+  std::string writeTables;
+  std::string tableSizes = "50,100,200,300,500,750,1000,1250,1500,2000,3000";
+  bool coldStart = false;
+  std::string tableFile;
+  double hold = 0;
+
+  CommandLine cmd;
+  cmd.AddValue ("calls", "Number of chunks evaluated per measurement", calls);
+  cmd.AddValue ("format", "Output format: csv or json", format);
+  cmd.AddValue ("models", "Digits of the ErrorRateModelN to time", models);
+  cmd.AddValue ("ghz", "CPU clock used for cycles/call when there is no TSC", ghz);
+  cmd.AddValue ("write-golden", "Write the golden sweep of this build to this file and exit", writeGolden);
+  cmd.AddValue ("golden", "Report the deviation of every path from this golden file", golden);
+  cmd.AddValue ("max-deviation", "Exit with status 2 if an absolute deviation exceeds this", maxDeviation);
+  cmd.AddValue ("threads", "Report the throughput from 1 up to this many threads and exit", threads);
+  cmd.AddValue ("frames", "Compare chunk-by-chunk and whole-frame evaluation and exit", frames);
+  cmd.AddValue ("static", "Compare the generic and the specialised curve computation and exit", staticCurves);
+  cmd.AddValue ("load", "Time loading coefficient files and their binary cache and exit", load);
+  cmd.AddValue ("fec", "Compare the per-term and Horner forms of the analytic FEC bound and exit", fec);
+  cmd.AddValue ("write-tables", "Write the lookup tables of the first model to this file and exit", writeTables);
+  cmd.AddValue ("table-sizes", "Chunk sizes (bytes, comma separated) of --write-tables and --cold-start", tableSizes);
+  cmd.AddValue ("cold-start", "Report the setup time and memory of a process using lookup tables and exit", coldStart);
+  cmd.AddValue ("table-file", "Table file --cold-start attaches instead of building the tables", tableFile);
+  cmd.AddValue ("hold", "Seconds --cold-start waits before reading its memory", hold);
+  cmd.Parse (argc, argv);
+
+  if (writeTables != "" || coldStart)
+    {
+      uint32_t n = models[0] - '0';
+      const TanhPerCoefficientSet *set = GetTanhPerCoefficientSet (n);
+      if (set == 0)
+        {
+          std::cerr << "no ErrorRateModel" << models[0] << std::endl;
+          return 1;
+        }
+      if (coldStart)
+        {
+          RunColdStart (n, tableFile, GetTableSizes (tableSizes), hold);
+          return 0;
+        }
+      Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+      std::string error;
+      if (!TanhPerTableFile::Write (writeTables, *set, GetTableSizes (tableSizes),
+                                    model->GetLookupTableResolution (), model->GetLookupTableMaxError (), error))
+        {
+          std::cerr << "could not write " << writeTables << ": " << error << std::endl;
+          return 1;
+        }
+      std::cerr << "wrote the tables of ErrorRateModel" << n << " to " << writeTables << std::endl;
+      return 0;
+    }
+
+  if (load)
+    {
+      for (uint32_t m = 0; m < models.size (); m++)
+        {
+          uint32_t n = models[m] - '0';
+          if (GetTanhPerCoefficientSet (n) == 0)
+            {
+              std::cerr << "no ErrorRateModel" << models[m] << std::endl;
+              return 1;
+            }
+          if (!TimeCoefficientLoad (n, std::max<uint32_t> (calls / 100, 1)))
+            {
+              return 1;
+            }
+        }
+      return 0;
+    }
+
+  if (fec)
+    {
+      double deviation = TimeFecBound (calls);
+      if (maxDeviation >= 0 && deviation > maxDeviation)
+        {
+          std::cerr << "deviation " << deviation << " exceeds " << maxDeviation << std::endl;
+          return 2;
+        }
+      return 0;
+    }
+
+  if (staticCurves)
+    {
+      for (uint32_t m = 0; m < models.size (); m++)
+        {
+          switch (models[m] - '0')
+            {
+            case 2:
+              TimeStaticCurves<2> (calls);
+              break;
+            case 3:
+              TimeStaticCurves<3> (calls);
+              break;
+            case 4:
+              TimeStaticCurves<4> (calls);
+              break;
+            case 5:
+              TimeStaticCurves<5> (calls);
+              break;
+            case 6:
+              TimeStaticCurves<6> (calls);
+              break;
+            case 7:
+              TimeStaticCurves<7> (calls);
+              break;
+            case 8:
+              TimeStaticCurves<8> (calls);
+              break;
+            case 9:
+              TimeStaticCurves<9> (calls);
+              break;
+            default:
+              std::cerr << "no ErrorRateModel" << models[m] << std::endl;
+              return 1;
+            }
+        }
+      return 0;
+    }
+
+  if (frames)
+    {
+      const uint32_t chunks[] = { 1, 10, 100 };
+      for (uint32_t m = 0; m < models.size (); m++)
+        {
+          uint32_t n = models[m] - '0';
+          if (GetTanhPerCoefficientSet (n) == 0)
+            {
+              std::cerr << "no ErrorRateModel" << models[m] << std::endl;
+              return 1;
+            }
+          for (uint32_t c = 0; c < sizeof (chunks) / sizeof (chunks[0]); c++)
+            {
+              TimeFrames (n, chunks[c], calls);
+            }
+        }
+      return 0;
+    }
+
+  if (threads > 0)
+    {
+      std::cerr << std::thread::hardware_concurrency () << " hardware threads" << std::endl;
+      for (uint32_t m = 0; m < models.size (); m++)
+        {
+          uint32_t n = models[m] - '0';
+          if (GetTanhPerCoefficientSet (n) == 0)
+            {
+              std::cerr << "no ErrorRateModel" << models[m] << std::endl;
+              return 1;
+            }
+          TimeThreads (n, false, calls, threads);
+          TimeThreads (n, true, calls, threads);
+        }
+      return 0;
+    }
+
+  if (writeGolden != "")
+    {
+      GoldenSweep sweep = GetDefaultGoldenSweep ();
+      for (uint32_t m = 0; m < sweep.models.size (); m++)
+        {
+          std::vector<double> values = EvaluateGolden (sweep, m, PATH_SCALAR);
+          for (uint32_t i = 0; i < values.size (); i++)
+            {
+              // stored as NaN, which CompareGolden leaves out
+              sweep.values.push_back (std::isfinite (values[i]) ? values[i]
+                                      : std::numeric_limits<double>::quiet_NaN ());
+            }
+        }
+      if (!WriteGolden (writeGolden, sweep))
+        {
+          std::cerr << "could not write " << writeGolden << std::endl;
+          return 1;
+        }
+      std::cerr << "wrote " << sweep.values.size () << " success rates to " << writeGolden << std::endl;
+      return 0;
+    }
+  GoldenSweep goldenSweep;
+  if (golden != "" && !ReadGolden (golden, goldenSweep))
+    {
+      std::cerr << "could not read golden file " << golden << std::endl;
+      return 1;
+    }
+
+  if (format != "csv" && format != "json")
+    {
+      std::cerr << "unknown format " << format << std::endl;
+      return 1;
+    }
+
+  // one 20 MHz OFDM mode per coefficient row, in row order
+  WifiMode ofdmModes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps ()
+  };
+  WifiMode dsssModes[] = {
+    WifiPhy::GetDsssRate1Mbps (), WifiPhy::GetDsssRate2Mbps (),
+    WifiPhy::GetDsssRate5_5Mbps (), WifiPhy::GetDsssRate11Mbps ()
+  };
+  // 50-byte control frame up to a 3000-byte A-MSDU
+  const uint32_t sizes[] = { 8 * 50, 8 * 500, 8 * 1500, 8 * 3000 };
+  const BenchPath paths[] = { PATH_SCALAR, PATH_BATCH, PATH_VECTOR, PATH_LUT, PATH_LOG };
+
+  std::vector<BenchCase> cases;
+  std::map<std::pair<uint32_t, BenchPath>, Deviation> deviations;
+  bool exceeded = false;
+  for (uint32_t m = 0; m < models.size (); m++)
+    {
+      uint32_t n = models[m] - '0';
+      const TanhPerCoefficientSet *set = GetTanhPerCoefficientSet (n);
+      if (set == 0)
+        {
+          std::cerr << "no ErrorRateModel" << models[m] << std::endl;
+          return 1;
+        }
+      Ptr<TanhPerErrorRateModel> model = CreateObject<TanhPerErrorRateModel> ();
+      model->SetCoefficientSet (n);
+      // built and self-tested once, outside of the timed region
+      Ptr<TanhPerErrorRateModel> lutModel = CreateObject<TanhPerErrorRateModel> ();
+      lutModel->SetCoefficientSet (n);
+      lutModel->SetLookupTable (true);
+      TanhPerCurveCache curves (*set);
+
+      for (uint32_t g = 0; g < goldenSweep.models.size (); g++)
+        {
+          if (goldenSweep.models[g] != n)
+            {
+              continue;
+            }
+          for (uint32_t p = 0; p < sizeof (paths) / sizeof (paths[0]); p++)
+            {
+              Deviation deviation = CompareGolden (goldenSweep, g, paths[p]);
+              deviations[std::make_pair (n, paths[p])] = deviation;
+              // the tables are only held to the error they guarantee
+              double limit = (paths[p] == PATH_LUT)
+                ? std::max (maxDeviation, lutModel->GetLookupTableMaxError ()) : maxDeviation;
+              exceeded = exceeded || (maxDeviation >= 0 && !(deviation.maxAbs <= limit));
+              std::cerr << "ErrorRateModel" << n << " " << GetPathName (paths[p])
+                        << " deviation from " << golden << ": max abs " << deviation.maxAbs
+                        << " max rel " << deviation.maxRel << std::endl;
+            }
+        }
+
+      for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+        {
+          for (uint32_t p = 0; p < sizeof (paths) / sizeof (paths[0]); p++)
+            {
+              BenchCase c;
+              c.model = n;
+              c.path = paths[p];
+              c.nbits = sizes[s];
+              for (uint8_t row = 0; row < 8; row++)
+                {
+                  const TanhPerCurve &curve = curves.Lookup (row, sizes[s]);
+                  if (std::isinf (curve.switchDb))
+                    {
+                      // flat curve: only one regime is reachable
+                      continue;
+                    }
+                  // sweep SWEEP_WIDTH_DB on each side of the switch, staying
+                  // 0.01 dB clear of it
+                  double below[2] = { curve.switchDb - SWEEP_WIDTH_DB, curve.switchDb - 0.01 };
+                  double above[2] = { curve.switchDb + 0.01, curve.switchDb + SWEEP_WIDTH_DB };
+                  const char *regimes[2] = { "low", "high" };
+                  for (uint32_t regime = 0; regime < 2; regime++)
+                    {
+                      const double *range = ((regime == 1) == curve.highAbove) ? above : below;
+                      c.mode = ofdmModes[row].GetUniqueName ();
+                      c.row = row;
+                      c.regime = regimes[regime];
+                      c.calls = calls;
+                      TimeCase ((c.path == PATH_LUT) ? lutModel : model, ofdmModes[row],
+                                GetSnrSweep (range[0], range[1]), c, ghz);
+                      cases.push_back (c);
+                    }
+                }
+              for (uint32_t d = 0; d < sizeof (dsssModes) / sizeof (dsssModes[0]); d++)
+                {
+                  c.mode = dsssModes[d].GetUniqueName ();
+                  c.row = -1;
+                  c.regime = "dsss";
+                  c.calls = calls;
+                  // the DSSS models are handed the SNR in dB as a ratio, and
+                  // their success rate is only finite above 0 dB
+                  TimeCase ((c.path == PATH_LUT) ? lutModel : model, dsssModes[d],
+                            GetSnrSweep (0.5, 15), c, ghz);
+                  cases.push_back (c);
+                }
+            }
+        }
+      std::cerr << "ErrorRateModel" << n << " lookup tables: " << lutModel->GetLookupTableBytes ()
+                << " bytes resident, " << lutModel->GetLookupTableEvictions () << " evicted" << std::endl;
+    }
+
+  if (format == "json")
+    {
+      WriteJson (std::cout, cases, deviations, GetTanhPerVectorKernels ().name);
+    }
+  else
+    {
+      WriteCsv (std::cout, cases, deviations);
+    }
+
+  const char *kernels[] = { "scalar", "avx2", "avx512" };
+  for (uint32_t i = 0; i < sizeof (kernels) / sizeof (kernels[0]); i++)
+    {
+      const TanhPerKernels *k = GetTanhPerKernels (kernels[i]);
+      if (k == 0)
+        {
+          std::cerr << kernels[i] << " not supported by this CPU" << std::endl;
+          continue;
+        }
+      std::cerr << kernels[i] << " max |error| against libm "
+                << CheckTanhPerKernels (*k, GetTanhPerLibmKernels ()) << std::endl;
+    }
+  if (exceeded)
+    {
+      std::cerr << "deviation from " << golden << " exceeds " << maxDeviation << std::endl;
+      return 2;
+    }
+  return 0;
+}
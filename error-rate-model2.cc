@@ -23,23 +23,17 @@
  * Alejandro Flores <xalejandroflores@gmail.com>
  */
 
-#include <cmath>
 #include "error-rate-model2.h"
-#include "wifi-phy.h"
-#include "ns3/log.h"
-
 
 namespace ns3 {
 
-NS_LOG_COMPONENT_DEFINE ("ErrorRateModel2");
-
 NS_OBJECT_ENSURE_REGISTERED (ErrorRateModel2);
 
 TypeId
 ErrorRateModel2::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::ErrorRateModel2")
-    .SetParent<ErrorRateModel> ()
+    .SetParent<TanhPerErrorRateModel> ()
     .SetGroupName ("Wifi")
     .AddConstructor<ErrorRateModel2> ()
   ;
@@ -47,650 +41,8 @@ ErrorRateModel2::GetTypeId (void)
 }
 
 ErrorRateModel2::ErrorRateModel2 ()
-
-//Begin added by juan
-: modelType (15)
-
-//end added by juan
-{
-}
-
-
-//==begin added by juan
-
-void
-ErrorRateModel2::SetErrorModel(uint32_t _model)
-{
-  modelType = _model;
-}
-uint32_t
-ErrorRateModel2::GetModel (void) const
-{
-  return modelType;
-}
-
-//===addded by juan
-
-
-double
-ErrorRateModel2::GetBpskBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr);
-  double ber = 0.5 * erfc (z);
-  NS_LOG_INFO ("bpsk snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel2::GetQpskBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / 2.0);
-  double ber = 0.5 * erfc (z);
-  NS_LOG_INFO ("qpsk snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel2::Get16QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (5.0 * 2.0));
-  double ber = 0.75 * 0.5 * erfc (z);
-  NS_LOG_INFO ("16-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel2::Get64QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (21.0 * 2.0));
-  double ber = 7.0 / 12.0 * 0.5 * erfc (z);
-  NS_LOG_INFO ("64-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-double
-ErrorRateModel2::Get256QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (85.0 * 2.0));
-  double ber = 15.0 / 32.0 * 0.5 * erfc (z);
-  NS_LOG_INFO ("256-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel2::GetFecBpskBer (double snr, uint32_t nbits,
-                                   uint32_t bValue) const
+  : TanhPerErrorRateModel (g_errorRateModel2Coefficients)
 {
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = GetBpskBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, (double)nbits);
-  return pms;
-}
-
-double
-ErrorRateModel2::GetFecQpskBer (double snr, uint32_t nbits,
-                                   uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = GetQpskBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, (double)nbits);
-  return pms;
-}
-
-double
-ErrorRateModel2::CalculatePe (double p, uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << p << bValue);
-  double D = std::sqrt (4.0 * p * (1.0 - p));
-  double pe = 1.0;
-  if (bValue == 1)
-    {
-      //code rate 1/2, use table 3.1.1
-      pe = 0.5 * (36.0 * std::pow (D, 10)
-                  + 211.0 * std::pow (D, 12)
-                  + 1404.0 * std::pow (D, 14)
-                  + 11633.0 * std::pow (D, 16)
-                  + 77433.0 * std::pow (D, 18)
-                  + 502690.0 * std::pow (D, 20)
-                  + 3322763.0 * std::pow (D, 22)
-                  + 21292910.0 * std::pow (D, 24)
-                  + 134365911.0 * std::pow (D, 26));
-    }
-  else if (bValue == 2)
-    {
-      //code rate 2/3, use table 3.1.2
-      pe = 1.0 / (2.0 * bValue) *
-        (3.0 * std::pow (D, 6)
-         + 70.0 * std::pow (D, 7)
-         + 285.0 * std::pow (D, 8)
-         + 1276.0 * std::pow (D, 9)
-         + 6160.0 * std::pow (D, 10)
-         + 27128.0 * std::pow (D, 11)
-         + 117019.0 * std::pow (D, 12)
-         + 498860.0 * std::pow (D, 13)
-         + 2103891.0 * std::pow (D, 14)
-         + 8784123.0 * std::pow (D, 15));
-    }
-  else if (bValue == 3)
-    {
-      //code rate 3/4, use table 3.1.2
-      pe = 1.0 / (2.0 * bValue) *
-        (42.0 * std::pow (D, 5)
-         + 201.0 * std::pow (D, 6)
-         + 1492.0 * std::pow (D, 7)
-         + 10469.0 * std::pow (D, 8)
-         + 62935.0 * std::pow (D, 9)
-         + 379644.0 * std::pow (D, 10)
-         + 2253373.0 * std::pow (D, 11)
-         + 13073811.0 * std::pow (D, 12)
-         + 75152755.0 * std::pow (D, 13)
-         + 428005675.0 * std::pow (D, 14));
-    }
-  else if (bValue == 5)
-    {
-      //code rate 5/6, use table V from D. Haccoun and G. Begin, "High-Rate Punctured Convolutional Codes
-      //for Viterbi Sequential Decoding", IEEE Transactions on Communications, Vol. 32, Issue 3, pp.315-319.
-      pe = 1.0 / (2.0 * bValue) *
-        (92.0 * std::pow (D, 4.0)
-         + 528.0 * std::pow (D, 5.0)
-         + 8694.0 * std::pow (D, 6.0)
-         + 79453.0 * std::pow (D, 7.0)
-         + 792114.0 * std::pow (D, 8.0)
-         + 7375573.0 * std::pow (D, 9.0)
-         + 67884974.0 * std::pow (D, 10.0)
-         + 610875423.0 * std::pow (D, 11.0)
-         + 5427275376.0 * std::pow (D, 12.0)
-         + 47664215639.0 * std::pow (D, 13.0));
-    }
-  else
-    {
-      NS_ASSERT (false);
-    }
-  return pe;
-}
-
-double
-ErrorRateModel2::GetFec16QamBer (double snr, uint32_t nbits,
-                                    uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get16QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-double
-ErrorRateModel2::GetFec64QamBer (double snr, uint32_t nbits,
-                                    uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get64QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-double
-ErrorRateModel2::GetFec256QamBer (double snr, uint32_t nbits,
-                                     uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get256QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-
-//New error model adaptation based on paper
-double
-ErrorRateModel2::GetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const
-{
-
-
-	//std::cout << GetModel() <<"\n";
-
-  double *pt;
-	//MODELO HPA
-
-  	  /*
-	double arreglo_hpa[8][8]={2.4382,	-1.326,	0.5248,	-1.4508,	-0.0019432,	9.62E-05,	-0.001829,	2.38E-06,
-			3.4477,	-4.457,	0.39222,	-1.1059,	-0.0024534,	5.30E-05,	-0.0026999,	1.26E-05,
-			3.3007,	-4.4931,	0.4327,	-1.3279,	-0.0023258,	5.22E-05,	-0.0021253,	1.09E-05,
-			3.323,	-6.3248,	0.25329,	-1.0031,	-0.0028452,	4.90E-05,	-0.0032148,	1.99E-05,
-			4.1355,	-9.6687,	0.25201,	-1.0202,	-0.0019983,	3.81E-05,	-0.0016966,	1.81E-05,
-			3.2862,	-9.7905,	0.14137,	-0.75721,	-0.0032982,	3.64E-05,	-0.0038832,	1.59E-05,
-			104.13,	-111.41,	-0.047366,	-0.48318,	-0.00038274,	-0.00034943,	-0.01,	-0.00014297,
-			100.57,	-106.74,	-0.048762,	-0.36784,	-0.00038695,	-0.00035381,	-0.01,	-0.00013778
-	};
-	*/
-
-
-	double arreglo_modelo[8][8] = {
-			3.15361290882268, -2.48945855523085, 0.502484877279319, -0.951326960807816,-0.00130291809731900, 4.82643541770000e-05,-0.00220770784130900,2.33967659230000e-05,
-			3.98858928921030,-4.13316079950364, 0.498546812927676,-0.954393382427655,-0.00145088765811600,3.94720851110000e-05,-0.00206640623209800,2.27680867770000e-05,
-			4.56658569864409,-5.25127534216202, 0.500112472564906,-0.943566468787194,-0.00160589553186300,3.73453840370000e-05,-0.00232406553895000,2.39042959190000e-05,
-			5.43311605342393,-6.93535572518656, 0.497687804209667,-0.949195865321411,-0.00168948191634600,3.41443576670000e-05,-0.00224889609965300,2.34826576290000e-05,
-			8.25718745445097,-11.8162579554963, 0.520049959463506,-0.952788798553077,-0.00153305210482100,2.43288709980000e-05,-0.00179693108775900,1.81898014630000e-05,
-			8.95733278540931,-13.3483194110432, 0.504389650770466,-0.943300700966366,-0.00158413502606700,2.57560115960000e-05,-0.00183514506155200,2.02420535230000e-05,
-			11.6439264576348,-17.5875720240176, 0.503491268321830,-0.896103139005381,-0.00169905886348200,2.79302842800000e-05,-0.00188309046285100,2.34253796000000e-05,
-			12.2248566770556,-17.9954245796341, 0.523560568723562,-0.894450035297498,-0.00192790322865100,2.75060844500000e-05,-0.00218951587758800,2.30320808130000e-05
-	};
-
-	//(10 - en adelante)
-
-	double arreglo_modelo1[8][8] = {
-			3.83745364713474, -3.70096579924190, 0.414309145627238, -1.29168334999200,-0.00164631481445100,3.68457859450000e-05,-0.00186037943625500,1.28206180550000e-05,
-			4.55243774215753,-5.93997163678378, 0.415663727878080,-1.28405106019439,-0.00168354936289700,2.91304743380000e-05,-0.00194388883245300,1.35121443600000e-05,
-			5.05730850355095,-7.53562652839129, 0.414822720985070,-1.28912950027701,-0.00175592764824900,2.60870346880000e-05,-0.00192822524608500,1.30596395740000e-05,
-			5.70761964869242,-9.55413559784494, 0.411213430141612,-1.26226600035705,-0.00204498057575100,2.57287414410000e-05,-0.00242758598226100,1.51177021660000e-05,
-			7.90828254191640,-15.8236007708639, 0.415449799755198,-1.25241827226232,-0.00184416641136100,2.12134975710000e-05,-0.00193505099832700,1.44482872670000e-05,
-			8.69271102578059,-18.0245232826899, 0.419096083715168,-1.25210214485501,-0.00198381147811500,1.98920647190000e-05,-0.00212423626064900,1.39952846760000e-05,
-			11.1041073802217,-24.7020307416564, 0.420469666216188,-1.23635060957999,-0.00183324706523300,1.79757951710000e-05,-0.00189014040121100,1.36304965130000e-05,
-			11.3545345354669,-25.0538468553275, 0.423762016952948,-1.22298953198653,-0.00192333515969100,1.88462777690000e-05,-0.00203576758032700,1.45972103440000e-05
-	};
-
-
-  snr=10*std::log10(snr);
-  if (mode.GetModulationClass () == WIFI_MOD_CLASS_ERP_OFDM
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_OFDM
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_HT
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_VHT)
-    {
-	  double c_1;
-	  double c_2;
-	  double c_3;
-	  double c_4;
-	  double d_1;
-	  double d_2;
-	  double d_3;
-	  double d_4;
-      if (mode.GetConstellationSize () == 2)
-      {
-          if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-        	  //(3Mbps)
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[0][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //aded by juan
-
-            	  if (PER_paper_log>10)
-            	              	  {
-					  pt=&arreglo_modelo1[0][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-
-            	  double Su=1-PER_paper;
-            	  return Su;
-                }
-              //else {}
-              //}
-          else
-          {
-        	  //4.5Mbps
-              //if (txVector.GetChannelWidth ()==20)
-              //{
-            	  pt=&arreglo_modelo[1][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //added by juan
-            	  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[1][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-
-            	  double Su=1-PER_paper;
-            	  return Su;
-             //   }
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 4)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-    		  //6Mbps
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[2][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //added by juan
-            	  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[2][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-            	  return Su;
-              //}
-             // else {}
-          }
-          else
-          {
-        	  //9Mbps
-            //  if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[3][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[3][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-            	  return Su;
-             // }
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 16)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-    		  //12Mbps
-             // if (txVector.GetChannelWidth ()==20)
-              //{
-            	  pt=&arreglo_modelo[4][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-			      double PER_paper_log = -10*log10(PER_paper);
-			      if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[4][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-             // }
-              //else {}
-          }
-          else
-          {
-        	  //18Mbps
-              //if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[5][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-               	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[5][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-              //}
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 64)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_2_3)
-          {
-    		  //24Mbps
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[6][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-               	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[6][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-             // }
-             // else {}
-          }
-          else
-          {
-        	  //27Mbps
-            // if (txVector.GetChannelWidth ()==20)
-            // {
-           	  pt=&arreglo_modelo[7][0];
-              	  c_1 = *pt;
-              	  c_2 = *(pt+1);
-              	  c_3 = *(pt+2);
-              	  c_4 =	*(pt+3);
-              	  d_1 = *(pt+4);
-              	  d_2 =	*(pt+5);
-              	  d_3 = *(pt+6);
-              	  d_4 = *(pt+7);
-
-            	 double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	 double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	 double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-
-            	 double PER_paper_log = -10*log10(PER_paper);
-				if (PER_paper_log>10)
-				{
-				  pt=&arreglo_modelo1[7][0];
-				  c_1 = *pt;
-				  c_2 = *(pt+1);
-				  c_3 = *(pt+2);
-				  c_4 =	*(pt+3);
-				  d_1 = *(pt+4);
-				  d_2 =	*(pt+5);
-				  d_3 = *(pt+6);
-				  d_4 = *(pt+7);
-
-				  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-				  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-				  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				}
-				 double Su=1-PER_paper;
-            	 return Su;
-            // }
-            // else {}
-          }
-      }
-    }
-  else if (mode.GetModulationClass () == WIFI_MOD_CLASS_DSSS || mode.GetModulationClass () == WIFI_MOD_CLASS_HR_DSSS)
-  {
-	  switch (mode.GetDataRate (20, 0, 1))
-      {
-	  case 1000000:
-          return DsssErrorRateModel::GetDsssDbpskSuccessRate (snr, nbits);
-      case 2000000:
-          return DsssErrorRateModel::GetDsssDqpskSuccessRate (snr, nbits);
-      case 5500000:
-          return DsssErrorRateModel::GetDsssDqpskCck5_5SuccessRate (snr, nbits);
-      case 11000000:
-          return DsssErrorRateModel::GetDsssDqpskCck11SuccessRate (snr, nbits);
-      default:
-          NS_ASSERT ("undefined DSSS/HR-DSSS datarate");
-      }
-  }
-  return 0;
 }
 
 } //namespace ns3
@@ -23,23 +23,17 @@
  * Alejandro Flores <xalejandroflores@gmail.com>
  */
 
-#include <cmath>
 #include "error-rate-model5.h"
-#include "wifi-phy.h"
-#include "ns3/log.h"
-
 
 namespace ns3 {
 
-NS_LOG_COMPONENT_DEFINE ("ErrorRateModel5");
-
 NS_OBJECT_ENSURE_REGISTERED (ErrorRateModel5);
 
 TypeId
 ErrorRateModel5::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::ErrorRateModel5")
-    .SetParent<ErrorRateModel> ()
+    .SetParent<TanhPerErrorRateModel> ()
     .SetGroupName ("Wifi")
     .AddConstructor<ErrorRateModel5> ()
   ;
@@ -47,636 +41,8 @@ ErrorRateModel5::GetTypeId (void)
 }
 
 ErrorRateModel5::ErrorRateModel5 ()
-
-//Begin added by juan
-: modelType (15)
-
-//end added by juan
-{
-}
-
-
-//==begin added by juan
-
-void
-ErrorRateModel5::SetErrorModel(uint32_t _model)
-{
-  modelType = _model;
-}
-uint32_t
-ErrorRateModel5::GetModel (void) const
-{
-  return modelType;
-}
-
-//===addded by juan
-
-
-double
-ErrorRateModel5::GetBpskBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr);
-  double ber = 0.5 * erfc (z);
-  NS_LOG_INFO ("bpsk snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel5::GetQpskBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / 2.0);
-  double ber = 0.5 * erfc (z);
-  NS_LOG_INFO ("qpsk snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel5::Get16QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (5.0 * 2.0));
-  double ber = 0.75 * 0.5 * erfc (z);
-  NS_LOG_INFO ("16-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel5::Get64QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (21.0 * 2.0));
-  double ber = 7.0 / 12.0 * 0.5 * erfc (z);
-  NS_LOG_INFO ("64-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-double
-ErrorRateModel5::Get256QamBer (double snr) const
-{
-  NS_LOG_FUNCTION (this << snr);
-  double z = std::sqrt (snr / (85.0 * 2.0));
-  double ber = 15.0 / 32.0 * 0.5 * erfc (z);
-  NS_LOG_INFO ("256-Qam" << " snr=" << snr << " ber=" << ber);
-  return ber;
-}
-
-double
-ErrorRateModel5::GetFecBpskBer (double snr, uint32_t nbits,
-                                   uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = GetBpskBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, (double)nbits);
-  return pms;
-}
-
-double
-ErrorRateModel5::GetFecQpskBer (double snr, uint32_t nbits,
-                                   uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = GetQpskBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, (double)nbits);
-  return pms;
-}
-
-double
-ErrorRateModel5::CalculatePe (double p, uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << p << bValue);
-  double D = std::sqrt (4.0 * p * (1.0 - p));
-  double pe = 1.0;
-  if (bValue == 1)
-    {
-      //code rate 1/2, use table 3.1.1
-      pe = 0.5 * (36.0 * std::pow (D, 10)
-                  + 211.0 * std::pow (D, 12)
-                  + 1404.0 * std::pow (D, 14)
-                  + 11633.0 * std::pow (D, 16)
-                  + 77433.0 * std::pow (D, 18)
-                  + 502690.0 * std::pow (D, 20)
-                  + 3322763.0 * std::pow (D, 22)
-                  + 21292910.0 * std::pow (D, 24)
-                  + 134365911.0 * std::pow (D, 26));
-    }
-  else if (bValue == 2)
-    {
-      //code rate 2/3, use table 3.1.2
-      pe = 1.0 / (2.0 * bValue) *
-        (3.0 * std::pow (D, 6)
-         + 70.0 * std::pow (D, 7)
-         + 285.0 * std::pow (D, 8)
-         + 1276.0 * std::pow (D, 9)
-         + 6160.0 * std::pow (D, 10)
-         + 27128.0 * std::pow (D, 11)
-         + 117019.0 * std::pow (D, 12)
-         + 498860.0 * std::pow (D, 13)
-         + 2103891.0 * std::pow (D, 14)
-         + 8784123.0 * std::pow (D, 15));
-    }
-  else if (bValue == 3)
-    {
-      //code rate 3/4, use table 3.1.2
-      pe = 1.0 / (2.0 * bValue) *
-        (42.0 * std::pow (D, 5)
-         + 201.0 * std::pow (D, 6)
-         + 1492.0 * std::pow (D, 7)
-         + 10469.0 * std::pow (D, 8)
-         + 62935.0 * std::pow (D, 9)
-         + 379644.0 * std::pow (D, 10)
-         + 2253373.0 * std::pow (D, 11)
-         + 13073811.0 * std::pow (D, 12)
-         + 75152755.0 * std::pow (D, 13)
-         + 428005675.0 * std::pow (D, 14));
-    }
-  else if (bValue == 5)
-    {
-      //code rate 5/6, use table V from D. Haccoun and G. Begin, "High-Rate Punctured Convolutional Codes
-      //for Viterbi Sequential Decoding", IEEE Transactions on Communications, Vol. 32, Issue 3, pp.315-319.
-      pe = 1.0 / (2.0 * bValue) *
-        (92.0 * std::pow (D, 4.0)
-         + 528.0 * std::pow (D, 5.0)
-         + 8694.0 * std::pow (D, 6.0)
-         + 79453.0 * std::pow (D, 7.0)
-         + 792114.0 * std::pow (D, 8.0)
-         + 7375573.0 * std::pow (D, 9.0)
-         + 67884974.0 * std::pow (D, 10.0)
-         + 610875423.0 * std::pow (D, 11.0)
-         + 5427275376.0 * std::pow (D, 12.0)
-         + 47664215639.0 * std::pow (D, 13.0));
-    }
-  else
-    {
-      NS_ASSERT (false);
-    }
-  return pe;
-}
-
-double
-ErrorRateModel5::GetFec16QamBer (double snr, uint32_t nbits,
-                                    uint32_t bValue) const
+  : TanhPerErrorRateModel (g_errorRateModel5Coefficients)
 {
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get16QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-double
-ErrorRateModel5::GetFec64QamBer (double snr, uint32_t nbits,
-                                    uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get64QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-double
-ErrorRateModel5::GetFec256QamBer (double snr, uint32_t nbits,
-                                     uint32_t bValue) const
-{
-  NS_LOG_FUNCTION (this << snr << nbits << bValue);
-  double ber = Get256QamBer (snr);
-  if (ber == 0.0)
-    {
-      return 1.0;
-    }
-  double pe = CalculatePe (ber, bValue);
-  pe = std::min (pe, 1.0);
-  double pms = std::pow (1 - pe, static_cast<double> (nbits));
-  return pms;
-}
-
-
-//New error model adaptation based on paper
-double
-ErrorRateModel5::GetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const
-{
-
-
-	//std::cout << GetModel() <<"\n";
-
-  double *pt;
-
-	double arreglo_modelo[8][8] = {
-			1.61138386888626,4.29260167970805,0.231929609679903, -1.71634262438178,-0.00162769470440000,-2.43079331850000e-05,-0.00285681163913800,5.87951954800000e-06,
-			1.94615854883002,-4.71690210651555, -0.273995924534726,-2.08390751836259,-0.00288847517092400,1.97657817870000e-05,-0.00145484203885700,-1.31445867400000e-06,
-			2.47167647911655,-1.08954354629650, 0.242276123529716,-1.72175604324440,-0.00162874958766000,6.39645305440000e-05,-0.00315104052888700,5.70417033700000e-06,
-			1.19326524267804,-9.56336746772198, -0.205643142870542,-1.83481916803012,-0.00459480072717800,8.82280631000000e-06,-0.00156658072345100,-1.23681150700000e-06,
-			3.67542085364883,-9.80067096133878, 0.231656232645288,-1.44992805162847,-0.00276016911196100,2.15409079870000e-05,-0.00446708147232800,1.10651337490000e-05,
-			1.32796345893313,-21.2138789230135, -0.0753923406032680,-1.78503016704826,-0.00287682422299000,2.12951812800000e-06,-0.00121185966258200,-2.32223495600000e-06,
-			2.9706669736597,-23.5174789638136, 0.0573963894395750,-1.47839379502606,-0.00161154113318100,6.06697771200000e-06,-0.00113050292085500,2.03741552000000e-06,
-			2.86226013212772,-28.6484622342323, 0.0595722770677000,-1.63130299517520,-0.00449246683710400,4.14777569800000e-06,-0.00999999999997200,-2.00781753000000e-07
-	};
-
-	//(10 - en adelante)
-
-	double arreglo_modelo1[8][8] = {
-			1.53442982196917,4.05710350646561,0.213066698707621, -1.63327084386124,-0.00224558191191500,-2.48814731190000e-05,-0.00126012905261700,7.53341973600000e-06,
-			2.35150202829538,-4.12945578029811, 0.165523468673682,-1.81088509915497,-0.00135920966027400,2.45352702460000e-05,-0.000616293108631000,3.93835221900000e-06,
-			2.34472467863693,-1.11675241853941, 0.210821870495884,-1.62969047079476,-0.00144360246487500,6.24681005070000e-05,-0.00126903894408900,7.74483189400000e-06,
-			2.70882168732344,-9.48390849278393, 0.151170534553341,-1.79851097175591,-0.00119063645274200,1.41152490010000e-05,-0.000643492972531000,4.41025208000000e-06,
-			3.68677507961820,-10.1618350584828, 0.221804263867398,-1.47140587607795,-0.00150149002064800,1.82110924710000e-05,-0.00130103590643900,8.82463065000000e-06,
-			3.14377108047318,-19.2608443404126, 0.100694092837421,-1.62578656504809,-0.00162664919384900,1.38652121560000e-05,-0.00137643614811600,8.74985465800000e-06,
-			3.60949600144035,-22.8943998963378, 0.127747406047680,-1.45508941902630,-0.000876301785273000,1.01439603760000e-05,-0.000447157850848000,4.92972727400000e-06,
-			4.48486557598502,-28.0041595517627, 0.142661335582167,-1.57798447346382,-0.00124463604871000,9.76160487500000e-06,-0.000980979275177000,6.23905381100000e-06
-	};
-
-
-  snr=10*std::log10(snr);
-  if (mode.GetModulationClass () == WIFI_MOD_CLASS_ERP_OFDM
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_OFDM
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_HT
-      || mode.GetModulationClass () == WIFI_MOD_CLASS_VHT)
-    {
-	  double c_1;
-	  double c_2;
-	  double c_3;
-	  double c_4;
-	  double d_1;
-	  double d_2;
-	  double d_3;
-	  double d_4;
-      if (mode.GetConstellationSize () == 2)
-      {
-          if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-        	  //(3Mbps)
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[0][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //aded by juan
-
-            	  if (PER_paper_log>10)
-            	              	  {
-					  pt=&arreglo_modelo1[0][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-
-            	  double Su=1-PER_paper;
-            	  return Su;
-                }
-              //else {}
-              //}
-          else
-          {
-        	  //4.5Mbps
-              //if (txVector.GetChannelWidth ()==20)
-              //{
-            	  pt=&arreglo_modelo[1][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //added by juan
-            	  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[1][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-
-            	  double Su=1-PER_paper;
-            	  return Su;
-             //   }
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 4)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-    		  //6Mbps
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[2][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper); //added by juan
-            	  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[2][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-            	  return Su;
-              //}
-             // else {}
-          }
-          else
-          {
-        	  //9Mbps
-            //  if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[3][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-            	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-            	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[3][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-            	  return Su;
-             // }
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 16)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
-          {
-    		  //12Mbps
-             // if (txVector.GetChannelWidth ()==20)
-              //{
-            	  pt=&arreglo_modelo[4][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-			      double PER_paper_log = -10*log10(PER_paper);
-			      if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[4][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-             // }
-              //else {}
-          }
-          else
-          {
-        	  //18Mbps
-              //if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[5][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-               	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[5][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-              //}
-             // else {}
-          }
-      }
-      else if (mode.GetConstellationSize () == 64)
-      {
-    	  if (mode.GetCodeRate () == WIFI_CODE_RATE_2_3)
-          {
-    		  //24Mbps
-             // if (txVector.GetChannelWidth ()==20)
-             // {
-            	  pt=&arreglo_modelo[6][0];
-               	  c_1 = *pt;
-               	  c_2 = *(pt+1);
-               	  c_3 = *(pt+2);
-               	  c_4 =	*(pt+3);
-               	  d_1 = *(pt+4);
-               	  d_2 =	*(pt+5);
-               	  d_3 = *(pt+6);
-               	  d_4 = *(pt+7);
-
-               	  double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-               	  double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-               	  double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-               	  double PER_paper_log = -10*log10(PER_paper);
-				  if (PER_paper_log>10)
-				  {
-					  pt=&arreglo_modelo1[6][0];
-					  c_1 = *pt;
-					  c_2 = *(pt+1);
-					  c_3 = *(pt+2);
-					  c_4 =	*(pt+3);
-					  d_1 = *(pt+4);
-					  d_2 =	*(pt+5);
-					  d_3 = *(pt+6);
-					  d_4 = *(pt+7);
-
-					  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-					  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-					  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				  }
-				  double Su=1-PER_paper;
-               	  return Su;
-             // }
-             // else {}
-          }
-          else
-          {
-        	  //27Mbps
-            // if (txVector.GetChannelWidth ()==20)
-            // {
-           	  pt=&arreglo_modelo[7][0];
-              	  c_1 = *pt;
-              	  c_2 = *(pt+1);
-              	  c_3 = *(pt+2);
-              	  c_4 =	*(pt+3);
-              	  d_1 = *(pt+4);
-              	  d_2 =	*(pt+5);
-              	  d_3 = *(pt+6);
-              	  d_4 = *(pt+7);
-
-            	 double a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-            	 double b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-            	 double PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-
-            	 double PER_paper_log = -10*log10(PER_paper);
-				if (PER_paper_log>10)
-				{
-				  pt=&arreglo_modelo1[7][0];
-				  c_1 = *pt;
-				  c_2 = *(pt+1);
-				  c_3 = *(pt+2);
-				  c_4 =	*(pt+3);
-				  d_1 = *(pt+4);
-				  d_2 =	*(pt+5);
-				  d_3 = *(pt+6);
-				  d_4 = *(pt+7);
-
-				  a_R=c_1*exp(d_1*nbits)+c_2*exp(d_2*nbits);
-				  b_R=c_3*exp(d_3*nbits)+c_4*exp(d_4*nbits);
-				  PER_paper=(1-tanh(a_R-b_R*(snr)))/2;
-				}
-				 double Su=1-PER_paper;
-            	 return Su;
-            // }
-            // else {}
-          }
-      }
-    }
-  else if (mode.GetModulationClass () == WIFI_MOD_CLASS_DSSS || mode.GetModulationClass () == WIFI_MOD_CLASS_HR_DSSS)
-  {
-	  switch (mode.GetDataRate (20, 0, 1))
-      {
-	  case 1000000:
-          return DsssErrorRateModel::GetDsssDbpskSuccessRate (snr, nbits);
-      case 2000000:
-          return DsssErrorRateModel::GetDsssDqpskSuccessRate (snr, nbits);
-      case 5500000:
-          return DsssErrorRateModel::GetDsssDqpskCck5_5SuccessRate (snr, nbits);
-      case 11000000:
-          return DsssErrorRateModel::GetDsssDqpskCck11SuccessRate (snr, nbits);
-      default:
-          NS_ASSERT ("undefined DSSS/HR-DSSS datarate");
-      }
-  }
-  return 0;
 }
 
 } //namespace ns3
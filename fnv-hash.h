@@ -0,0 +1,53 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef FNV_HASH_H
+#define FNV_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * FNV-1a hash of a byte range, the checksum of the coefficient caches,
+ * the table files and the golden files, and the key of the link
+ * simulator's packet streams.  A range may be hashed in pieces by
+ * passing the hash of the previous pieces.
+ *
+ * \param data the bytes
+ * \param size the number of bytes
+ * \param hash the hash of the bytes before data
+ *
+ * \return the hash of the bytes up to data + size
+ */
+inline uint64_t
+HashBytes (const void *data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+  const unsigned char *bytes = static_cast<const unsigned char *> (data);
+  for (size_t i = 0; i < size; i++)
+    {
+      hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+  return hash;
+}
+
+} //namespace ns3
+
+#endif /* FNV_HASH_H */
@@ -0,0 +1,249 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "ofdm-convolutional-code.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+/// Generator of the first coded bit (A)
+static const uint32_t CODE_G0 = 0133;
+/// Generator of the second coded bit (B)
+static const uint32_t CODE_G1 = 0171;
+
+/**
+ * \param x a word
+ *
+ * \return the parity of its bits
+ */
+static uint32_t
+GetParity (uint32_t x)
+{
+  x ^= x >> 4;
+  x ^= x >> 2;
+  x ^= x >> 1;
+  return x & 1;
+}
+
+/**
+ * The coded bit pair (A << 1 | B) the encoder sends for every register
+ * value.
+ */
+struct OfdmCodeOutputs
+{
+  OfdmCodeOutputs ()
+  {
+    for (uint32_t reg = 0; reg < 2 * OfdmConvolutionalCode::STATES; reg++)
+      {
+        pairs[reg] = (GetParity (reg & CODE_G0) << 1) | GetParity (reg & CODE_G1);
+      }
+  }
+  uint8_t pairs[2 * OfdmConvolutionalCode::STATES]; //!< coded bit pair by register value
+};
+
+/**
+ * \return the coded bit pairs of the encoder
+ */
+static const OfdmCodeOutputs &
+GetCodeOutputs (void)
+{
+  static const OfdmCodeOutputs outputs;
+  return outputs;
+}
+
+/// Mean magnitude the soft bits of Decode are scaled to
+static const float QUANTISED_MEAN = 24;
+
+OfdmConvolutionalCode::OfdmConvolutionalCode ()
+  : m_kernels (&GetOfdmViterbiVectorKernels ())
+{
+}
+
+OfdmConvolutionalCode::OfdmConvolutionalCode (const OfdmViterbiKernels &kernels)
+  : m_kernels (&kernels)
+{
+}
+
+const char *
+OfdmConvolutionalCode::GetKernelName (void) const
+{
+  return m_kernels->name;
+}
+
+uint32_t
+OfdmConvolutionalCode::GetOutputs (uint32_t reg)
+{
+  return GetCodeOutputs ().pairs[reg & (2 * STATES - 1)];
+}
+
+void
+OfdmConvolutionalCode::Encode (const uint8_t *bits, uint32_t nbits, uint8_t *coded)
+{
+  // bit 6 of the register is the current input bit, bit 0 the oldest
+  uint32_t reg = 0;
+  for (uint32_t i = 0; i < nbits; i++)
+    {
+      reg = (reg >> 1) | (uint32_t (bits[i] & 1) << 6);
+      coded[2 * i] = GetParity (reg & CODE_G0);
+      coded[2 * i + 1] = GetParity (reg & CODE_G1);
+    }
+}
+
+const int8_t *
+OfdmConvolutionalCode::GetPattern (WifiCodeRate rate)
+{
+  // 802.11a-1999 17.3.5.6: over A0 B0 A1 B1 A2 B2, rate 3/4 sends A0 B0 A1
+  // B2; over A0 B0 A1 B1, rate 2/3 sends A0 B0 A1.  802.11n-2009 20.3.11.6:
+  // over A0 B0 .. A4 B4, rate 5/6 sends A0 B0 A1 B2 A3 B4
+  static const int8_t rate12[] = { 1, 1, -1 };
+  static const int8_t rate23[] = { 1, 1, 1, 0, -1 };
+  static const int8_t rate34[] = { 1, 1, 1, 0, 0, 1, -1 };
+  static const int8_t rate56[] = { 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, -1 };
+  switch (rate)
+    {
+    case WIFI_CODE_RATE_1_2:
+      return rate12;
+    case WIFI_CODE_RATE_2_3:
+      return rate23;
+    case WIFI_CODE_RATE_3_4:
+      return rate34;
+    case WIFI_CODE_RATE_5_6:
+      return rate56;
+    default:
+      NS_ABORT_MSG ("no puncturing pattern for code rate " << rate);
+      return rate12;
+    }
+}
+
+uint32_t
+OfdmConvolutionalCode::GetPuncturedSize (uint32_t nbits, WifiCodeRate rate)
+{
+  const int8_t *pattern = GetPattern (rate);
+  uint32_t period = 0;
+  uint32_t kept = 0;
+  for (; pattern[period] >= 0; period++)
+    {
+      kept += pattern[period];
+    }
+  NS_ABORT_MSG_IF ((2 * nbits) % period != 0, nbits << " bits are not a whole number of puncturing periods");
+  return (2 * nbits) / period * kept;
+}
+
+void
+OfdmConvolutionalCode::Puncture (const uint8_t *coded, uint32_t nbits, WifiCodeRate rate, uint8_t *punctured)
+{
+  const int8_t *pattern = GetPattern (rate);
+  for (uint32_t i = 0, j = 0, p = 0; i < 2 * nbits; i++)
+    {
+      if (pattern[p] != 0)
+        {
+          punctured[j++] = coded[i];
+        }
+      p = (pattern[p + 1] < 0) ? 0 : p + 1;
+    }
+}
+
+void
+OfdmConvolutionalCode::Depuncture (const float *soft, uint32_t nbits, WifiCodeRate rate, float *depunctured)
+{
+  const int8_t *pattern = GetPattern (rate);
+  for (uint32_t i = 0, j = 0, p = 0; i < 2 * nbits; i++)
+    {
+      depunctured[i] = (pattern[p] != 0) ? soft[j++] : 0;
+      p = (pattern[p + 1] < 0) ? 0 : p + 1;
+    }
+}
+
+void
+OfdmConvolutionalCode::Decode (const float *soft, uint32_t nbits, uint8_t *bits)
+{
+  // the decision is the same for any positive scale of the soft bits, so
+  // scale them to use the 8 bits well whatever the SNR; the few bits
+  // beyond 127 / 24 times the mean magnitude are sure enough to clip
+  double sum = 0;
+  for (uint32_t i = 0; i < 2 * nbits; i++)
+    {
+      sum += std::fabs (soft[i]);
+    }
+  float scale = (sum > 0) ? float (QUANTISED_MEAN * 2 * nbits / sum) : 0;
+  m_quantised.resize (2 * nbits);
+  for (uint32_t i = 0; i < 2 * nbits; i++)
+    {
+      float q = std::min<float> (std::max<float> (soft[i] * scale, -OFDM_VITERBI_MAX_SOFT), OFDM_VITERBI_MAX_SOFT);
+      m_quantised[i] = int16_t (std::lrint (q));
+    }
+  m_decisions.resize (nbits);
+  m_kernels->decide (&m_quantised[0], nbits, &m_decisions[0]);
+  TraceBack (nbits, bits);
+}
+
+void
+OfdmConvolutionalCode::DecodeReference (const float *soft, uint32_t nbits, uint8_t *bits)
+{
+  // the state is the last six input bits, the newest in bit 5; the
+  // branch into state s from predecessor p = ((s << 1) & 63) | x has the
+  // register (s >> 5) << 6 | p and drops the oldest bit x
+  const uint8_t *outputs = GetCodeOutputs ().pairs;
+
+  float metrics[STATES];
+  float next[STATES];
+  std::fill (metrics, metrics + STATES, -std::numeric_limits<float>::max () / 4);
+  metrics[0] = 0;
+  m_decisions.resize (nbits);
+  for (uint32_t t = 0; t < nbits; t++)
+    {
+      float a = soft[2 * t];
+      float b = soft[2 * t + 1];
+      // correlation of the soft bits with each coded bit pair
+      float branch[4] = { a + b, a - b, b - a, -a - b };
+      uint64_t decisions = 0;
+      for (uint32_t s = 0; s < STATES; s++)
+        {
+          uint32_t p = (s << 1) & (STATES - 1);
+          uint32_t reg = ((s >> 5) << 6) | p;
+          float m0 = metrics[p] + branch[outputs[reg]];
+          float m1 = metrics[p | 1] + branch[outputs[reg | 1]];
+          next[s] = (m1 > m0) ? m1 : m0;
+          decisions |= uint64_t (m1 > m0) << s;
+        }
+      m_decisions[t] = decisions;
+      // keep the metrics near 0, where floats resolve small differences
+      float best = *std::max_element (next, next + STATES);
+      for (uint32_t s = 0; s < STATES; s++)
+        {
+          metrics[s] = next[s] - best;
+        }
+    }
+
+  TraceBack (nbits, bits);
+}
+
+void
+OfdmConvolutionalCode::TraceBack (uint32_t nbits, uint8_t *bits) const
+{
+  uint32_t state = 0;
+  for (uint32_t t = nbits; t-- > 0; )
+    {
+      bits[t] = state >> 5;
+      state = ((state << 1) & (STATES - 1)) | ((m_decisions[t] >> state) & 1);
+    }
+}
+
+} //namespace ns3
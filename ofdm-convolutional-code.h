@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef OFDM_CONVOLUTIONAL_CODE_H
+#define OFDM_CONVOLUTIONAL_CODE_H
+
+#include <stdint.h>
+#include <vector>
+#include "wifi-mode.h"
+#include "ofdm-viterbi-simd.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The convolutional code of the 802.11a/g/p OFDM PHY: the rate 1/2,
+ * constraint length 7 mother code with generators 133 and 171 (octal),
+ * punctured to rate 2/3, 3/4 or (as in 802.11n) 5/6, and a soft-decision
+ * Viterbi decoder for it.
+ *
+ * Bits are one per byte (0 or 1).  Soft bits are log-likelihood ratios
+ * log (P (0) / P (1)), so a positive value favours 0 and 0 means
+ * unknown, as for punctured bits.  Messages are terminated: encoding
+ * starts in state 0 and the message ends with six 0 tail bits, so the
+ * decoder traces back from state 0.
+ *
+ * Decode quantises the soft bits to 8 bits and runs the add-compare-select
+ * recursion with 16-bit metrics on the SIMD kernels of
+ * OfdmViterbiKernels; DecodeReference keeps every metric in floating
+ * point, one state at a time, and serves as the reference for it.
+ */
+class OfdmConvolutionalCode
+{
+public:
+  /// Number of states of the trellis (2^(K-1) for K = 7)
+  static const uint32_t STATES = 64;
+
+  /**
+   * Decode with the fastest kernels of the running CPU.
+   */
+  OfdmConvolutionalCode ();
+  /**
+   * \param kernels the kernels to decode with
+   */
+  OfdmConvolutionalCode (const OfdmViterbiKernels &kernels);
+
+  /**
+   * \return the name of the kernels Decode runs
+   */
+  const char * GetKernelName (void) const;
+  /**
+   * \param reg the encoder register, the current input bit in bit 6 and
+   *        the oldest in bit 0
+   *
+   * \return the coded bit pair A << 1 | B the encoder sends for it
+   */
+  static uint32_t GetOutputs (uint32_t reg);
+
+  /**
+   * Encode a message at rate 1/2.
+   *
+   * \param bits the message
+   * \param nbits its number of bits
+   * \param coded set to the 2 * nbits coded bits, A0 B0 A1 B1 ...
+   */
+  static void Encode (const uint8_t *bits, uint32_t nbits, uint8_t *coded);
+  /**
+   * \param nbits the number of message bits, a multiple of 2 for rate 2/3,
+   *        of 3 for rate 3/4 and of 5 for rate 5/6
+   * \param rate the code rate: 1/2, 2/3, 3/4 or 5/6
+   *
+   * \return the number of coded bits left after puncturing
+   */
+  static uint32_t GetPuncturedSize (uint32_t nbits, WifiCodeRate rate);
+  /**
+   * Drop the coded bits that the code rate steals.
+   *
+   * \param coded the 2 * nbits coded bits
+   * \param nbits the number of message bits
+   * \param rate the code rate
+   * \param punctured set to the GetPuncturedSize (nbits, rate) bits kept
+   */
+  static void Puncture (const uint8_t *coded, uint32_t nbits, WifiCodeRate rate, uint8_t *punctured);
+  /**
+   * Put the soft bits of a punctured code word back in place, with 0 for
+   * the stolen bits.
+   *
+   * \param soft the GetPuncturedSize (nbits, rate) received soft bits
+   * \param nbits the number of message bits
+   * \param rate the code rate
+   * \param depunctured set to the 2 * nbits soft bits of the mother code
+   */
+  static void Depuncture (const float *soft, uint32_t nbits, WifiCodeRate rate, float *depunctured);
+  /**
+   * Decode a terminated code word by maximum likelihood.  The soft bits
+   * are scaled so that their mean magnitude maps to 24 and rounded to
+   * [-127, 127], which costs a small fraction of a dB against
+   * DecodeReference.
+   *
+   * \param soft the 2 * nbits soft bits of the mother code
+   * \param nbits the number of message bits, tail included
+   * \param bits set to the decoded message
+   */
+  void Decode (const float *soft, uint32_t nbits, uint8_t *bits);
+  /**
+   * Decode a terminated code word by maximum likelihood, with floating
+   * point path metrics and no vector code.
+   *
+   * \param soft the 2 * nbits soft bits of the mother code
+   * \param nbits the number of message bits, tail included
+   * \param bits set to the decoded message
+   */
+  void DecodeReference (const float *soft, uint32_t nbits, uint8_t *bits);
+
+private:
+  /**
+   * \param rate a code rate
+   *
+   * \return the puncturing pattern of the rate, one flag per coded bit of
+   *         a period (1 to keep the bit), ended by -1
+   */
+  static const int8_t * GetPattern (WifiCodeRate rate);
+
+  /**
+   * Trace the survivor path back from state 0.
+   *
+   * \param nbits the number of message bits
+   * \param bits set to the decoded message
+   */
+  void TraceBack (uint32_t nbits, uint8_t *bits) const;
+
+  const OfdmViterbiKernels *m_kernels; //!< the kernels of Decode
+  std::vector<int16_t> m_quantised;   //!< the quantised soft bits of Decode
+  std::vector<uint64_t> m_decisions;  //!< per trellis step, the survivor choice of every state
+};
+
+} //namespace ns3
+
+#endif /* OFDM_CONVOLUTIONAL_CODE_H */
@@ -0,0 +1,268 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include "ofdm-fec-bound.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+/// The spectra of rates 1/2, 2/3 and 3/4 (tables 3.1.1 and 3.1.2 of the
+/// NIST model) and 5/6 (table V of D. Haccoun and G. Begin, "High-Rate
+/// Punctured Convolutional Codes for Viterbi Sequential Decoding", IEEE
+/// Transactions on Communications, Vol. 32, Issue 3, pp. 315-319)
+static const OfdmFecSpectrum g_spectra[] = {
+  { 1, 10, 2, 9, { 36.0, 211.0, 1404.0, 11633.0, 77433.0, 502690.0, 3322763.0,
+                   21292910.0, 134365911.0, 0.0 } },
+  { 2, 6, 1, 10, { 3.0, 70.0, 285.0, 1276.0, 6160.0, 27128.0, 117019.0,
+                   498860.0, 2103891.0, 8784123.0 } },
+  { 3, 5, 1, 10, { 42.0, 201.0, 1492.0, 10469.0, 62935.0, 379644.0, 2253373.0,
+                   13073811.0, 75152755.0, 428005675.0 } },
+  { 5, 4, 1, 10, { 92.0, 528.0, 8694.0, 79453.0, 792114.0, 7375573.0, 67884974.0,
+                   610875423.0, 5427275376.0, 47664215639.0 } }
+};
+
+/**
+ * \param x a number
+ * \param k a small exponent
+ *
+ * \return x^k, by repeated squaring
+ */
+static inline double
+IntegerPower (double x, uint32_t k)
+{
+  double result = 1;
+  for (; k != 0; k >>= 1, x *= x)
+    {
+      if (k & 1)
+        {
+          result *= x;
+        }
+    }
+  return result;
+}
+
+/**
+ * \param s a spectrum
+ * \param p the uncoded bit error rate
+ *
+ * \return the union bound of s at p
+ */
+static inline double
+EvaluateBound (const OfdmFecSpectrum &s, double p)
+{
+  double x = 4.0 * p * (1.0 - p);
+  double d = (s.step == 2) ? x : std::sqrt (x);
+  double sum = s.weights[s.terms - 1];
+  for (uint32_t k = s.terms - 1; k-- > 0; )
+    {
+      sum = sum * d + s.weights[k];
+    }
+  return IntegerPower (d, s.freeDistance / s.step) * sum / (2.0 * s.bValue);
+}
+
+const OfdmFecSpectrum &
+OfdmFecBound::GetSpectrum (uint32_t bValue)
+{
+  for (uint32_t i = 0; i < sizeof (g_spectra) / sizeof (g_spectra[0]); i++)
+    {
+      if (g_spectra[i].bValue == bValue)
+        {
+          return g_spectra[i];
+        }
+    }
+  NS_ABORT_MSG ("no distance spectrum for b = " << bValue);
+  return g_spectra[0];
+}
+
+uint32_t
+OfdmFecBound::GetBValue (WifiCodeRate rate)
+{
+  switch (rate)
+    {
+    case WIFI_CODE_RATE_1_2:
+      return 1;
+    case WIFI_CODE_RATE_2_3:
+      return 2;
+    case WIFI_CODE_RATE_3_4:
+      return 3;
+    case WIFI_CODE_RATE_5_6:
+      return 5;
+    default:
+      return 0;
+    }
+}
+
+bool
+OfdmFecBound::GetParameters (WifiMode mode, uint16_t &constellation, uint32_t &bValue)
+{
+  switch (mode.GetModulationClass ())
+    {
+    case WIFI_MOD_CLASS_OFDM:
+    case WIFI_MOD_CLASS_ERP_OFDM:
+    case WIFI_MOD_CLASS_HT:
+    case WIFI_MOD_CLASS_VHT:
+      break;
+    default:
+      return false;
+    }
+  constellation = mode.GetConstellationSize ();
+  bValue = GetBValue (mode.GetCodeRate ());
+  return bValue != 0 && (constellation == 2 || constellation == 4 || constellation == 16
+                         || constellation == 64 || constellation == 256);
+}
+
+double
+OfdmFecBound::CalculatePe (double p, uint32_t bValue)
+{
+  return EvaluateBound (GetSpectrum (bValue), p);
+}
+
+void
+OfdmFecBound::CalculatePeBatch (const double *p, uint32_t bValue, double *pe, size_t n)
+{
+  const OfdmFecSpectrum &s = GetSpectrum (bValue);
+  for (size_t i = 0; i < n; i++)
+    {
+      pe[i] = EvaluateBound (s, p[i]);
+    }
+}
+
+double
+OfdmFecBound::CalculatePeReference (double p, uint32_t bValue)
+{
+  double D = std::sqrt (4.0 * p * (1.0 - p));
+  double pe = 1.0;
+  if (bValue == 1)
+    {
+      //code rate 1/2, use table 3.1.1
+      pe = 0.5 * (36.0 * std::pow (D, 10)
+                  + 211.0 * std::pow (D, 12)
+                  + 1404.0 * std::pow (D, 14)
+                  + 11633.0 * std::pow (D, 16)
+                  + 77433.0 * std::pow (D, 18)
+                  + 502690.0 * std::pow (D, 20)
+                  + 3322763.0 * std::pow (D, 22)
+                  + 21292910.0 * std::pow (D, 24)
+                  + 134365911.0 * std::pow (D, 26));
+    }
+  else if (bValue == 2)
+    {
+      //code rate 2/3, use table 3.1.2
+      pe = 1.0 / (2.0 * bValue) *
+        (3.0 * std::pow (D, 6)
+         + 70.0 * std::pow (D, 7)
+         + 285.0 * std::pow (D, 8)
+         + 1276.0 * std::pow (D, 9)
+         + 6160.0 * std::pow (D, 10)
+         + 27128.0 * std::pow (D, 11)
+         + 117019.0 * std::pow (D, 12)
+         + 498860.0 * std::pow (D, 13)
+         + 2103891.0 * std::pow (D, 14)
+         + 8784123.0 * std::pow (D, 15));
+    }
+  else if (bValue == 3)
+    {
+      //code rate 3/4, use table 3.1.2
+      pe = 1.0 / (2.0 * bValue) *
+        (42.0 * std::pow (D, 5)
+         + 201.0 * std::pow (D, 6)
+         + 1492.0 * std::pow (D, 7)
+         + 10469.0 * std::pow (D, 8)
+         + 62935.0 * std::pow (D, 9)
+         + 379644.0 * std::pow (D, 10)
+         + 2253373.0 * std::pow (D, 11)
+         + 13073811.0 * std::pow (D, 12)
+         + 75152755.0 * std::pow (D, 13)
+         + 428005675.0 * std::pow (D, 14));
+    }
+  else if (bValue == 5)
+    {
+      //code rate 5/6, use table V of Haccoun and Begin
+      pe = 1.0 / (2.0 * bValue) *
+        (92.0 * std::pow (D, 4.0)
+         + 528.0 * std::pow (D, 5.0)
+         + 8694.0 * std::pow (D, 6.0)
+         + 79453.0 * std::pow (D, 7.0)
+         + 792114.0 * std::pow (D, 8.0)
+         + 7375573.0 * std::pow (D, 9.0)
+         + 67884974.0 * std::pow (D, 10.0)
+         + 610875423.0 * std::pow (D, 11.0)
+         + 5427275376.0 * std::pow (D, 12.0)
+         + 47664215639.0 * std::pow (D, 13.0));
+    }
+  else
+    {
+      NS_ABORT_MSG ("no distance spectrum for b = " << bValue);
+    }
+  return pe;
+}
+
+double
+OfdmFecBound::GetBer (uint16_t constellation, double snr)
+{
+  switch (constellation)
+    {
+    case 2:
+      return 0.5 * std::erfc (std::sqrt (snr));
+    case 4:
+      return 0.5 * std::erfc (std::sqrt (snr / 2.0));
+    case 16:
+      return 0.75 * 0.5 * std::erfc (std::sqrt (snr / (5.0 * 2.0)));
+    case 64:
+      return 7.0 / 12.0 * 0.5 * std::erfc (std::sqrt (snr / (21.0 * 2.0)));
+    case 256:
+      return 15.0 / 32.0 * 0.5 * std::erfc (std::sqrt (snr / (85.0 * 2.0)));
+    default:
+      NS_ABORT_MSG ("no bit error rate for constellation size " << constellation);
+      return 0.5;
+    }
+}
+
+double
+OfdmFecBound::GetChunkSuccessRate (uint16_t constellation, uint32_t bValue, double snr, uint32_t nbits)
+{
+  double ber = GetBer (constellation, snr);
+  if (ber == 0.0)
+    {
+      return 1.0;
+    }
+  double pe = std::min (CalculatePe (ber, bValue), 1.0);
+  return std::pow (1 - pe, static_cast<double> (nbits));
+}
+
+void
+OfdmFecBound::GetChunkSuccessRateBatch (uint16_t constellation, uint32_t bValue,
+                                        const double *snr, const uint32_t *nbits,
+                                        double *successRate, size_t n)
+{
+  const OfdmFecSpectrum &s = GetSpectrum (bValue);
+  for (size_t i = 0; i < n; i++)
+    {
+      double ber = GetBer (constellation, snr[i]);
+      if (ber == 0.0)
+        {
+          successRate[i] = 1.0;
+          continue;
+        }
+      double pe = std::min (EvaluateBound (s, ber), 1.0);
+      successRate[i] = std::pow (1 - pe, static_cast<double> (nbits[i]));
+    }
+}
+
+} //namespace ns3
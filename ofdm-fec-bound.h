@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef OFDM_FEC_BOUND_H
+#define OFDM_FEC_BOUND_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "wifi-mode.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The distance spectrum of the 802.11 convolutional code at one code
+ * rate: the information weights c_d of the union bound
+ * Pe <= 1 / (2 b) * sum_d c_d D^d on the bit error rate after hard
+ * decision Viterbi decoding, D = sqrt (4 p (1 - p)) for an uncoded bit
+ * error rate p.
+ */
+struct OfdmFecSpectrum
+{
+  uint32_t bValue;       //!< the puncturing period b of the rate: 1, 2, 3 or 5
+  uint32_t freeDistance; //!< the free distance, the smallest d of the bound
+  uint32_t step;         //!< the spacing of the distances (2 where the odd ones are empty)
+  uint32_t terms;        //!< the number of terms of the bound
+  double weights[10];    //!< c_d for d = freeDistance, freeDistance + step, ...
+};
+
+/**
+ * \ingroup wifi
+ *
+ * The analytic FEC model of the NIST error rate model, which the tanh
+ * models inherited as CalculatePe and GetFec*Ber: the uncoded bit error
+ * rate of the constellation over AWGN, a union bound on the bit error
+ * rate after decoding, and the chunk success rate (1 - Pe)^nbits.
+ *
+ * The bounds are evaluated in Horner form over D^step from the tables of
+ * OfdmFecSpectrum, with D^freeDistance by repeated multiplication: one
+ * square root (none at rate 1/2, whose distances are all even) and about
+ * a dozen multiply-adds, instead of one std::pow per term.  The results
+ * stay within 16 DBL_EPSILON, relative, of the per-term form,
+ * CalculatePeReference, which is kept to check and time them against.
+ */
+class OfdmFecBound
+{
+public:
+  /**
+   * \param bValue the puncturing period: 1 (rate 1/2), 2 (2/3), 3 (3/4)
+   *        or 5 (5/6)
+   *
+   * \return the spectrum of the rate; the program aborts for other values
+   */
+  static const OfdmFecSpectrum & GetSpectrum (uint32_t bValue);
+  /**
+   * \param rate a code rate: 1/2, 2/3, 3/4 or 5/6
+   *
+   * \return its puncturing period, or 0 for other rates
+   */
+  static uint32_t GetBValue (WifiCodeRate rate);
+  /**
+   * \param mode an OFDM, ERP-OFDM, HT or VHT mode
+   * \param constellation set to its constellation size
+   * \param bValue set to the puncturing period of its code rate
+   *
+   * \return false if the model does not cover the mode
+   */
+  static bool GetParameters (WifiMode mode, uint16_t &constellation, uint32_t &bValue);
+
+  /**
+   * \param p the uncoded bit error rate
+   * \param bValue the puncturing period of the code rate
+   *
+   * \return the union bound on the decoded bit error rate (not clamped to 1)
+   */
+  static double CalculatePe (double p, uint32_t bValue);
+  /**
+   * Evaluate CalculatePe for n bit error rates.
+   *
+   * \param p the uncoded bit error rates
+   * \param bValue the puncturing period of the code rate
+   * \param pe set to the bounds
+   * \param n the number of bit error rates
+   */
+  static void CalculatePeBatch (const double *p, uint32_t bValue, double *pe, size_t n);
+  /**
+   * \param p the uncoded bit error rate
+   * \param bValue the puncturing period of the code rate
+   *
+   * \return CalculatePe as the models computed it before, with one
+   *         std::pow per term
+   */
+  static double CalculatePeReference (double p, uint32_t bValue);
+
+  /**
+   * \param constellation 2 (BPSK), 4 (QPSK), 16, 64 or 256 (QAM)
+   * \param snr the SNR (ratio, not dB)
+   *
+   * \return the uncoded bit error rate
+   */
+  static double GetBer (uint16_t constellation, double snr);
+  /**
+   * \param constellation the constellation size
+   * \param bValue the puncturing period of the code rate
+   * \param snr the SNR (ratio, not dB)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the success rate of the chunk, (1 - min (Pe, 1))^nbits, or 1
+   *         if the uncoded bit error rate is 0
+   */
+  static double GetChunkSuccessRate (uint16_t constellation, uint32_t bValue, double snr, uint32_t nbits);
+  /**
+   * Evaluate GetChunkSuccessRate for n chunks.
+   *
+   * \param constellation the constellation size of all chunks
+   * \param bValue the puncturing period of the code rate of all chunks
+   * \param snr the SNR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk
+   * \param successRate set to the success rate of each chunk
+   * \param n the number of chunks
+   */
+  static void GetChunkSuccessRateBatch (uint16_t constellation, uint32_t bValue,
+                                        const double *snr, const uint32_t *nbits,
+                                        double *successRate, size_t n);
+};
+
+} //namespace ns3
+
+#endif /* OFDM_FEC_BOUND_H */
@@ -0,0 +1,348 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+// Monte Carlo link-level PER measurement of the 802.11a/g/p OFDM modes
+// over AWGN (see OfdmLinkSimulator), writing samples tanh-per-fit can fit
+// new coefficient banks to.
+//
+// Place this file in the ns-3 "scratch/" directory and run e.g.
+//   ./waf --run "ofdm-link-sim --sizes=100,1500 --output=per.csv"
+//   ./waf --run "tanh-per-fit --samples=per.csv --output=my-fit.csv"
+//
+// Every (mode, size, SNR) point is simulated until it has --errors packet
+// errors or --max-packets packets, in batches of --batch packets spread
+// over --threads threads that steal whole points and batches from each
+// other.  Packet n of a point draws its payload and noise from stream n
+// of a counter-based generator keyed by --seed and the point, so the
+// samples depend on the seed only, never on the number of threads.
+//
+// The samples are written as CSV lines "mode,nbits,snr_db,per,packets",
+// one per point, to --output or stdout; the SNR is Es/N0 per subcarrier,
+// as the models take it.  The fitter ignores the points with PER 0 or 1,
+// so the SNR range may be generous, but every point above the waterfall
+// costs --max-packets packets.
+//
+// "--bench-viterbi=N" instead times the Viterbi decoder on one core: N
+// noisy code words of 1500 bytes per code rate (1/2, 2/3, 3/4 and 5/6),
+// decoded with DecodeReference and with every SIMD kernel the CPU
+// supports, reported as CSV lines "kernel,rate,mbit_per_s,bit_errors,
+// differences" (decoded Mbit/s, message bits in error, and message bits
+// that differ from DecodeReference).  The kernels must agree with each
+// other bit for bit; the program exits with status 2 if they do not.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/ofdm-link-simulator.h"
+#include "ns3/ofdm-convolutional-code.h"
+#include "ns3/ofdm-viterbi-simd.h"
+
+using namespace ns3;
+
+/**
+ * \return the OFDM and ERP-OFDM modes, by unique name
+ */
+static std::map<std::string, WifiMode>
+GetOfdmModes (void)
+{
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (), WifiPhy::GetOfdmRate12Mbps (),
+    WifiPhy::GetOfdmRate18Mbps (), WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate3MbpsBW10MHz (), WifiPhy::GetOfdmRate4_5MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW10MHz (), WifiPhy::GetOfdmRate9MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW10MHz (), WifiPhy::GetOfdmRate18MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate24MbpsBW10MHz (), WifiPhy::GetOfdmRate27MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate1_5MbpsBW5MHz (), WifiPhy::GetOfdmRate2_25MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate3MbpsBW5MHz (), WifiPhy::GetOfdmRate4_5MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW5MHz (), WifiPhy::GetOfdmRate9MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW5MHz (), WifiPhy::GetOfdmRate13_5MbpsBW5MHz (),
+    WifiPhy::GetErpOfdmRate6Mbps (), WifiPhy::GetErpOfdmRate9Mbps (),
+    WifiPhy::GetErpOfdmRate12Mbps (), WifiPhy::GetErpOfdmRate18Mbps (),
+    WifiPhy::GetErpOfdmRate24Mbps (), WifiPhy::GetErpOfdmRate36Mbps (),
+    WifiPhy::GetErpOfdmRate48Mbps (), WifiPhy::GetErpOfdmRate54Mbps ()
+  };
+  std::map<std::string, WifiMode> byName;
+  for (uint32_t i = 0; i < sizeof (modes) / sizeof (modes[0]); i++)
+    {
+      byName[modes[i].GetUniqueName ()] = modes[i];
+    }
+  return byName;
+}
+
+/**
+ * \param list a comma-separated list
+ *
+ * \return its items
+ */
+static std::vector<std::string>
+SplitList (const std::string &list)
+{
+  std::vector<std::string> items;
+  std::istringstream is (list);
+  std::string item;
+  while (std::getline (is, item, ','))
+    {
+      if (item != "")
+        {
+          items.push_back (item);
+        }
+    }
+  return items;
+}
+
+/**
+ * Time the Viterbi decoder with every kernel.
+ *
+ * \param frames the number of code words per code rate
+ *
+ * \return false if the kernels decoded differently
+ */
+static bool
+BenchViterbi (uint32_t frames)
+{
+  // 1500 bytes and the tail, rounded up to whole periods of every rate
+  const uint32_t nbits = 12030;
+  // noise of BPSK symbols of energy 1; its soft bits are 2 y / sigma^2
+  const double sigma = 0.6;
+  WifiCodeRate rates[] = { WIFI_CODE_RATE_1_2, WIFI_CODE_RATE_2_3, WIFI_CODE_RATE_3_4, WIFI_CODE_RATE_5_6 };
+  const char *rateNames[] = { "1/2", "2/3", "3/4", "5/6" };
+  std::vector<const OfdmViterbiKernels *> kernels (1, static_cast<const OfdmViterbiKernels *> (0));
+  const char *names[] = { "scalar", "ssse3", "avx2" };
+  for (uint32_t i = 0; i < sizeof (names) / sizeof (names[0]); i++)
+    {
+      if (GetOfdmViterbiKernels (names[i]) != 0)
+        {
+          kernels.push_back (GetOfdmViterbiKernels (names[i]));
+        }
+    }
+
+  bool agree = true;
+  std::cout << "kernel,rate,mbit_per_s,bit_errors,differences\n";
+  for (uint32_t r = 0; r < sizeof (rates) / sizeof (rates[0]); r++)
+    {
+      // the code words of the rate, depunctured, and what the reference made of them
+      std::vector<std::vector<uint8_t> > messages (frames, std::vector<uint8_t> (nbits, 0));
+      std::vector<std::vector<float> > words (frames, std::vector<float> (2 * nbits));
+      std::vector<std::vector<uint8_t> > reference (frames, std::vector<uint8_t> (nbits));
+      std::vector<uint8_t> coded (2 * nbits);
+      std::vector<uint8_t> sent (OfdmConvolutionalCode::GetPuncturedSize (nbits, rates[r]));
+      std::vector<float> soft (sent.size ());
+      for (uint32_t f = 0; f < frames; f++)
+        {
+          OfdmLinkRng rng (r, f);
+          for (uint32_t i = 0; i + 6 < nbits; i++)
+            {
+              messages[f][i] = rng.GetInteger () & 1;
+            }
+          OfdmConvolutionalCode::Encode (&messages[f][0], nbits, &coded[0]);
+          OfdmConvolutionalCode::Puncture (&coded[0], nbits, rates[r], &sent[0]);
+          for (uint32_t i = 0; i < sent.size (); i += 2)
+            {
+              double x;
+              double y;
+              rng.GetNormals (x, y);
+              soft[i] = float (2 * ((sent[i] ? -1 : 1) + sigma * x) / (sigma * sigma));
+              if (i + 1 < sent.size ())
+                {
+                  soft[i + 1] = float (2 * ((sent[i + 1] ? -1 : 1) + sigma * y) / (sigma * sigma));
+                }
+            }
+          OfdmConvolutionalCode::Depuncture (&soft[0], nbits, rates[r], &words[f][0]);
+        }
+
+      std::vector<uint8_t> first;
+      for (uint32_t k = 0; k < kernels.size (); k++)
+        {
+          OfdmConvolutionalCode code (kernels[k] != 0 ? *kernels[k] : GetOfdmViterbiVectorKernels ());
+          std::vector<uint8_t> decoded (nbits);
+          std::vector<uint8_t> all;
+          uint64_t errors = 0;
+          uint64_t differences = 0;
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+          for (uint32_t f = 0; f < frames; f++)
+            {
+              uint8_t *bits = (k == 0) ? &reference[f][0] : &decoded[0];
+              if (k == 0)
+                {
+                  code.DecodeReference (&words[f][0], nbits, bits);
+                }
+              else
+                {
+                  code.Decode (&words[f][0], nbits, bits);
+                }
+              for (uint32_t i = 0; i < nbits; i++)
+                {
+                  errors += bits[i] != messages[f][i];
+                  differences += bits[i] != reference[f][i];
+                }
+              if (k > 0)
+                {
+                  all.insert (all.end (), decoded.begin (), decoded.end ());
+                }
+            }
+          double seconds = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+          if (k == 1)
+            {
+              first.swap (all);
+            }
+          else if (k > 1 && all != first)
+            {
+              std::cerr << kernels[k]->name << " decodes differently from " << kernels[1]->name
+                        << " at rate " << rateNames[r] << std::endl;
+              agree = false;
+            }
+          std::cout << (k == 0 ? "reference" : kernels[k]->name) << "," << rateNames[r] << ","
+                    << double (frames) * nbits / std::max (seconds, 1e-9) / 1e6 << ","
+                    << errors << "," << differences << "\n";
+        }
+    }
+  return agree;
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string modeList = "OfdmRate6Mbps,OfdmRate9Mbps,OfdmRate12Mbps,OfdmRate18Mbps,"
+    "OfdmRate24Mbps,OfdmRate36Mbps,OfdmRate48Mbps,OfdmRate54Mbps";
+  std::string sizeList = "50,100,500,1000,1500";
+  double snrFrom = -5;
+  double snrTo = 30;
+  double snrStep = 0.5;
+  uint64_t errors = 100;
+  uint64_t maxPackets = 10000;
+  uint32_t batch = 50;
+  uint32_t threads = std::max<uint32_t> (std::thread::hardware_concurrency (), 1);
+  uint64_t seed = 1;
+  std::string output;
+  uint32_t benchViterbi = 0;
+
+  CommandLine cmd;
+  cmd.AddValue ("modes", "Comma-separated unique names of the OFDM modes to simulate", modeList);
+  cmd.AddValue ("sizes", "Comma-separated PSDU sizes (bytes)", sizeList);
+  cmd.AddValue ("snr-from", "Lowest SNR (dB)", snrFrom);
+  cmd.AddValue ("snr-to", "Highest SNR (dB)", snrTo);
+  cmd.AddValue ("snr-step", "SNR grid spacing (dB)", snrStep);
+  cmd.AddValue ("errors", "Packet errors that complete a point (0: always --max-packets)", errors);
+  cmd.AddValue ("max-packets", "Largest number of packets of a point", maxPackets);
+  cmd.AddValue ("batch", "Packets a thread simulates at a time", batch);
+  cmd.AddValue ("threads", "Number of threads", threads);
+  cmd.AddValue ("seed", "Seed of the packet streams", seed);
+  cmd.AddValue ("output", "Write the samples to this CSV file instead of stdout", output);
+  cmd.AddValue ("bench-viterbi", "Time the Viterbi kernels on this many code words per rate and exit", benchViterbi);
+  cmd.Parse (argc, argv);
+  threads = std::max<uint32_t> (threads, 1);
+
+  if (benchViterbi != 0)
+    {
+      return BenchViterbi (benchViterbi) ? 0 : 2;
+    }
+
+  std::map<std::string, WifiMode> ofdmModes = GetOfdmModes ();
+  std::vector<WifiMode> modes;
+  std::vector<std::string> names = SplitList (modeList);
+  for (uint32_t i = 0; i < names.size (); i++)
+    {
+      std::map<std::string, WifiMode>::const_iterator it = ofdmModes.find (names[i]);
+      if (it == ofdmModes.end ())
+        {
+          std::cerr << names[i] << " is not an OFDM or ERP-OFDM mode" << std::endl;
+          return 1;
+        }
+      modes.push_back (it->second);
+    }
+  std::vector<uint32_t> sizes;
+  std::vector<std::string> sizeItems = SplitList (sizeList);
+  for (uint32_t i = 0; i < sizeItems.size (); i++)
+    {
+      sizes.push_back (8 * strtoul (sizeItems[i].c_str (), 0, 10));
+    }
+  if (modes.empty () || sizes.empty () || !(snrStep > 0) || snrTo < snrFrom
+      || maxPackets == 0 || batch == 0)
+    {
+      std::cerr << "usage: ofdm-link-sim [--modes=M,..] [--sizes=BYTES,..] [--snr-from=DB]"
+                << " [--snr-to=DB] [--snr-step=DB] [--errors=N] [--max-packets=N] [--output=FILE]"
+                << std::endl;
+      return 1;
+    }
+
+  std::vector<OfdmLinkPoint> points;
+  uint32_t steps = static_cast<uint32_t> (std::floor ((snrTo - snrFrom) / snrStep + 1e-9));
+  for (uint32_t i = 0; i < modes.size (); i++)
+    {
+      for (uint32_t j = 0; j < sizes.size (); j++)
+        {
+          for (uint32_t k = 0; k <= steps; k++)
+            {
+              OfdmLinkPoint point;
+              point.mode = modes[i];
+              point.nbits = sizes[j];
+              point.snrDb = snrFrom + k * snrStep;
+              point.packets = 0;
+              point.errors = 0;
+              points.push_back (point);
+            }
+        }
+    }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  OfdmLinkSimulator::Run (points, seed, errors, maxPackets, batch, threads);
+  double seconds = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+
+  std::ofstream file;
+  if (output != "")
+    {
+      file.open (output.c_str ());
+      if (!file)
+        {
+          std::cerr << "could not write " << output << std::endl;
+          return 1;
+        }
+    }
+  std::ostream &os = (output != "") ? file : std::cout;
+  uint64_t packets = 0;
+  os << "mode,nbits,snr_db,per,packets\n" << std::setprecision (17);
+  for (uint32_t i = 0; i < points.size (); i++)
+    {
+      const OfdmLinkPoint &p = points[i];
+      os << p.mode.GetUniqueName () << "," << p.nbits << "," << p.snrDb << ","
+         << double (p.errors) / p.packets << "," << p.packets << "\n";
+      packets += p.packets;
+    }
+  os.flush ();
+  if (!os)
+    {
+      std::cerr << "could not write the samples" << std::endl;
+      return 1;
+    }
+  std::cerr << points.size () << " points, " << packets << " packets simulated in "
+            << seconds << " s on " << threads << " threads ("
+            << packets / std::max (seconds, 1e-9) << " packets/s)" << std::endl;
+  return 0;
+}
@@ -0,0 +1,520 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <string.h>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "ofdm-link-simulator.h"
+#include "fnv-hash.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+/// Philox multiplier of the first counter word
+static const uint32_t PHILOX_M0 = 0xD2511F53;
+/// Philox multiplier of the third counter word
+static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+/// Philox key increment of the first key word (golden ratio)
+static const uint32_t PHILOX_W0 = 0x9E3779B9;
+/// Philox key increment of the second key word (sqrt (3) - 1)
+static const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+/// Number of data subcarriers of an OFDM symbol
+static const uint32_t OFDM_DATA_SUBCARRIERS = 48;
+/// Number of tail bits that return the encoder to state 0
+static const uint32_t OFDM_TAIL_BITS = 6;
+
+OfdmLinkRng::OfdmLinkRng (uint64_t key, uint64_t stream)
+  : m_next (4)
+{
+  m_key[0] = uint32_t (key);
+  m_key[1] = uint32_t (key >> 32);
+  m_counter[0] = 0;
+  m_counter[1] = 0;
+  m_counter[2] = uint32_t (stream);
+  m_counter[3] = uint32_t (stream >> 32);
+}
+
+void
+OfdmLinkRng::Refill (void)
+{
+  uint32_t c[4] = { m_counter[0], m_counter[1], m_counter[2], m_counter[3] };
+  uint32_t k0 = m_key[0];
+  uint32_t k1 = m_key[1];
+  for (uint32_t round = 0; round < 10; round++)
+    {
+      if (round > 0)
+        {
+          k0 += PHILOX_W0;
+          k1 += PHILOX_W1;
+        }
+      uint64_t p0 = uint64_t (PHILOX_M0) * c[0];
+      uint64_t p1 = uint64_t (PHILOX_M1) * c[2];
+      uint32_t next[4] = { uint32_t (p1 >> 32) ^ c[1] ^ k0, uint32_t (p1),
+                           uint32_t (p0 >> 32) ^ c[3] ^ k1, uint32_t (p0) };
+      memcpy (c, next, sizeof (c));
+    }
+  memcpy (m_output, c, sizeof (c));
+  if (++m_counter[0] == 0)
+    {
+      m_counter[1]++;
+    }
+  m_next = 0;
+}
+
+uint32_t
+OfdmLinkRng::GetInteger (void)
+{
+  if (m_next == 4)
+    {
+      Refill ();
+    }
+  return m_output[m_next++];
+}
+
+double
+OfdmLinkRng::GetUniform (void)
+{
+  double high = GetInteger () >> 5;
+  double low = GetInteger () >> 6;
+  return (high * 67108864.0 + low + 0.5) / 9007199254740992.0;
+}
+
+void
+OfdmLinkRng::GetNormals (double &x, double &y)
+{
+  double r = std::sqrt (-2 * std::log (GetUniform ()));
+  double phase = 2 * M_PI * GetUniform ();
+  x = r * std::cos (phase);
+  y = r * std::sin (phase);
+}
+
+/**
+ * \param label the bits of one axis, the first in the most significant
+ *        place
+ *
+ * \return the amplitude level (0 for the most negative) the 802.11a Gray
+ *         mapping puts them on
+ */
+static uint32_t
+GetGrayLevel (uint32_t label)
+{
+  uint32_t level = label;
+  for (uint32_t shift = label >> 1; shift != 0; shift >>= 1)
+    {
+      level ^= shift;
+    }
+  return level;
+}
+
+/**
+ * Compute the max-log soft bits of one axis.
+ *
+ * \param y the received amplitude
+ * \param amplitudes the amplitude of each label
+ * \param bits the number of bits of the axis
+ * \param n0 the noise power of the subcarrier
+ * \param soft set to the soft bits, the first bit first
+ */
+static void
+Demap (double y, const std::vector<double> &amplitudes, uint32_t bits, double n0, float *soft)
+{
+  for (uint32_t q = 0; q < bits; q++)
+    {
+      uint32_t mask = 1u << (bits - 1 - q);
+      double d0 = HUGE_VAL;
+      double d1 = HUGE_VAL;
+      for (uint32_t label = 0; label < amplitudes.size (); label++)
+        {
+          double d = (y - amplitudes[label]) * (y - amplitudes[label]);
+          double &closest = (label & mask) ? d1 : d0;
+          closest = std::min (closest, d);
+        }
+      soft[q] = float ((d1 - d0) / n0);
+    }
+}
+
+OfdmLinkSimulator::OfdmLinkSimulator (WifiMode mode)
+  : m_mode (mode),
+    m_rate (mode.GetCodeRate ())
+{
+  NS_ABORT_MSG_IF (mode.GetModulationClass () != WIFI_MOD_CLASS_OFDM
+                   && mode.GetModulationClass () != WIFI_MOD_CLASS_ERP_OFDM,
+                   mode.GetUniqueName () << " is not an 802.11a/g/p OFDM mode");
+  uint32_t constellation = mode.GetConstellationSize ();
+  m_bitsPerSubcarrier = 0;
+  while ((1u << m_bitsPerSubcarrier) < constellation)
+    {
+      m_bitsPerSubcarrier++;
+    }
+  m_codedBitsPerSymbol = OFDM_DATA_SUBCARRIERS * m_bitsPerSubcarrier;
+  switch (m_rate)
+    {
+    case WIFI_CODE_RATE_1_2:
+      m_dataBitsPerSymbol = m_codedBitsPerSymbol / 2;
+      break;
+    case WIFI_CODE_RATE_2_3:
+      m_dataBitsPerSymbol = m_codedBitsPerSymbol * 2 / 3;
+      break;
+    case WIFI_CODE_RATE_3_4:
+      m_dataBitsPerSymbol = m_codedBitsPerSymbol * 3 / 4;
+      break;
+    default:
+      NS_ABORT_MSG ("unsupported code rate " << m_rate << " of " << mode.GetUniqueName ());
+    }
+
+  // 802.11a-1999 17.3.5.6: the first permutation spreads adjacent coded
+  // bits over non-adjacent subcarriers, the second alternates them
+  // between the more and less significant bits of the constellation
+  uint32_t s = std::max<uint32_t> (m_bitsPerSubcarrier / 2, 1);
+  m_interleaver.resize (m_codedBitsPerSymbol);
+  for (uint32_t k = 0; k < m_codedBitsPerSymbol; k++)
+    {
+      uint32_t i = (m_codedBitsPerSymbol / 16) * (k % 16) + k / 16;
+      m_interleaver[k] = s * (i / s) + (i + m_codedBitsPerSymbol - 16 * i / m_codedBitsPerSymbol) % s;
+    }
+
+  // BPSK uses the in-phase axis only; the other constellations carry
+  // half the bits on each axis with unit average symbol energy
+  uint32_t axisBits = (m_bitsPerSubcarrier == 1) ? 1 : m_bitsPerSubcarrier / 2;
+  uint32_t levels = 1u << axisBits;
+  double scale = (m_bitsPerSubcarrier == 1) ? 1 : 1 / std::sqrt (2 * (levels * levels - 1) / 3.0);
+  m_amplitudes.resize (levels);
+  for (uint32_t label = 0; label < levels; label++)
+    {
+      m_amplitudes[label] = (2.0 * GetGrayLevel (label) - (levels - 1)) * scale;
+    }
+}
+
+WifiMode
+OfdmLinkSimulator::GetMode (void) const
+{
+  return m_mode;
+}
+
+uint32_t
+OfdmLinkSimulator::GetDataBitsPerSymbol (void) const
+{
+  return m_dataBitsPerSymbol;
+}
+
+bool
+OfdmLinkSimulator::SimulatePacket (uint32_t nbits, double snr, OfdmLinkRng &rng)
+{
+  uint32_t symbols = (nbits + OFDM_TAIL_BITS + m_dataBitsPerSymbol - 1) / m_dataBitsPerSymbol;
+  uint32_t messageBits = symbols * m_dataBitsPerSymbol;
+  uint32_t sentBits = symbols * m_codedBitsPerSymbol;
+  m_bits.assign (messageBits, 0);
+  for (uint32_t i = 0; i < nbits; i += 32)
+    {
+      uint32_t word = rng.GetInteger ();
+      for (uint32_t j = i; j < std::min (i + 32, nbits); j++, word >>= 1)
+        {
+          m_bits[j] = word & 1;
+        }
+    }
+
+  m_coded.resize (2 * messageBits);
+  m_sent.resize (sentBits);
+  OfdmConvolutionalCode::Encode (&m_bits[0], messageBits, &m_coded[0]);
+  OfdmConvolutionalCode::Puncture (&m_coded[0], messageBits, m_rate, &m_sent[0]);
+
+  // per OFDM symbol: interleave, map each subcarrier, add noise and
+  // demap; the soft bits are written straight back to their
+  // deinterleaved places
+  uint32_t axisBits = (m_bitsPerSubcarrier == 1) ? 1 : m_bitsPerSubcarrier / 2;
+  double n0 = 1 / snr;
+  double sigma = std::sqrt (n0 / 2);
+  m_channel.resize (m_codedBitsPerSymbol);
+  m_received.resize (m_codedBitsPerSymbol);
+  m_soft.resize (sentBits);
+  for (uint32_t symbol = 0; symbol < symbols; symbol++)
+    {
+      const uint8_t *sent = &m_sent[symbol * m_codedBitsPerSymbol];
+      for (uint32_t k = 0; k < m_codedBitsPerSymbol; k++)
+        {
+          m_channel[m_interleaver[k]] = sent[k];
+        }
+      for (uint32_t c = 0; c < OFDM_DATA_SUBCARRIERS; c++)
+        {
+          const uint8_t *bits = &m_channel[c * m_bitsPerSubcarrier];
+          uint32_t labelI = 0;
+          uint32_t labelQ = 0;
+          for (uint32_t q = 0; q < axisBits; q++)
+            {
+              labelI = (labelI << 1) | bits[q];
+              if (m_bitsPerSubcarrier > 1)
+                {
+                  labelQ = (labelQ << 1) | bits[axisBits + q];
+                }
+            }
+          double noiseI;
+          double noiseQ;
+          rng.GetNormals (noiseI, noiseQ);
+          float *soft = &m_received[c * m_bitsPerSubcarrier];
+          Demap (m_amplitudes[labelI] + sigma * noiseI, m_amplitudes, axisBits, n0, soft);
+          if (m_bitsPerSubcarrier > 1)
+            {
+              Demap (m_amplitudes[labelQ] + sigma * noiseQ, m_amplitudes, axisBits, n0, soft + axisBits);
+            }
+        }
+      float *soft = &m_soft[symbol * m_codedBitsPerSymbol];
+      for (uint32_t k = 0; k < m_codedBitsPerSymbol; k++)
+        {
+          soft[k] = m_received[m_interleaver[k]];
+        }
+    }
+
+  m_depunctured.resize (2 * messageBits);
+  m_decoded.resize (messageBits);
+  OfdmConvolutionalCode::Depuncture (&m_soft[0], messageBits, m_rate, &m_depunctured[0]);
+  m_code.Decode (&m_depunctured[0], messageBits, &m_decoded[0]);
+  return memcmp (&m_bits[0], &m_decoded[0], nbits) != 0;
+}
+
+uint64_t
+OfdmLinkSimulator::GetKey (uint64_t seed, const OfdmLinkPoint &point)
+{
+  // FNV-1a over the seed, the mode name, the size and the SNR
+  std::string name = point.mode.GetUniqueName ();
+  uint64_t snrBits;
+  memcpy (&snrBits, &point.snrDb, sizeof (snrBits));
+  std::vector<uint8_t> bytes (name.begin (), name.end ());
+  for (uint32_t i = 0; i < 8; i++)
+    {
+      bytes.push_back (uint8_t (seed >> (8 * i)));
+      bytes.push_back (uint8_t (snrBits >> (8 * i)));
+    }
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      bytes.push_back (uint8_t (point.nbits >> (8 * i)));
+    }
+  return HashBytes (&bytes[0], bytes.size ());
+}
+
+/**
+ * The progress of one point during OfdmLinkSimulator::Run.
+ */
+struct OfdmLinkPointState
+{
+  uint64_t key;                   //!< key of the packet streams
+  uint32_t batches;               //!< largest number of batches
+  uint32_t claimed;               //!< batches handed out so far
+  uint32_t decided;               //!< length of the finished prefix of batches
+  bool done;                      //!< whether the point is complete
+  std::vector<int64_t> errors;    //!< errors of each batch, -1 while running
+};
+
+/**
+ * The batches of all points and the threads' shares of them.
+ */
+struct OfdmLinkSchedule
+{
+  std::mutex mutex;                           //!< guards everything below
+  std::vector<OfdmLinkPointState> states;     //!< by point
+  std::vector<std::deque<uint32_t> > shares;  //!< points not started, by thread
+  std::vector<OfdmLinkPoint> *points;         //!< the points, updated when done
+  uint64_t minErrors;                         //!< errors that complete a point
+  uint64_t maxPackets;                        //!< largest number of packets of a point
+  uint32_t batch;                             //!< packets per batch
+};
+
+/**
+ * \param schedule the schedule
+ * \param point a point
+ *
+ * \return whether a batch of the point may still be handed out
+ */
+static bool
+IsOpen (const OfdmLinkSchedule &schedule, uint32_t point)
+{
+  const OfdmLinkPointState &state = schedule.states[point];
+  return !state.done && state.claimed < state.batches;
+}
+
+/**
+ * Hand out the next batch to a thread, under the schedule's mutex: the
+ * next batch of the thread's current point, or else of the newest open
+ * point of its share, or else of the oldest open point of another
+ * thread's share, or else of any point still open.  Points found closed
+ * in a share are dropped from it.
+ *
+ * \param schedule the schedule
+ * \param thread the thread
+ * \param point the thread's current point, set to the point of the batch
+ * \param batch set to the batch
+ *
+ * \return false if there is no batch left
+ */
+static bool
+ClaimBatch (OfdmLinkSchedule &schedule, uint32_t thread, uint32_t &point, uint32_t &batch)
+{
+  if (point >= schedule.states.size () || !IsOpen (schedule, point))
+    {
+      std::deque<uint32_t> &own = schedule.shares[thread];
+      point = uint32_t (schedule.states.size ());
+      while (!own.empty () && point == schedule.states.size ())
+        {
+          if (IsOpen (schedule, own.back ()))
+            {
+              point = own.back ();
+            }
+          own.pop_back ();
+        }
+      for (uint32_t i = 1; i < schedule.shares.size () && point == schedule.states.size (); i++)
+        {
+          std::deque<uint32_t> &other = schedule.shares[(thread + i) % schedule.shares.size ()];
+          while (!other.empty () && point == schedule.states.size ())
+            {
+              if (IsOpen (schedule, other.front ()))
+                {
+                  point = other.front ();
+                }
+              other.pop_front ();
+            }
+        }
+      for (uint32_t i = 0; i < schedule.states.size () && point == schedule.states.size (); i++)
+        {
+          if (IsOpen (schedule, i))
+            {
+              point = i;
+            }
+        }
+      if (point == schedule.states.size ())
+        {
+          return false;
+        }
+    }
+  batch = schedule.states[point].claimed++;
+  return true;
+}
+
+/**
+ * Record the errors of a batch, under the schedule's mutex, and complete
+ * the point if the batches finished in order reach the error target.
+ *
+ * \param schedule the schedule
+ * \param point the point
+ * \param batch the batch
+ * \param errors its number of packet errors
+ */
+static void
+FinishBatch (OfdmLinkSchedule &schedule, uint32_t point, uint32_t batch, uint64_t errors)
+{
+  OfdmLinkPointState &state = schedule.states[point];
+  state.errors[batch] = int64_t (errors);
+  OfdmLinkPoint &result = (*schedule.points)[point];
+  while (!state.done && state.decided < state.batches && state.errors[state.decided] >= 0)
+    {
+      uint64_t start = uint64_t (state.decided) * schedule.batch;
+      result.packets += std::min<uint64_t> (schedule.batch, schedule.maxPackets - start);
+      result.errors += state.errors[state.decided];
+      state.decided++;
+      state.done = state.decided == state.batches
+        || (schedule.minErrors > 0 && result.errors >= schedule.minErrors);
+    }
+}
+
+/**
+ * Simulate batches until there are none left.
+ *
+ * \param schedule the schedule
+ * \param thread the number of this thread
+ */
+static void
+RunBatches (OfdmLinkSchedule &schedule, uint32_t thread)
+{
+  std::map<uint32_t, std::unique_ptr<OfdmLinkSimulator> > simulators;
+  uint32_t point = uint32_t (schedule.states.size ());
+  uint32_t batch;
+  std::unique_lock<std::mutex> lock (schedule.mutex);
+  while (ClaimBatch (schedule, thread, point, batch))
+    {
+      const OfdmLinkPoint &p = (*schedule.points)[point];
+      uint64_t key = schedule.states[point].key;
+      lock.unlock ();
+
+      std::unique_ptr<OfdmLinkSimulator> &simulator = simulators[p.mode.GetUid ()];
+      if (!simulator)
+        {
+          simulator.reset (new OfdmLinkSimulator (p.mode));
+        }
+      double snr = std::pow (10.0, p.snrDb / 10);
+      uint64_t start = uint64_t (batch) * schedule.batch;
+      uint64_t end = std::min (start + schedule.batch, schedule.maxPackets);
+      uint64_t errors = 0;
+      for (uint64_t packet = start; packet < end; packet++)
+        {
+          OfdmLinkRng rng (key, packet);
+          errors += simulator->SimulatePacket (p.nbits, snr, rng);
+        }
+
+      lock.lock ();
+      FinishBatch (schedule, point, batch, errors);
+    }
+}
+
+void
+OfdmLinkSimulator::Run (std::vector<OfdmLinkPoint> &points, uint64_t seed, uint64_t minErrors,
+                        uint64_t maxPackets, uint32_t batch, uint32_t threads)
+{
+  NS_ABORT_MSG_IF (batch == 0, "the batch size must be positive");
+  NS_ABORT_MSG_IF (maxPackets == 0, "the number of packets per point must be positive");
+  if (threads == 0)
+    {
+      threads = std::max (std::thread::hardware_concurrency (), 1u);
+    }
+  OfdmLinkSchedule schedule;
+  schedule.points = &points;
+  schedule.minErrors = minErrors;
+  schedule.maxPackets = maxPackets;
+  schedule.batch = batch;
+  schedule.states.resize (points.size ());
+  schedule.shares.resize (threads);
+  for (uint32_t i = 0; i < points.size (); i++)
+    {
+      OfdmLinkPointState &state = schedule.states[i];
+      state.key = GetKey (seed, points[i]);
+      state.batches = uint32_t ((maxPackets + batch - 1) / batch);
+      state.claimed = 0;
+      state.decided = 0;
+      state.done = state.batches == 0;
+      state.errors.assign (state.batches, -1);
+      points[i].packets = 0;
+      points[i].errors = 0;
+      // the threads pop their shares from the back, so hand the points
+      // out in reverse to start each thread on its earliest one
+      schedule.shares[i % threads].push_front (i);
+    }
+
+  std::vector<std::thread> workers;
+  for (uint32_t t = 1; t < threads; t++)
+    {
+      workers.push_back (std::thread (RunBatches, std::ref (schedule), t));
+    }
+  RunBatches (schedule, 0);
+  for (uint32_t t = 0; t < workers.size (); t++)
+    {
+      workers[t].join ();
+    }
+}
+
+} //namespace ns3
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef OFDM_LINK_SIMULATOR_H
+#define OFDM_LINK_SIMULATOR_H
+
+#include <stdint.h>
+#include <vector>
+#include "wifi-mode.h"
+#include "ofdm-convolutional-code.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * A counter-based random number generator, Philox4x32-10 (Salmon et al.,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC 2011).  Every output
+ * of a stream is a fixed function of the key, the stream number and its
+ * position, so a packet simulated on stream n draws the same numbers
+ * whichever thread simulates it and whatever was simulated before.
+ */
+class OfdmLinkRng
+{
+public:
+  /**
+   * \param key the key, e.g. derived from the seed of a run
+   * \param stream the stream, e.g. the number of a packet
+   */
+  OfdmLinkRng (uint64_t key, uint64_t stream);
+
+  /**
+   * \return the next 32 random bits of the stream
+   */
+  uint32_t GetInteger (void);
+  /**
+   * \return a uniform number in (0, 1), with 53 random bits
+   */
+  double GetUniform (void);
+  /**
+   * Draw two independent standard normal numbers (Box-Muller).
+   *
+   * \param x set to the first
+   * \param y set to the second
+   */
+  void GetNormals (double &x, double &y);
+
+private:
+  /**
+   * Compute the next block of four outputs.
+   */
+  void Refill (void);
+
+  uint32_t m_key[2];     //!< the key
+  uint32_t m_counter[4]; //!< block number, 0, and the stream number
+  uint32_t m_output[4];  //!< the current block
+  uint32_t m_next;       //!< the next output of m_output to return
+};
+
+/**
+ * \ingroup wifi
+ *
+ * One (mode, size, SNR) point of a Monte Carlo PER run.
+ */
+struct OfdmLinkPoint
+{
+  WifiMode mode;    //!< the 802.11a/g/p mode
+  uint32_t nbits;   //!< the PSDU size (bits)
+  double snrDb;     //!< the SNR per subcarrier (Es/N0) in dB
+  uint64_t packets; //!< set to the number of packets simulated
+  uint64_t errors;  //!< set to the number of them received in error
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Link-level Monte Carlo simulation of the 802.11a/g/p OFDM PHY over an
+ * AWGN channel, to measure PER curves the tanh models can be fitted to
+ * (see tanh-per-fit.cc).
+ *
+ * A packet of nbits random PSDU bits, padded with zeros to whole OFDM
+ * symbols and ended with the six tail bits, is encoded with the
+ * convolutional code of the mode, punctured, interleaved per OFDM symbol
+ * (802.11a-1999 17.3.5.6 and 17.3.5.7) and Gray mapped onto BPSK, QPSK,
+ * 16-QAM or 64-QAM with unit average energy.  Every subcarrier symbol
+ * gets complex white Gaussian noise of variance 1 / snr, so snr is Es/N0
+ * per subcarrier, the SNR the NIST and tanh models take.  The receiver
+ * computes max-log soft bits, deinterleaves and depunctures them and
+ * decodes them with the Viterbi algorithm; the packet is in error if any
+ * PSDU bit is.  The SERVICE field and the scrambler are left out, as
+ * neither changes the PER over AWGN, and the pad bits precede the tail so
+ * that every code word ends in state 0.
+ *
+ * A simulator holds the buffers of one packet, so each thread needs its
+ * own; Run takes care of that.
+ */
+class OfdmLinkSimulator
+{
+public:
+  /**
+   * \param mode an OFDM or ERP-OFDM mode
+   */
+  OfdmLinkSimulator (WifiMode mode);
+
+  /**
+   * \return the mode simulated
+   */
+  WifiMode GetMode (void) const;
+  /**
+   * \return the number of data bits per OFDM symbol (N_DBPS)
+   */
+  uint32_t GetDataBitsPerSymbol (void) const;
+  /**
+   * Simulate one packet.
+   *
+   * \param nbits the PSDU size (bits)
+   * \param snr the SNR per subcarrier (ratio)
+   * \param rng the random stream of the packet
+   *
+   * \return true if the packet was received in error
+   */
+  bool SimulatePacket (uint32_t nbits, double snr, OfdmLinkRng &rng);
+
+  /**
+   * Simulate packets at every point until it has minErrors packet errors
+   * or maxPackets packets, on several threads.
+   *
+   * The packets of a point are simulated in batches of batch packets.
+   * Each thread starts with its own share of the points and takes the
+   * next batch of its current point until the point is done; a thread
+   * whose share is exhausted steals the points other threads have not
+   * started, and then joins the points still in progress.  Packet n of a
+   * point always uses stream n of a key derived from the seed and the
+   * point, and a point is done at the first batch, in packet order, that
+   * brings it to minErrors errors; batches simulated past it are
+   * dropped.  The result is therefore the same for any number of threads
+   * and any order in which they finish.
+   *
+   * \param points the points, whose packets and errors are set
+   * \param seed the seed of the run
+   * \param minErrors the number of packet errors that completes a point,
+   *        or 0 to always simulate maxPackets packets
+   * \param maxPackets the largest number of packets of a point; must be
+   *        positive
+   * \param batch the number of packets of a batch
+   * \param threads the number of threads, 0 for one per core
+   */
+  static void Run (std::vector<OfdmLinkPoint> &points, uint64_t seed, uint64_t minErrors,
+                   uint64_t maxPackets, uint32_t batch, uint32_t threads);
+  /**
+   * \param seed the seed of a run
+   * \param point a point
+   *
+   * \return the key of the random streams of the packets of point
+   */
+  static uint64_t GetKey (uint64_t seed, const OfdmLinkPoint &point);
+
+private:
+  WifiMode m_mode;                 //!< the mode simulated
+  WifiCodeRate m_rate;             //!< its code rate
+  uint32_t m_bitsPerSubcarrier;    //!< N_BPSC
+  uint32_t m_codedBitsPerSymbol;   //!< N_CBPS
+  uint32_t m_dataBitsPerSymbol;    //!< N_DBPS
+  std::vector<uint32_t> m_interleaver; //!< channel position of each coded bit of an OFDM symbol
+  std::vector<double> m_amplitudes;    //!< amplitude of each label of an axis
+  OfdmConvolutionalCode m_code;    //!< the decoder and its buffers
+  std::vector<uint8_t> m_bits;     //!< message bits
+  std::vector<uint8_t> m_coded;    //!< mother code bits
+  std::vector<uint8_t> m_sent;     //!< punctured bits
+  std::vector<uint8_t> m_channel;  //!< bits of an OFDM symbol in channel order
+  std::vector<float> m_received;   //!< soft bits of an OFDM symbol in channel order
+  std::vector<float> m_soft;       //!< deinterleaved soft bits
+  std::vector<float> m_depunctured; //!< soft bits of the mother code
+  std::vector<uint8_t> m_decoded;  //!< decoded message bits
+};
+
+} //namespace ns3
+
+#endif /* OFDM_LINK_SIMULATOR_H */
@@ -0,0 +1,298 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <algorithm>
+#include "ofdm-viterbi-simd.h"
+#include "ofdm-convolutional-code.h"
+
+#if defined (__x86_64__) && (defined (__GNUC__) || defined (__clang__))
+#define OFDM_VITERBI_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace ns3 {
+
+// The trellis step of every kernel is a set of 32 butterflies: the old
+// states 2j and 2j + 1 lead to the new states j (input 0) and j + 32
+// (input 1).  As both generators have their first and last tap set, the
+// four branches of butterfly j carry +bm or -bm, bm being the correlation
+// of the soft bits with the coded pair of the branch from 2j to j:
+//   new[j]      = max (old[2j] + bm, old[2j + 1] - bm)
+//   new[j + 32] = max (old[2j] - bm, old[2j + 1] + bm)
+// and the decision of a new state is set if its odd predecessor wins
+// strictly.
+
+/// Initial metric of the states other than 0
+static const int16_t UNREACHED = -8192;
+
+/**
+ * The signs of the coded bits A and B on the branch of every butterfly.
+ */
+struct OfdmViterbiSigns
+{
+  OfdmViterbiSigns ()
+  {
+    for (uint32_t j = 0; j < OfdmConvolutionalCode::STATES / 2; j++)
+      {
+        uint32_t pair = OfdmConvolutionalCode::GetOutputs (2 * j);
+        a[j] = (pair & 2) ? -1 : 1;
+        b[j] = (pair & 1) ? -1 : 1;
+      }
+  }
+  int16_t a[OfdmConvolutionalCode::STATES / 2]; //!< sign of the soft bit A, by butterfly
+  int16_t b[OfdmConvolutionalCode::STATES / 2]; //!< sign of the soft bit B, by butterfly
+};
+
+/**
+ * \return the branch signs of the butterflies
+ */
+static const OfdmViterbiSigns &
+GetSigns (void)
+{
+  static const OfdmViterbiSigns signs;
+  return signs;
+}
+
+/**
+ * \param x a sum of two 16-bit metrics
+ *
+ * \return x saturated to 16 bits, as the SIMD additions do
+ */
+static inline int16_t
+Saturate (int32_t x)
+{
+  return int16_t (std::min<int32_t> (std::max<int32_t> (x, -32768), 32767));
+}
+
+/*
+ * Portable kernel
+ */
+
+static void
+ScalarDecide (const int16_t *soft, uint32_t nbits, uint64_t *decisions)
+{
+  const OfdmViterbiSigns &signs = GetSigns ();
+  int16_t metrics[OfdmConvolutionalCode::STATES];
+  int16_t next[OfdmConvolutionalCode::STATES];
+  std::fill (metrics, metrics + OfdmConvolutionalCode::STATES, UNREACHED);
+  metrics[0] = 0;
+  for (uint32_t t = 0; t < nbits; t++)
+    {
+      uint64_t decision = 0;
+      for (uint32_t j = 0; j < OfdmConvolutionalCode::STATES / 2; j++)
+        {
+          int32_t bm = signs.a[j] * soft[2 * t] + signs.b[j] * soft[2 * t + 1];
+          int16_t even0 = Saturate (metrics[2 * j] + bm);
+          int16_t odd0 = Saturate (metrics[2 * j + 1] - bm);
+          int16_t even1 = Saturate (metrics[2 * j] - bm);
+          int16_t odd1 = Saturate (metrics[2 * j + 1] + bm);
+          next[j] = std::max (even0, odd0);
+          next[j + 32] = std::max (even1, odd1);
+          decision |= (uint64_t (odd0 > even0) << j) | (uint64_t (odd1 > even1) << (j + 32));
+        }
+      decisions[t] = decision;
+      int16_t reference = next[0];
+      for (uint32_t s = 0; s < OfdmConvolutionalCode::STATES; s++)
+        {
+          metrics[s] = Saturate (next[s] - reference);
+        }
+    }
+}
+
+#ifdef OFDM_VITERBI_X86_KERNELS
+
+/*
+ * SSSE3, 8 states per register
+ */
+
+__attribute__ ((target ("ssse3")))
+static void
+Ssse3Decide (const int16_t *soft, uint32_t nbits, uint64_t *decisions)
+{
+  const OfdmViterbiSigns &signs = GetSigns ();
+  // within each register, the even states to the low and the odd states
+  // to the high 64 bits
+  const __m128i split = _mm_setr_epi8 (0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+  __m128i signA[4];
+  __m128i signB[4];
+  __m128i m[8];
+  for (uint32_t g = 0; g < 4; g++)
+    {
+      signA[g] = _mm_loadu_si128 ((const __m128i *) (signs.a + 8 * g));
+      signB[g] = _mm_loadu_si128 ((const __m128i *) (signs.b + 8 * g));
+    }
+  for (uint32_t k = 0; k < 8; k++)
+    {
+      m[k] = _mm_set1_epi16 (UNREACHED);
+    }
+  m[0] = _mm_insert_epi16 (m[0], 0, 0);
+
+  for (uint32_t t = 0; t < nbits; t++)
+    {
+      __m128i a = _mm_set1_epi16 (soft[2 * t]);
+      __m128i b = _mm_set1_epi16 (soft[2 * t + 1]);
+      __m128i next[8];
+      __m128i decided[8];
+      for (uint32_t g = 0; g < 4; g++)
+        {
+          // butterflies 8g .. 8g + 7, from the old states 16g .. 16g + 15
+          __m128i x0 = _mm_shuffle_epi8 (m[2 * g], split);
+          __m128i x1 = _mm_shuffle_epi8 (m[2 * g + 1], split);
+          __m128i even = _mm_unpacklo_epi64 (x0, x1);
+          __m128i odd = _mm_unpackhi_epi64 (x0, x1);
+          __m128i bm = _mm_adds_epi16 (_mm_sign_epi16 (a, signA[g]), _mm_sign_epi16 (b, signB[g]));
+          __m128i even0 = _mm_adds_epi16 (even, bm);
+          __m128i odd0 = _mm_subs_epi16 (odd, bm);
+          __m128i even1 = _mm_subs_epi16 (even, bm);
+          __m128i odd1 = _mm_adds_epi16 (odd, bm);
+          next[g] = _mm_max_epi16 (even0, odd0);
+          next[g + 4] = _mm_max_epi16 (even1, odd1);
+          decided[g] = _mm_cmpgt_epi16 (odd0, even0);
+          decided[g + 4] = _mm_cmpgt_epi16 (odd1, even1);
+        }
+      uint64_t decision = 0;
+      for (uint32_t k = 0; k < 4; k++)
+        {
+          uint32_t bits = _mm_movemask_epi8 (_mm_packs_epi16 (decided[2 * k], decided[2 * k + 1]));
+          decision |= uint64_t (bits) << (16 * k);
+        }
+      decisions[t] = decision;
+      __m128i reference = _mm_shuffle_epi8 (next[0], _mm_set1_epi16 (0x0100));
+      for (uint32_t k = 0; k < 8; k++)
+        {
+          m[k] = _mm_subs_epi16 (next[k], reference);
+        }
+    }
+}
+
+/*
+ * AVX2, 16 states per register
+ */
+
+__attribute__ ((target ("avx2")))
+static void
+Avx2Decide (const int16_t *soft, uint32_t nbits, uint64_t *decisions)
+{
+  const OfdmViterbiSigns &signs = GetSigns ();
+  // within each 128-bit lane, the even states to the low and the odd
+  // states to the high 64 bits
+  const __m256i split = _mm256_setr_epi8 (0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                          0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+  __m256i signA[2];
+  __m256i signB[2];
+  __m256i m[4];
+  for (uint32_t g = 0; g < 2; g++)
+    {
+      signA[g] = _mm256_loadu_si256 ((const __m256i *) (signs.a + 16 * g));
+      signB[g] = _mm256_loadu_si256 ((const __m256i *) (signs.b + 16 * g));
+    }
+  for (uint32_t k = 0; k < 4; k++)
+    {
+      m[k] = _mm256_set1_epi16 (UNREACHED);
+    }
+  m[0] = _mm256_insert_epi16 (m[0], 0, 0);
+
+  for (uint32_t t = 0; t < nbits; t++)
+    {
+      __m256i a = _mm256_set1_epi16 (soft[2 * t]);
+      __m256i b = _mm256_set1_epi16 (soft[2 * t + 1]);
+      __m256i next[4];
+      __m256i decided[4];
+      for (uint32_t g = 0; g < 2; g++)
+        {
+          // butterflies 16g .. 16g + 15, from the old states 32g .. 32g + 31;
+          // after the split, the 64-bit quarters are the even and odd
+          // states of each lane, which are regrouped in lane order
+          __m256i x0 = _mm256_permute4x64_epi64 (_mm256_shuffle_epi8 (m[2 * g], split), 0xD8);
+          __m256i x1 = _mm256_permute4x64_epi64 (_mm256_shuffle_epi8 (m[2 * g + 1], split), 0xD8);
+          __m256i even = _mm256_permute2x128_si256 (x0, x1, 0x20);
+          __m256i odd = _mm256_permute2x128_si256 (x0, x1, 0x31);
+          __m256i bm = _mm256_adds_epi16 (_mm256_sign_epi16 (a, signA[g]), _mm256_sign_epi16 (b, signB[g]));
+          __m256i even0 = _mm256_adds_epi16 (even, bm);
+          __m256i odd0 = _mm256_subs_epi16 (odd, bm);
+          __m256i even1 = _mm256_subs_epi16 (even, bm);
+          __m256i odd1 = _mm256_adds_epi16 (odd, bm);
+          next[g] = _mm256_max_epi16 (even0, odd0);
+          next[g + 2] = _mm256_max_epi16 (even1, odd1);
+          decided[g] = _mm256_cmpgt_epi16 (odd0, even0);
+          decided[g + 2] = _mm256_cmpgt_epi16 (odd1, even1);
+        }
+      // the pack interleaves the lanes of its operands; put them back in
+      // state order before taking the byte masks
+      uint32_t low = _mm256_movemask_epi8 (_mm256_permute4x64_epi64 (_mm256_packs_epi16 (decided[0], decided[1]), 0xD8));
+      uint32_t high = _mm256_movemask_epi8 (_mm256_permute4x64_epi64 (_mm256_packs_epi16 (decided[2], decided[3]), 0xD8));
+      decisions[t] = uint64_t (low) | (uint64_t (high) << 32);
+      __m256i reference = _mm256_broadcastw_epi16 (_mm256_castsi256_si128 (next[0]));
+      for (uint32_t k = 0; k < 4; k++)
+        {
+          m[k] = _mm256_subs_epi16 (next[k], reference);
+        }
+    }
+}
+
+#endif /* OFDM_VITERBI_X86_KERNELS */
+
+static const OfdmViterbiKernels g_scalarKernels = { "scalar", &ScalarDecide };
+#ifdef OFDM_VITERBI_X86_KERNELS
+static const OfdmViterbiKernels g_ssse3Kernels = { "ssse3", &Ssse3Decide };
+static const OfdmViterbiKernels g_avx2Kernels = { "avx2", &Avx2Decide };
+#endif
+
+const OfdmViterbiKernels *
+GetOfdmViterbiKernels (const std::string &name)
+{
+  if (name == "scalar")
+    {
+      return &g_scalarKernels;
+    }
+#ifdef OFDM_VITERBI_X86_KERNELS
+  __builtin_cpu_init ();
+  if (name == "ssse3" && __builtin_cpu_supports ("ssse3"))
+    {
+      return &g_ssse3Kernels;
+    }
+  if (name == "avx2" && __builtin_cpu_supports ("avx2"))
+    {
+      return &g_avx2Kernels;
+    }
+#endif
+  return 0;
+}
+
+static const OfdmViterbiKernels *
+SelectVectorKernels (void)
+{
+  const char *preferred[] = { "avx2", "ssse3" };
+  for (size_t i = 0; i < sizeof (preferred) / sizeof (preferred[0]); i++)
+    {
+      const OfdmViterbiKernels *kernels = GetOfdmViterbiKernels (preferred[i]);
+      if (kernels != 0)
+        {
+          return kernels;
+        }
+    }
+  return &g_scalarKernels;
+}
+
+const OfdmViterbiKernels &
+GetOfdmViterbiVectorKernels (void)
+{
+  static const OfdmViterbiKernels *kernels = SelectVectorKernels ();
+  return *kernels;
+}
+
+} //namespace ns3
@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef OFDM_VITERBI_SIMD_H
+#define OFDM_VITERBI_SIMD_H
+
+#include <stdint.h>
+#include <string>
+
+namespace ns3 {
+
+/// Largest magnitude of the quantised soft bits the kernels take
+static const int16_t OFDM_VITERBI_MAX_SOFT = 127;
+
+/**
+ * Run the add-compare-select recursion of the Viterbi decoder of
+ * OfdmConvolutionalCode over 2 * nbits quantised soft bits (each in
+ * [-OFDM_VITERBI_MAX_SOFT, OFDM_VITERBI_MAX_SOFT], positive favouring 0),
+ * starting in state 0, and set decisions[t] to the survivor choices of
+ * the 64 states at step t, in the layout OfdmConvolutionalCode traces
+ * back.
+ */
+typedef void (*OfdmViterbiKernel) (const int16_t *soft, uint32_t nbits, uint64_t *decisions);
+
+/**
+ * \ingroup wifi
+ *
+ * The add-compare-select kernels of OfdmConvolutionalCode::Decode.
+ *
+ * The path metrics are 16-bit integers, with saturating additions, and
+ * are renormalised to the metric of state 0 after every step, which
+ * keeps them within a few thousand of each other.  The "scalar" kernel
+ * does this one state at a time; the "ssse3" (8 states per register)
+ * and "avx2" (16 states per register) kernels run the 32 butterflies of
+ * a step in parallel with the same arithmetic, so every kernel takes
+ * the same decisions on every CPU.
+ */
+struct OfdmViterbiKernels
+{
+  const char *name;         //!< "scalar", "ssse3" or "avx2"
+  OfdmViterbiKernel decide; //!< the add-compare-select recursion
+};
+
+/**
+ * \return the fastest kernels the running CPU supports
+ */
+const OfdmViterbiKernels & GetOfdmViterbiVectorKernels (void);
+/**
+ * \param name "scalar", "ssse3" or "avx2"
+ *
+ * \return the named kernels, or 0 if they are unknown or the running CPU
+ *         does not support them
+ */
+const OfdmViterbiKernels * GetOfdmViterbiKernels (const std::string &name);
+
+} //namespace ns3
+
+#endif /* OFDM_VITERBI_SIMD_H */
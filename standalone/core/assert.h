@@ -0,0 +1,65 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_ASSERT_H
+#define NS3_ASSERT_H
+
+#include "fatal-error.h"
+
+// As in an optimized ns-3 build, assertions are compiled out when NDEBUG
+// is defined; the condition is still type-checked.
+
+#ifndef NDEBUG
+
+#define NS_ASSERT(condition)                                            \
+  do                                                                    \
+    {                                                                   \
+      if (!(condition))                                                 \
+        {                                                               \
+          NS_FATAL_ERROR ("assert failed. cond=\"" << #condition << "\""); \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_ASSERT_MSG(condition, message)                               \
+  do                                                                    \
+    {                                                                   \
+      if (!(condition))                                                 \
+        {                                                               \
+          NS_FATAL_ERROR ("assert failed. cond=\"" << #condition << "\", " << message); \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#else /* NDEBUG */
+
+#define NS_ASSERT(condition)                                            \
+  do                                                                    \
+    {                                                                   \
+      (void) sizeof (condition);                                        \
+    }                                                                   \
+  while (false)
+
+#define NS_ASSERT_MSG(condition, message)                               \
+  do                                                                    \
+    {                                                                   \
+      (void) sizeof (condition);                                        \
+    }                                                                   \
+  while (false)
+
+#endif /* NDEBUG */
+
+#endif /* NS3_ASSERT_H */
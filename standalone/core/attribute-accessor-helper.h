@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ATTRIBUTE_ACCESSOR_HELPER_H
+#define ATTRIBUTE_ACCESSOR_HELPER_H
+
+#include "attribute.h"
+
+namespace ns3 {
+
+/**
+ * Accessor of a data member of class T.
+ */
+template <typename V, typename T, typename U>
+class MemberVariableAccessor : public AttributeAccessor
+{
+public:
+  MemberVariableAccessor (U T::*member)
+    : m_member (member)
+  {
+  }
+  virtual bool Set (ObjectBase *object, const AttributeValue &value) const
+  {
+    T *obj = dynamic_cast<T *> (object);
+    const V *v = dynamic_cast<const V *> (&value);
+    if (obj == 0 || v == 0)
+      {
+        return false;
+      }
+    obj->*m_member = v->Get ();
+    return true;
+  }
+  virtual bool Get (const ObjectBase *object, AttributeValue &value) const
+  {
+    const T *obj = dynamic_cast<const T *> (object);
+    V *v = dynamic_cast<V *> (&value);
+    if (obj == 0 || v == 0)
+      {
+        return false;
+      }
+    v->Set (obj->*m_member);
+    return true;
+  }
+  virtual bool HasGetter (void) const
+  {
+    return true;
+  }
+  virtual bool HasSetter (void) const
+  {
+    return true;
+  }
+
+private:
+  U T::*m_member; //!< the data member
+};
+
+/**
+ * Accessor through a setter and/or a getter of class T; either may be 0.
+ */
+template <typename V, typename T, typename U, typename W>
+class SetterGetterAccessor : public AttributeAccessor
+{
+public:
+  SetterGetterAccessor (void (T::*setter)(U), W (T::*getter)(void) const)
+    : m_setter (setter),
+      m_getter (getter)
+  {
+  }
+  virtual bool Set (ObjectBase *object, const AttributeValue &value) const
+  {
+    T *obj = dynamic_cast<T *> (object);
+    const V *v = dynamic_cast<const V *> (&value);
+    if (m_setter == 0 || obj == 0 || v == 0)
+      {
+        return false;
+      }
+    (obj->*m_setter)(v->Get ());
+    return true;
+  }
+  virtual bool Get (const ObjectBase *object, AttributeValue &value) const
+  {
+    const T *obj = dynamic_cast<const T *> (object);
+    V *v = dynamic_cast<V *> (&value);
+    if (m_getter == 0 || obj == 0 || v == 0)
+      {
+        return false;
+      }
+    v->Set ((obj->*m_getter)());
+    return true;
+  }
+  virtual bool HasGetter (void) const
+  {
+    return m_getter != 0;
+  }
+  virtual bool HasSetter (void) const
+  {
+    return m_setter != 0;
+  }
+
+private:
+  void (T::*m_setter)(U);         //!< the setter, or 0
+  W (T::*m_getter)(void) const;   //!< the getter, or 0
+};
+
+template <typename V, typename T, typename U>
+Ptr<const AttributeAccessor>
+MakeAccessorHelper (U T::*member)
+{
+  return Ptr<const AttributeAccessor> (new MemberVariableAccessor<V, T, U> (member), false);
+}
+
+template <typename V, typename T, typename U>
+Ptr<const AttributeAccessor>
+MakeAccessorHelper (U (T::*getter)(void) const)
+{
+  return Ptr<const AttributeAccessor> (new SetterGetterAccessor<V, T, U, U> (0, getter), false);
+}
+
+template <typename V, typename T, typename U>
+Ptr<const AttributeAccessor>
+MakeAccessorHelper (void (T::*setter)(U))
+{
+  return Ptr<const AttributeAccessor> (new SetterGetterAccessor<V, T, U, U> (setter, 0), false);
+}
+
+template <typename V, typename T, typename U, typename W>
+Ptr<const AttributeAccessor>
+MakeAccessorHelper (void (T::*setter)(U), W (T::*getter)(void) const)
+{
+  return Ptr<const AttributeAccessor> (new SetterGetterAccessor<V, T, U, W> (setter, getter), false);
+}
+
+template <typename V, typename T, typename U, typename W>
+Ptr<const AttributeAccessor>
+MakeAccessorHelper (W (T::*getter)(void) const, void (T::*setter)(U))
+{
+  return Ptr<const AttributeAccessor> (new SetterGetterAccessor<V, T, U, W> (setter, getter), false);
+}
+
+} //namespace ns3
+
+/**
+ * Define MakeXAccessor () for the attribute value class XValue.
+ */
+#define ATTRIBUTE_ACCESSOR_DEFINE(type)                                 \
+  template <typename T1>                                                \
+  Ptr<const AttributeAccessor> Make ## type ## Accessor (T1 a1)         \
+  {                                                                     \
+    return MakeAccessorHelper<type ## Value> (a1);                      \
+  }                                                                     \
+  template <typename T1, typename T2>                                   \
+  Ptr<const AttributeAccessor> Make ## type ## Accessor (T1 a1, T2 a2)  \
+  {                                                                     \
+    return MakeAccessorHelper<type ## Value> (a1, a2);                  \
+  }
+
+#endif /* ATTRIBUTE_ACCESSOR_HELPER_H */
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ATTRIBUTE_H
+#define ATTRIBUTE_H
+
+#include <string>
+#include "ptr.h"
+#include "simple-ref-count.h"
+
+namespace ns3 {
+
+class ObjectBase;
+
+/**
+ * \ingroup standalone
+ *
+ * Base class of the values an attribute can hold.
+ */
+class AttributeValue : public SimpleRefCount<AttributeValue>
+{
+public:
+  virtual ~AttributeValue ();
+  /**
+   * \return a deep copy of this value
+   */
+  virtual Ptr<AttributeValue> Copy (void) const = 0;
+  /**
+   * \return this value as text
+   */
+  virtual std::string SerializeToString (void) const = 0;
+  /**
+   * \param value the text to parse
+   *
+   * \return true if value was parsed into this object
+   */
+  virtual bool DeserializeFromString (std::string value) = 0;
+};
+
+/**
+ * \ingroup standalone
+ *
+ * Reads and writes one attribute of an object.
+ */
+class AttributeAccessor : public SimpleRefCount<AttributeAccessor>
+{
+public:
+  virtual ~AttributeAccessor ();
+  /**
+   * \return true if value could be stored in object
+   */
+  virtual bool Set (ObjectBase *object, const AttributeValue &value) const = 0;
+  /**
+   * \return true if the attribute of object could be copied into value
+   */
+  virtual bool Get (const ObjectBase *object, AttributeValue &value) const = 0;
+  /**
+   * \return true if Get is supported
+   */
+  virtual bool HasGetter (void) const = 0;
+  /**
+   * \return true if Set is supported
+   */
+  virtual bool HasSetter (void) const = 0;
+};
+
+/**
+ * \ingroup standalone
+ *
+ * Validates the values given to one attribute.
+ */
+class AttributeChecker : public SimpleRefCount<AttributeChecker>
+{
+public:
+  virtual ~AttributeChecker ();
+  /**
+   * \return true if value is of the right type and in range
+   */
+  virtual bool Check (const AttributeValue &value) const = 0;
+};
+
+} //namespace ns3
+
+#endif /* ATTRIBUTE_H */
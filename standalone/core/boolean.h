@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BOOLEAN_H
+#define BOOLEAN_H
+
+#include "attribute.h"
+#include "attribute-accessor-helper.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Holds a boolean attribute value.
+ */
+class BooleanValue : public AttributeValue
+{
+public:
+  BooleanValue (bool value = false)
+    : m_value (value)
+  {
+  }
+  void Set (bool value)
+  {
+    m_value = value;
+  }
+  bool Get (void) const
+  {
+    return m_value;
+  }
+  virtual Ptr<AttributeValue> Copy (void) const
+  {
+    return Ptr<AttributeValue> (new BooleanValue (*this), false);
+  }
+  virtual std::string SerializeToString (void) const
+  {
+    return m_value ? "true" : "false";
+  }
+  virtual bool DeserializeFromString (std::string value)
+  {
+    if (value == "true" || value == "1" || value == "t")
+      {
+        m_value = true;
+        return true;
+      }
+    if (value == "false" || value == "0" || value == "f")
+      {
+        m_value = false;
+        return true;
+      }
+    return false;
+  }
+
+private:
+  bool m_value; //!< the value
+};
+
+ATTRIBUTE_ACCESSOR_DEFINE (Boolean);
+
+/**
+ * Checks that a value is a BooleanValue.
+ */
+class BooleanChecker : public AttributeChecker
+{
+public:
+  virtual bool Check (const AttributeValue &value) const
+  {
+    return dynamic_cast<const BooleanValue *> (&value) != 0;
+  }
+};
+
+inline Ptr<const AttributeChecker>
+MakeBooleanChecker (void)
+{
+  return Ptr<const AttributeChecker> (new BooleanChecker (), false);
+}
+
+} //namespace ns3
+
+#endif /* BOOLEAN_H */
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include "command-line.h"
+
+namespace ns3 {
+
+CommandLine::~CommandLine ()
+{
+  for (size_t i = 0; i < m_items.size (); i++)
+    {
+      delete m_items[i];
+    }
+}
+
+CommandLine::Item::~Item ()
+{
+}
+
+void
+CommandLine::PrintHelp (const char *program) const
+{
+  std::cout << program << " [Program Options]" << std::endl << std::endl
+            << "Program Options:" << std::endl;
+  for (size_t i = 0; i < m_items.size (); i++)
+    {
+      std::cout << "    --" << m_items[i]->m_name << ":\t" << m_items[i]->m_help
+                << " [" << m_items[i]->GetDefault () << "]" << std::endl;
+    }
+}
+
+void
+CommandLine::Parse (int argc, char *argv[])
+{
+  for (int i = 1; i < argc; i++)
+    {
+      std::string arg = argv[i];
+      if (arg.compare (0, 2, "--") != 0)
+        {
+          std::cerr << "Invalid argument " << arg << std::endl;
+          std::exit (1);
+        }
+      arg = arg.substr (2);
+      std::string::size_type equal = arg.find ('=');
+      std::string name = arg.substr (0, equal);
+      std::string value = (equal == std::string::npos) ? "" : arg.substr (equal + 1);
+      if (name == "help" || name == "PrintHelp")
+        {
+          PrintHelp (argv[0]);
+          std::exit (0);
+        }
+      Item *item = 0;
+      for (size_t j = 0; j < m_items.size (); j++)
+        {
+          if (m_items[j]->m_name == name)
+            {
+              item = m_items[j];
+            }
+        }
+      if (item == 0)
+        {
+          std::cerr << "Invalid command-line argument: --" << name << std::endl;
+          PrintHelp (argv[0]);
+          std::exit (1);
+        }
+      if ((equal == std::string::npos && !item->IsFlag ()) || !item->Parse (value))
+        {
+          std::cerr << "Invalid value for --" << name << ": \"" << value << "\"" << std::endl;
+          std::exit (1);
+        }
+    }
+}
+
+} //namespace ns3
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Parses --name=value program arguments into variables.  A bare --name
+ * sets a bool variable to true; --help (or --PrintHelp) prints the
+ * options and exits.
+ */
+class CommandLine
+{
+public:
+  ~CommandLine ();
+  /**
+   * \param name the option name, without the leading --
+   * \param help the option description
+   * \param value the variable set by the option; it keeps its value if
+   *        the option is not given
+   */
+  template <typename T>
+  void AddValue (const std::string &name, const std::string &help, T &value);
+  /**
+   * Parse the program arguments; exits on an unknown or malformed option.
+   */
+  void Parse (int argc, char *argv[]);
+
+private:
+  /**
+   * An option bound to a variable.
+   */
+  class Item
+  {
+  public:
+    virtual ~Item ();
+    /**
+     * \return true if value was parsed into the variable
+     */
+    virtual bool Parse (const std::string &value) = 0;
+    /**
+     * \return true if the option may be given without a value
+     */
+    virtual bool IsFlag (void) const = 0;
+    /**
+     * \return the current value of the variable as text
+     */
+    virtual std::string GetDefault (void) const = 0;
+
+    std::string m_name; //!< option name
+    std::string m_help; //!< option description
+  };
+
+  /**
+   * An option bound to a variable of type T.
+   */
+  template <typename T>
+  class TypedItem : public Item
+  {
+  public:
+    TypedItem (T &value)
+      : m_value (value)
+    {
+    }
+    virtual bool Parse (const std::string &value)
+    {
+      std::istringstream is (value);
+      T parsed;
+      is >> parsed;
+      if (is.fail () || !is.eof ())
+        {
+          return false;
+        }
+      m_value = parsed;
+      return true;
+    }
+    virtual bool IsFlag (void) const
+    {
+      return false;
+    }
+    virtual std::string GetDefault (void) const
+    {
+      std::ostringstream os;
+      os << m_value;
+      return os.str ();
+    }
+
+  private:
+    T &m_value; //!< the variable
+  };
+
+  /**
+   * Print the options on std::cout.
+   */
+  void PrintHelp (const char *program) const;
+
+  std::vector<Item *> m_items; //!< the options
+};
+
+/**
+ * A string option takes the whole value, spaces included.
+ */
+template <>
+inline bool
+CommandLine::TypedItem<std::string>::Parse (const std::string &value)
+{
+  m_value = value;
+  return true;
+}
+
+/**
+ * A bool option accepts true/false, 1/0 or no value at all.
+ */
+template <>
+inline bool
+CommandLine::TypedItem<bool>::Parse (const std::string &value)
+{
+  if (value == "" || value == "true" || value == "1" || value == "t")
+    {
+      m_value = true;
+      return true;
+    }
+  if (value == "false" || value == "0" || value == "f")
+    {
+      m_value = false;
+      return true;
+    }
+  return false;
+}
+
+template <>
+inline bool
+CommandLine::TypedItem<bool>::IsFlag (void) const
+{
+  return true;
+}
+
+template <typename T>
+void
+CommandLine::AddValue (const std::string &name, const std::string &help, T &value)
+{
+  Item *item = new TypedItem<T> (value);
+  item->m_name = name;
+  item->m_help = help;
+  m_items.push_back (item);
+}
+
+} //namespace ns3
+
+#endif /* COMMAND_LINE_H */
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS_DOUBLE_H
+#define NS_DOUBLE_H
+
+#include <limits>
+#include <sstream>
+#include "attribute.h"
+#include "attribute-accessor-helper.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Holds a floating point attribute value.
+ */
+class DoubleValue : public AttributeValue
+{
+public:
+  DoubleValue (double value = 0)
+    : m_value (value)
+  {
+  }
+  void Set (double value)
+  {
+    m_value = value;
+  }
+  double Get (void) const
+  {
+    return m_value;
+  }
+  virtual Ptr<AttributeValue> Copy (void) const
+  {
+    return Ptr<AttributeValue> (new DoubleValue (*this), false);
+  }
+  virtual std::string SerializeToString (void) const
+  {
+    std::ostringstream os;
+    os.precision (17);
+    os << m_value;
+    return os.str ();
+  }
+  virtual bool DeserializeFromString (std::string value)
+  {
+    std::istringstream is (value);
+    is >> m_value;
+    return !is.fail () && is.eof ();
+  }
+
+private:
+  double m_value; //!< the value
+};
+
+ATTRIBUTE_ACCESSOR_DEFINE (Double);
+
+/**
+ * Checks that a DoubleValue lies in [min, max].
+ */
+class DoubleChecker : public AttributeChecker
+{
+public:
+  DoubleChecker (double min, double max)
+    : m_min (min),
+      m_max (max)
+  {
+  }
+  virtual bool Check (const AttributeValue &value) const
+  {
+    const DoubleValue *v = dynamic_cast<const DoubleValue *> (&value);
+    return v != 0 && v->Get () >= m_min && v->Get () <= m_max;
+  }
+
+private:
+  double m_min; //!< smallest accepted value
+  double m_max; //!< largest accepted value
+};
+
+template <typename T>
+Ptr<const AttributeChecker>
+MakeDoubleChecker (double min = -std::numeric_limits<T>::max (),
+                   double max = std::numeric_limits<T>::max ())
+{
+  return Ptr<const AttributeChecker> (new DoubleChecker (min, max), false);
+}
+
+} //namespace ns3
+
+#endif /* NS_DOUBLE_H */
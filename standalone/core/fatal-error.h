@@ -0,0 +1,37 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_FATAL_ERROR_H
+#define NS3_FATAL_ERROR_H
+
+#include <exception>
+#include <iostream>
+
+/**
+ * \ingroup standalone
+ *
+ * Report msg and terminate the program.
+ */
+#define NS_FATAL_ERROR(msg)                                             \
+  do                                                                    \
+    {                                                                   \
+      std::cerr << "msg=\"" << msg << "\", file=" << __FILE__           \
+                << ", line=" << __LINE__ << std::endl;                  \
+      std::terminate ();                                                \
+    }                                                                   \
+  while (false)
+
+#endif /* NS3_FATAL_ERROR_H */
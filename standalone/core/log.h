@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_LOG_H
+#define NS3_LOG_H
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * A named log component.  The standalone build has no log levels: every
+ * NS_LOG_* macro but NS_LOG_UNCOND compiles to nothing, as in an
+ * optimized ns-3 build, but its arguments are still type-checked.
+ */
+class LogComponent
+{
+public:
+  /**
+   * \param name the name of the component
+   */
+  LogComponent (const char *name);
+  /**
+   * \return the name of the component
+   */
+  const char * Name (void) const;
+
+private:
+  const char *m_name; //!< the name of the component
+};
+
+} //namespace ns3
+
+#define NS_LOG_COMPONENT_DEFINE(name)                                   \
+  static ns3::LogComponent g_log = ns3::LogComponent (name)
+
+#define NS_LOG_NOOP_INTERNAL(msg)                                       \
+  do                                                                    \
+    {                                                                   \
+      if (false)                                                        \
+        {                                                               \
+          std::clog << msg;                                             \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_LOG_ERROR(msg) NS_LOG_NOOP_INTERNAL (msg)
+#define NS_LOG_WARN(msg) NS_LOG_NOOP_INTERNAL (msg)
+#define NS_LOG_DEBUG(msg) NS_LOG_NOOP_INTERNAL (msg)
+#define NS_LOG_INFO(msg) NS_LOG_NOOP_INTERNAL (msg)
+#define NS_LOG_LOGIC(msg) NS_LOG_NOOP_INTERNAL (msg)
+#define NS_LOG_FUNCTION(parameters) NS_LOG_NOOP_INTERNAL (parameters)
+#define NS_LOG_FUNCTION_NOARGS()
+
+#define NS_LOG_UNCOND(msg)                                              \
+  do                                                                    \
+    {                                                                   \
+      std::clog << msg << std::endl;                                    \
+    }                                                                   \
+  while (false)
+
+#endif /* NS3_LOG_H */
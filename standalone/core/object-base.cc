@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "object-base.h"
+#include "abort.h"
+
+namespace ns3 {
+
+TypeId
+ObjectBase::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ObjectBase")
+    .SetGroupName ("Core")
+  ;
+  return tid;
+}
+
+ObjectBase::~ObjectBase ()
+{
+}
+
+void
+ObjectBase::ConstructSelf (void)
+{
+  TypeId tid = GetInstanceTypeId ();
+  while (true)
+    {
+      for (size_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          if (info.flags & TypeId::ATTR_CONSTRUCT)
+            {
+              info.accessor->Set (this, *info.initialValue);
+            }
+        }
+      if (tid.GetParent () == tid)
+        {
+          break;
+        }
+      tid = tid.GetParent ();
+    }
+}
+
+bool
+ObjectBase::SetAttributeFailSafe (std::string name, const AttributeValue &value)
+{
+  struct TypeId::AttributeInformation info;
+  if (!GetInstanceTypeId ().LookupAttributeByName (name, &info)
+      || !(info.flags & TypeId::ATTR_SET)
+      || !info.checker->Check (value))
+    {
+      return false;
+    }
+  return info.accessor->Set (this, value);
+}
+
+void
+ObjectBase::SetAttribute (std::string name, const AttributeValue &value)
+{
+  NS_ABORT_MSG_UNLESS (SetAttributeFailSafe (name, value),
+                       "could not set attribute " << name << " of "
+                       << GetInstanceTypeId ().GetName ());
+}
+
+void
+ObjectBase::GetAttribute (std::string name, AttributeValue &value) const
+{
+  struct TypeId::AttributeInformation info;
+  NS_ABORT_MSG_UNLESS (GetInstanceTypeId ().LookupAttributeByName (name, &info),
+                       "no attribute " << name << " in " << GetInstanceTypeId ().GetName ());
+  NS_ABORT_MSG_UNLESS ((info.flags & TypeId::ATTR_GET) && info.accessor->Get (this, value),
+                       "could not read attribute " << name);
+}
+
+} //namespace ns3
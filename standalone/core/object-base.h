@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OBJECT_BASE_H
+#define OBJECT_BASE_H
+
+#include <string>
+#include "type-id.h"
+#include "attribute.h"
+
+/**
+ * Make sure the TypeId of type is registered before main () starts.
+ */
+#define NS_OBJECT_ENSURE_REGISTERED(type)                               \
+  static struct Object ## type ## RegistrationClass                     \
+  {                                                                     \
+    Object ## type ## RegistrationClass ()                              \
+    {                                                                   \
+      ns3::TypeId tid = type::GetTypeId ();                             \
+      tid.GetParent ();                                                 \
+    }                                                                   \
+  } Object ## type ## RegistrationVariable
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Base of every class with a TypeId and attributes.
+ */
+class ObjectBase
+{
+public:
+  static TypeId GetTypeId (void);
+
+  virtual ~ObjectBase ();
+  /**
+   * \return the TypeId of the most derived type of this object
+   */
+  virtual TypeId GetInstanceTypeId (void) const = 0;
+  /**
+   * Set an attribute; aborts if it does not exist or value is invalid.
+   */
+  void SetAttribute (std::string name, const AttributeValue &value);
+  /**
+   * \return true if the attribute exists and value was accepted
+   */
+  bool SetAttributeFailSafe (std::string name, const AttributeValue &value);
+  /**
+   * Read an attribute; aborts if it does not exist or cannot be read.
+   */
+  void GetAttribute (std::string name, AttributeValue &value) const;
+
+protected:
+  /**
+   * Give every ATTR_CONSTRUCT attribute of the instance type and its
+   * parents its initial value.
+   */
+  void ConstructSelf (void);
+};
+
+} //namespace ns3
+
+#endif /* OBJECT_BASE_H */
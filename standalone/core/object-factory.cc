@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "object-factory.h"
+#include "abort.h"
+
+namespace ns3 {
+
+ObjectFactory::ObjectFactory ()
+{
+}
+
+ObjectFactory::ObjectFactory (std::string typeId)
+{
+  SetTypeId (typeId);
+}
+
+void
+ObjectFactory::SetTypeId (TypeId tid)
+{
+  m_tid = tid;
+}
+
+void
+ObjectFactory::SetTypeId (std::string tid)
+{
+  m_tid = TypeId::LookupByName (tid);
+}
+
+TypeId
+ObjectFactory::GetTypeId (void) const
+{
+  return m_tid;
+}
+
+void
+ObjectFactory::Set (std::string name, const AttributeValue &value)
+{
+  struct TypeId::AttributeInformation info;
+  NS_ABORT_MSG_UNLESS (m_tid.LookupAttributeByName (name, &info),
+                       "no attribute " << name << " in " << m_tid.GetName ());
+  m_parameters.push_back (std::make_pair (name, Ptr<const AttributeValue> (value.Copy ())));
+}
+
+Ptr<Object>
+ObjectFactory::Create (void) const
+{
+  ObjectBase *base = m_tid.CreateInstance ();
+  Object *object = dynamic_cast<Object *> (base);
+  NS_ABORT_MSG_IF (object == 0, m_tid.GetName () << " is not an Object");
+  Ptr<Object> p = Ptr<Object> (object, false);
+  p->Construct (m_tid);
+  for (size_t i = 0; i < m_parameters.size (); i++)
+    {
+      p->SetAttribute (m_parameters[i].first, *m_parameters[i].second);
+    }
+  return p;
+}
+
+} //namespace ns3
@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OBJECT_FACTORY_H
+#define OBJECT_FACTORY_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "object.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Creates objects of a TypeId chosen at run time, with attribute values
+ * applied after construction.
+ */
+class ObjectFactory
+{
+public:
+  ObjectFactory ();
+  /**
+   * \param typeId the name of the type to create
+   */
+  ObjectFactory (std::string typeId);
+
+  void SetTypeId (TypeId tid);
+  void SetTypeId (std::string tid);
+  TypeId GetTypeId (void) const;
+  /**
+   * Set an attribute of every object created from now on.
+   */
+  void Set (std::string name, const AttributeValue &value);
+  /**
+   * \return a new object; aborts if the type has no constructor
+   */
+  Ptr<Object> Create (void) const;
+  /**
+   * \return a new object cast to T
+   */
+  template <typename T>
+  Ptr<T> Create (void) const;
+
+private:
+  TypeId m_tid; //!< the type to create
+  std::vector<std::pair<std::string, Ptr<const AttributeValue> > > m_parameters; //!< attributes to set
+};
+
+template <typename T>
+Ptr<T>
+ObjectFactory::Create (void) const
+{
+  return DynamicCast<T> (Create ());
+}
+
+} //namespace ns3
+
+#endif /* OBJECT_FACTORY_H */
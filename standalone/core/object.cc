@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "object.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (Object);
+
+TypeId
+Object::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::Object")
+    .SetParent<ObjectBase> ()
+    .SetGroupName ("Core")
+  ;
+  return tid;
+}
+
+Object::Object ()
+  : m_tid (Object::GetTypeId ()),
+    m_initialized (false),
+    m_disposed (false)
+{
+}
+
+Object::~Object ()
+{
+}
+
+TypeId
+Object::GetInstanceTypeId (void) const
+{
+  return m_tid;
+}
+
+void
+Object::Construct (TypeId tid)
+{
+  m_tid = tid;
+  ConstructSelf ();
+}
+
+void
+Object::Initialize (void)
+{
+  if (!m_initialized)
+    {
+      m_initialized = true;
+      DoInitialize ();
+    }
+}
+
+void
+Object::Dispose (void)
+{
+  if (!m_disposed)
+    {
+      m_disposed = true;
+      DoDispose ();
+    }
+}
+
+void
+Object::DoInitialize (void)
+{
+}
+
+void
+Object::DoDispose (void)
+{
+}
+
+} //namespace ns3
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OBJECT_H
+#define OBJECT_H
+
+#include <utility>
+#include "ptr.h"
+#include "simple-ref-count.h"
+#include "object-base.h"
+#include "attribute.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * A reference-counted ObjectBase; create instances with CreateObject.
+ */
+class Object : public SimpleRefCount<Object, ObjectBase>
+{
+public:
+  static TypeId GetTypeId (void);
+
+  Object ();
+  virtual ~Object ();
+  virtual TypeId GetInstanceTypeId (void) const;
+  /**
+   * Run DoInitialize once.
+   */
+  void Initialize (void);
+  /**
+   * Run DoDispose once; the object should not be used afterwards.
+   */
+  void Dispose (void);
+
+protected:
+  virtual void DoInitialize (void);
+  virtual void DoDispose (void);
+
+private:
+  template <typename T, typename... Ts>
+  friend Ptr<T> CreateObject (Ts &&... args);
+  friend class ObjectFactory;
+
+  /**
+   * Record the instance type and give the attributes their initial values.
+   */
+  void Construct (TypeId tid);
+
+  TypeId m_tid;       //!< the most derived type of this object
+  bool m_initialized; //!< whether DoInitialize has run
+  bool m_disposed;    //!< whether DoDispose has run
+};
+
+/**
+ * \return a new T (args...) whose attributes have their initial values
+ */
+template <typename T, typename... Ts>
+Ptr<T>
+CreateObject (Ts &&... args)
+{
+  Ptr<T> p = Ptr<T> (new T (std::forward<Ts> (args)...), false);
+  p->Object::Construct (T::GetTypeId ());
+  return p;
+}
+
+} //namespace ns3
+
+#endif /* OBJECT_H */
@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PTR_H
+#define PTR_H
+
+#include <utility>
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's smart pointer to an object with Ref () / Unref ().
+ */
+template <typename T>
+class Ptr
+{
+public:
+  Ptr ()
+    : m_ptr (0)
+  {
+  }
+  /**
+   * \param ptr the object to point to; its reference count is incremented
+   */
+  Ptr (T *ptr)
+    : m_ptr (ptr)
+  {
+    Acquire ();
+  }
+  /**
+   * \param ptr the object to point to
+   * \param ref whether to increment its reference count
+   */
+  Ptr (T *ptr, bool ref)
+    : m_ptr (ptr)
+  {
+    if (ref)
+      {
+        Acquire ();
+      }
+  }
+  Ptr (const Ptr &o)
+    : m_ptr (o.m_ptr)
+  {
+    Acquire ();
+  }
+  template <typename U>
+  Ptr (const Ptr<U> &o)
+    : m_ptr (o.m_ptr)
+  {
+    Acquire ();
+  }
+  ~Ptr ()
+  {
+    if (m_ptr != 0)
+      {
+        m_ptr->Unref ();
+      }
+  }
+  Ptr & operator= (const Ptr &o)
+  {
+    if (o.m_ptr != 0)
+      {
+        o.m_ptr->Ref ();
+      }
+    if (m_ptr != 0)
+      {
+        m_ptr->Unref ();
+      }
+    m_ptr = o.m_ptr;
+    return *this;
+  }
+  T * operator-> () const
+  {
+    return m_ptr;
+  }
+  T & operator* () const
+  {
+    return *m_ptr;
+  }
+  bool operator! () const
+  {
+    return m_ptr == 0;
+  }
+  explicit operator bool () const
+  {
+    return m_ptr != 0;
+  }
+
+private:
+  template <typename U>
+  friend class Ptr;
+  template <typename U>
+  friend U * PeekPointer (const Ptr<U> &p);
+
+  void Acquire (void) const
+  {
+    if (m_ptr != 0)
+      {
+        m_ptr->Ref ();
+      }
+  }
+
+  T *m_ptr; //!< the object pointed to
+};
+
+/**
+ * \param p a Ptr
+ *
+ * \return the raw pointer held by p, without touching its reference count
+ */
+template <typename T>
+T *
+PeekPointer (const Ptr<T> &p)
+{
+  return p.m_ptr;
+}
+
+template <typename T1, typename T2>
+bool
+operator== (const Ptr<T1> &lhs, const Ptr<T2> &rhs)
+{
+  return PeekPointer (lhs) == PeekPointer (rhs);
+}
+
+template <typename T1, typename T2>
+bool
+operator!= (const Ptr<T1> &lhs, const Ptr<T2> &rhs)
+{
+  return PeekPointer (lhs) != PeekPointer (rhs);
+}
+
+/**
+ * \return p cast to Ptr<T1> with dynamic_cast, or a null Ptr
+ */
+template <typename T1, typename T2>
+Ptr<T1>
+DynamicCast (const Ptr<T2> &p)
+{
+  return Ptr<T1> (dynamic_cast<T1 *> (PeekPointer (p)));
+}
+
+/**
+ * Allocate a reference-counted object that is not an ns3::Object.
+ *
+ * \return a Ptr holding the only reference to a new T (args...)
+ */
+template <typename T, typename... Ts>
+Ptr<T>
+Create (Ts &&... args)
+{
+  return Ptr<T> (new T (std::forward<Ts> (args)...), false);
+}
+
+} //namespace ns3
+
+#endif /* PTR_H */
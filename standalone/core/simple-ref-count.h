@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SIMPLE_REF_COUNT_H
+#define SIMPLE_REF_COUNT_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * Empty parent of SimpleRefCount.
+ */
+class empty
+{
+};
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's intrusive, non-thread-safe reference count.
+ */
+template <typename T, typename PARENT = empty>
+class SimpleRefCount : public PARENT
+{
+public:
+  SimpleRefCount ()
+    : m_count (1)
+  {
+  }
+  SimpleRefCount (const SimpleRefCount &o)
+    : PARENT (o),
+      m_count (1)
+  {
+  }
+  SimpleRefCount & operator= (const SimpleRefCount &o)
+  {
+    return *this;
+  }
+  /**
+   * Increment the reference count.
+   */
+  void Ref (void) const
+  {
+    m_count++;
+  }
+  /**
+   * Decrement the reference count and delete the object when it reaches 0.
+   */
+  void Unref (void) const
+  {
+    m_count--;
+    if (m_count == 0)
+      {
+        delete static_cast<T *> (const_cast<SimpleRefCount *> (this));
+      }
+  }
+  /**
+   * \return the current reference count
+   */
+  uint32_t GetReferenceCount (void) const
+  {
+    return m_count;
+  }
+
+private:
+  mutable uint32_t m_count; //!< reference count
+};
+
+} //namespace ns3
+
+#endif /* SIMPLE_REF_COUNT_H */
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_STRING_H
+#define NS3_STRING_H
+
+#include <string>
+#include "attribute.h"
+#include "attribute-accessor-helper.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Holds a text attribute value.
+ */
+class StringValue : public AttributeValue
+{
+public:
+  StringValue (const std::string &value = "")
+    : m_value (value)
+  {
+  }
+  StringValue (const char *value)
+    : m_value (value)
+  {
+  }
+  void Set (const std::string &value)
+  {
+    m_value = value;
+  }
+  std::string Get (void) const
+  {
+    return m_value;
+  }
+  virtual Ptr<AttributeValue> Copy (void) const
+  {
+    return Ptr<AttributeValue> (new StringValue (*this), false);
+  }
+  virtual std::string SerializeToString (void) const
+  {
+    return m_value;
+  }
+  virtual bool DeserializeFromString (std::string value)
+  {
+    m_value = value;
+    return true;
+  }
+
+private:
+  std::string m_value; //!< the value
+};
+
+ATTRIBUTE_ACCESSOR_DEFINE (String);
+
+/**
+ * Checks that a value is a StringValue.
+ */
+class StringChecker : public AttributeChecker
+{
+public:
+  virtual bool Check (const AttributeValue &value) const
+  {
+    return dynamic_cast<const StringValue *> (&value) != 0;
+  }
+};
+
+inline Ptr<const AttributeChecker>
+MakeStringChecker (void)
+{
+  return Ptr<const AttributeChecker> (new StringChecker (), false);
+}
+
+} //namespace ns3
+
+#endif /* NS3_STRING_H */
@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <iostream>
+#include "test.h"
+
+namespace ns3 {
+
+TestCase::TestCase (std::string name)
+  : m_name (name),
+    m_parent (0)
+{
+}
+
+TestCase::~TestCase ()
+{
+  for (size_t i = 0; i < m_children.size (); i++)
+    {
+      delete m_children[i];
+    }
+}
+
+std::string
+TestCase::GetName (void) const
+{
+  return m_name;
+}
+
+void
+TestCase::AddTestCase (TestCase *testCase, enum TestDuration duration)
+{
+  testCase->m_parent = this;
+  m_children.push_back (testCase);
+}
+
+bool
+TestCase::IsStatusFailure (void) const
+{
+  if (!m_failures.empty ())
+    {
+      return true;
+    }
+  for (size_t i = 0; i < m_children.size (); i++)
+    {
+      if (m_children[i]->IsStatusFailure ())
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+TestCase::ReportTestFailure (std::string cond, std::string actual, std::string limit,
+                             std::string message, std::string file, int32_t line)
+{
+  std::ostringstream os;
+  os << "    " << file << ":" << line << ": " << cond << std::endl
+     << "      actual=" << actual << " limit=" << limit << std::endl
+     << "      " << message;
+  m_failures.push_back (os.str ());
+}
+
+void
+TestCase::Run (std::ostream &os, bool verbose)
+{
+  DoSetup ();
+  for (size_t i = 0; i < m_children.size (); i++)
+    {
+      m_children[i]->Run (os, verbose);
+    }
+  DoRun ();
+  DoTeardown ();
+  if (m_parent != 0 && (verbose || !m_failures.empty ()))
+    {
+      os << "  " << (m_failures.empty () ? "PASS " : "FAIL ") << m_name << std::endl;
+    }
+  for (size_t i = 0; i < m_failures.size (); i++)
+    {
+      os << m_failures[i] << std::endl;
+    }
+}
+
+void
+TestCase::DoSetup (void)
+{
+}
+
+void
+TestCase::DoTeardown (void)
+{
+}
+
+TestSuite::TestSuite (std::string name, enum Type type)
+  : TestCase (name),
+    m_type (type)
+{
+  GetTestSuites ().push_back (this);
+}
+
+enum TestSuite::Type
+TestSuite::GetTestType (void) const
+{
+  return m_type;
+}
+
+std::vector<TestSuite *> &
+TestSuite::GetTestSuites (void)
+{
+  static std::vector<TestSuite *> suites;
+  return suites;
+}
+
+void
+TestSuite::DoRun (void)
+{
+}
+
+} //namespace ns3
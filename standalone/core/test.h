@@ -0,0 +1,366 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_TEST_H
+#define NS3_TEST_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for an ns-3 test case: DoRun holds the checks, written with the
+ * NS_TEST_* macros, and child test cases run before it.
+ */
+class TestCase
+{
+public:
+  /**
+   * How long a test case takes to run.
+   */
+  enum TestDuration
+  {
+    QUICK = 1,         //!< seconds
+    EXTENSIVE = 2,     //!< minutes
+    TAKES_FOREVER = 3  //!< more
+  };
+
+  virtual ~TestCase ();
+  std::string GetName (void) const;
+  /**
+   * \return true if this test case or a child reported a failure
+   */
+  bool IsStatusFailure (void) const;
+  /**
+   * Run the test case and its children, reporting progress on os.
+   */
+  void Run (std::ostream &os, bool verbose);
+
+protected:
+  /**
+   * \param name the name of the test case
+   */
+  TestCase (std::string name);
+  /**
+   * Add a child test case, which this test case owns.
+   */
+  void AddTestCase (TestCase *testCase, enum TestDuration duration);
+  void ReportTestFailure (std::string cond, std::string actual, std::string limit,
+                          std::string message, std::string file, int32_t line);
+
+private:
+  virtual void DoSetup (void);
+  virtual void DoRun (void) = 0;
+  virtual void DoTeardown (void);
+
+  std::string m_name;                //!< test case name
+  std::vector<TestCase *> m_children; //!< child test cases
+  std::vector<std::string> m_failures; //!< failure reports
+  TestCase *m_parent;                //!< enclosing test case, or 0
+};
+
+/**
+ * \ingroup standalone
+ *
+ * A named collection of test cases, registered with the test runner
+ * when it is constructed.
+ */
+class TestSuite : public TestCase
+{
+public:
+  /**
+   * Kind of a test suite.
+   */
+  enum Type
+  {
+    ALL = 0,
+    BVT = 1,     //!< build verification test
+    UNIT,        //!< unit test
+    SYSTEM,      //!< system test
+    EXAMPLE,     //!< example
+    PERFORMANCE  //!< performance test
+  };
+
+  /**
+   * \param name the name of the suite, as given to --suite
+   * \param type the kind of suite
+   */
+  TestSuite (std::string name, enum Type type = UNIT);
+  enum Type GetTestType (void) const;
+
+  /**
+   * \return every registered test suite
+   */
+  static std::vector<TestSuite *> & GetTestSuites (void);
+
+private:
+  virtual void DoRun (void);
+
+  enum Type m_type; //!< kind of suite
+};
+
+} //namespace ns3
+
+#define NS_TEST_ASSERT_MSG_EQ(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) == (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) == " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_NE(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) != (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) != " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_LT(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) < (limit)))                                        \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) < " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_LT_OR_EQ(actual, limit, msg)                 \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) <= (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) <= " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_GT(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) > (limit)))                                        \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) > " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_GT_OR_EQ(actual, limit, msg)                 \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) >= (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) >= " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_ASSERT_MSG_EQ_TOL(actual, limit, tol, msg)              \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) <= (limit) + (tol) && (actual) >= (limit) - (tol))) \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) == " + std::string (#limit) + " (limit) +- " + std::string (#tol) + " (tol)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+          return;                                                       \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_EQ(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) == (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) == " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_NE(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) != (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) != " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_LT(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) < (limit)))                                        \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) < " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_LT_OR_EQ(actual, limit, msg)                 \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) <= (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) <= " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_GT(actual, limit, msg)                       \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) > (limit)))                                        \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) > " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_GT_OR_EQ(actual, limit, msg)                 \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) >= (limit)))                                       \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) >= " + std::string (#limit) + " (limit)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#define NS_TEST_EXPECT_MSG_EQ_TOL(actual, limit, tol, msg)              \
+  do                                                                    \
+    {                                                                   \
+      if (!((actual) <= (limit) + (tol) && (actual) >= (limit) - (tol))) \
+        {                                                               \
+          std::ostringstream msgStream;                                 \
+          msgStream << msg;                                             \
+          std::ostringstream actualStream;                              \
+          actualStream << actual;                                       \
+          std::ostringstream limitStream;                               \
+          limitStream << limit;                                         \
+          ReportTestFailure (std::string (#actual) + " (actual) == " + std::string (#limit) + " (limit) +- " + std::string (#tol) + " (tol)", actualStream.str (), limitStream.str (), \
+                             msgStream.str (), __FILE__, __LINE__);     \
+        }                                                               \
+    }                                                                   \
+  while (false)
+
+#endif /* NS3_TEST_H */
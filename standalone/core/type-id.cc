@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include "type-id.h"
+#include "abort.h"
+
+namespace ns3 {
+
+namespace {
+
+/**
+ * Everything known about one registered type.
+ */
+struct TypeInformation
+{
+  std::string name;                       //!< type name
+  std::string groupName;                  //!< group name
+  uint16_t parent;                        //!< index of the parent type
+  ObjectBase * (*constructor)(void);      //!< default constructor, or 0
+  std::vector<TypeId::AttributeInformation> attributes; //!< attributes
+};
+
+/**
+ * \return the registry; index 0 is an unnamed placeholder
+ */
+std::vector<TypeInformation> &
+GetRegistry (void)
+{
+  static std::vector<TypeInformation> registry (1);
+  return registry;
+}
+
+} //anonymous namespace
+
+TypeId::TypeId (const char *name)
+{
+  std::vector<TypeInformation> &registry = GetRegistry ();
+  for (size_t i = 1; i < registry.size (); i++)
+    {
+      NS_ABORT_MSG_IF (registry[i].name == name, "TypeId " << name << " already registered");
+    }
+  TypeInformation information;
+  information.name = name;
+  information.constructor = 0;
+  m_tid = static_cast<uint16_t> (registry.size ());
+  information.parent = m_tid;
+  registry.push_back (information);
+}
+
+TypeId::TypeId ()
+  : m_tid (0)
+{
+}
+
+TypeId
+TypeId::LookupByName (std::string name)
+{
+  TypeId tid;
+  NS_ABORT_MSG_UNLESS (LookupByNameFailSafe (name, &tid), "no TypeId " << name);
+  return tid;
+}
+
+bool
+TypeId::LookupByNameFailSafe (std::string name, TypeId *tid)
+{
+  std::vector<TypeInformation> &registry = GetRegistry ();
+  for (size_t i = 1; i < registry.size (); i++)
+    {
+      if (registry[i].name == name)
+        {
+          tid->m_tid = static_cast<uint16_t> (i);
+          return true;
+        }
+    }
+  return false;
+}
+
+TypeId
+TypeId::SetParent (TypeId tid)
+{
+  GetRegistry ()[m_tid].parent = tid.m_tid;
+  return *this;
+}
+
+TypeId
+TypeId::SetGroupName (std::string groupName)
+{
+  GetRegistry ()[m_tid].groupName = groupName;
+  return *this;
+}
+
+TypeId
+TypeId::DoAddConstructor (ObjectBase * (*constructor)(void))
+{
+  GetRegistry ()[m_tid].constructor = constructor;
+  return *this;
+}
+
+TypeId
+TypeId::AddAttribute (std::string name, std::string help,
+                      const AttributeValue &initialValue,
+                      Ptr<const AttributeAccessor> accessor,
+                      Ptr<const AttributeChecker> checker)
+{
+  return AddAttribute (name, help, ATTR_SGC, initialValue, accessor, checker);
+}
+
+TypeId
+TypeId::AddAttribute (std::string name, std::string help, uint32_t flags,
+                      const AttributeValue &initialValue,
+                      Ptr<const AttributeAccessor> accessor,
+                      Ptr<const AttributeChecker> checker)
+{
+  struct AttributeInformation info;
+  NS_ABORT_MSG_IF (LookupAttributeByName (name, &info),
+                   "attribute " << name << " already exists in " << GetName ());
+  NS_ABORT_MSG_UNLESS (checker->Check (initialValue),
+                       "invalid initial value of attribute " << name);
+  info.name = name;
+  info.help = help;
+  info.flags = flags;
+  info.initialValue = initialValue.Copy ();
+  info.accessor = accessor;
+  info.checker = checker;
+  GetRegistry ()[m_tid].attributes.push_back (info);
+  return *this;
+}
+
+std::string
+TypeId::GetName (void) const
+{
+  return GetRegistry ()[m_tid].name;
+}
+
+std::string
+TypeId::GetGroupName (void) const
+{
+  return GetRegistry ()[m_tid].groupName;
+}
+
+TypeId
+TypeId::GetParent (void) const
+{
+  TypeId parent;
+  parent.m_tid = GetRegistry ()[m_tid].parent;
+  return parent;
+}
+
+bool
+TypeId::IsChildOf (TypeId other) const
+{
+  TypeId tid = *this;
+  while (tid != other && tid.GetParent () != tid)
+    {
+      tid = tid.GetParent ();
+    }
+  return tid == other;
+}
+
+bool
+TypeId::HasConstructor (void) const
+{
+  return GetRegistry ()[m_tid].constructor != 0;
+}
+
+ObjectBase *
+TypeId::CreateInstance (void) const
+{
+  NS_ABORT_MSG_UNLESS (HasConstructor (), "TypeId " << GetName () << " has no constructor");
+  return GetRegistry ()[m_tid].constructor ();
+}
+
+size_t
+TypeId::GetAttributeN (void) const
+{
+  return GetRegistry ()[m_tid].attributes.size ();
+}
+
+struct TypeId::AttributeInformation
+TypeId::GetAttribute (size_t i) const
+{
+  return GetRegistry ()[m_tid].attributes[i];
+}
+
+bool
+TypeId::LookupAttributeByName (std::string name, struct AttributeInformation *info) const
+{
+  TypeId tid = *this;
+  while (true)
+    {
+      for (size_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          if (tid.GetAttribute (i).name == name)
+            {
+              *info = tid.GetAttribute (i);
+              return true;
+            }
+        }
+      if (tid.GetParent () == tid)
+        {
+          return false;
+        }
+      tid = tid.GetParent ();
+    }
+}
+
+uint16_t
+TypeId::GetUid (void) const
+{
+  return m_tid;
+}
+
+bool
+operator== (TypeId a, TypeId b)
+{
+  return a.m_tid == b.m_tid;
+}
+
+bool
+operator!= (TypeId a, TypeId b)
+{
+  return a.m_tid != b.m_tid;
+}
+
+bool
+operator< (TypeId a, TypeId b)
+{
+  return a.m_tid < b.m_tid;
+}
+
+} //namespace ns3
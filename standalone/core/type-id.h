@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TYPE_ID_H
+#define TYPE_ID_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include "attribute.h"
+#include "ptr.h"
+
+namespace ns3 {
+
+class ObjectBase;
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's run-time type information: a name, a parent, an
+ * optional default constructor and a list of attributes per type.
+ */
+class TypeId
+{
+public:
+  /**
+   * Flags of an attribute.
+   */
+  enum AttributeFlag
+  {
+    ATTR_GET = 1 << 0,       //!< the attribute can be read
+    ATTR_SET = 1 << 1,       //!< the attribute can be written
+    ATTR_CONSTRUCT = 1 << 2, //!< the attribute is set at construction
+    ATTR_SGC = ATTR_GET | ATTR_SET | ATTR_CONSTRUCT //!< all of the above
+  };
+
+  /**
+   * Description of one attribute.
+   */
+  struct AttributeInformation
+  {
+    std::string name;                         //!< attribute name
+    std::string help;                         //!< attribute help text
+    uint32_t flags;                           //!< AttributeFlag bits
+    Ptr<const AttributeValue> initialValue;   //!< value set at construction
+    Ptr<const AttributeAccessor> accessor;    //!< reads and writes the attribute
+    Ptr<const AttributeChecker> checker;      //!< validates new values
+  };
+
+  /**
+   * Register a new type; aborts if name is already registered.
+   *
+   * \param name the name of the type
+   */
+  explicit TypeId (const char *name);
+  TypeId ();
+
+  /**
+   * \param name the name of a registered type
+   *
+   * \return that type; aborts if there is none
+   */
+  static TypeId LookupByName (std::string name);
+  /**
+   * \param name the name of a type
+   * \param tid set to that type if it is registered
+   *
+   * \return true if the type is registered
+   */
+  static bool LookupByNameFailSafe (std::string name, TypeId *tid);
+
+  TypeId SetParent (TypeId tid);
+  template <typename T>
+  TypeId SetParent (void);
+  TypeId SetGroupName (std::string groupName);
+  template <typename T>
+  TypeId AddConstructor (void);
+  TypeId AddAttribute (std::string name, std::string help,
+                       const AttributeValue &initialValue,
+                       Ptr<const AttributeAccessor> accessor,
+                       Ptr<const AttributeChecker> checker);
+  TypeId AddAttribute (std::string name, std::string help, uint32_t flags,
+                       const AttributeValue &initialValue,
+                       Ptr<const AttributeAccessor> accessor,
+                       Ptr<const AttributeChecker> checker);
+
+  std::string GetName (void) const;
+  std::string GetGroupName (void) const;
+  TypeId GetParent (void) const;
+  /**
+   * \return true if this type is other or derives from it
+   */
+  bool IsChildOf (TypeId other) const;
+  bool HasConstructor (void) const;
+  /**
+   * \return a new default-constructed instance; aborts if the type has
+   *         no constructor
+   */
+  ObjectBase * CreateInstance (void) const;
+  size_t GetAttributeN (void) const;
+  struct AttributeInformation GetAttribute (size_t i) const;
+  /**
+   * Look an attribute up in this type and its parents.
+   *
+   * \return true if found, with info filled in
+   */
+  bool LookupAttributeByName (std::string name, struct AttributeInformation *info) const;
+  uint16_t GetUid (void) const;
+
+private:
+  friend bool operator== (TypeId a, TypeId b);
+  friend bool operator!= (TypeId a, TypeId b);
+  friend bool operator< (TypeId a, TypeId b);
+
+  TypeId DoAddConstructor (ObjectBase * (*constructor)(void));
+  template <typename T>
+  static ObjectBase * Construct (void);
+
+  uint16_t m_tid; //!< index of the type in the registry
+};
+
+bool operator== (TypeId a, TypeId b);
+bool operator!= (TypeId a, TypeId b);
+bool operator< (TypeId a, TypeId b);
+
+template <typename T>
+TypeId
+TypeId::SetParent (void)
+{
+  return SetParent (T::GetTypeId ());
+}
+
+template <typename T>
+ObjectBase *
+TypeId::Construct (void)
+{
+  return new T ();
+}
+
+template <typename T>
+TypeId
+TypeId::AddConstructor (void)
+{
+  return DoAddConstructor (&TypeId::Construct<T>);
+}
+
+} //namespace ns3
+
+#endif /* TYPE_ID_H */
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef UINTEGER_H
+#define UINTEGER_H
+
+#include <stdint.h>
+#include <limits>
+#include <sstream>
+#include "attribute.h"
+#include "attribute-accessor-helper.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Holds an unsigned integer attribute value.
+ */
+class UintegerValue : public AttributeValue
+{
+public:
+  UintegerValue (uint64_t value = 0)
+    : m_value (value)
+  {
+  }
+  void Set (uint64_t value)
+  {
+    m_value = value;
+  }
+  uint64_t Get (void) const
+  {
+    return m_value;
+  }
+  virtual Ptr<AttributeValue> Copy (void) const
+  {
+    return Ptr<AttributeValue> (new UintegerValue (*this), false);
+  }
+  virtual std::string SerializeToString (void) const
+  {
+    std::ostringstream os;
+    os << m_value;
+    return os.str ();
+  }
+  virtual bool DeserializeFromString (std::string value)
+  {
+    std::istringstream is (value);
+    is >> m_value;
+    return !is.fail () && is.eof ();
+  }
+
+private:
+  uint64_t m_value; //!< the value
+};
+
+ATTRIBUTE_ACCESSOR_DEFINE (Uinteger);
+
+/**
+ * Checks that a UintegerValue lies in [min, max].
+ */
+class UintegerChecker : public AttributeChecker
+{
+public:
+  UintegerChecker (uint64_t min, uint64_t max)
+    : m_min (min),
+      m_max (max)
+  {
+  }
+  virtual bool Check (const AttributeValue &value) const
+  {
+    const UintegerValue *v = dynamic_cast<const UintegerValue *> (&value);
+    return v != 0 && v->Get () >= m_min && v->Get () <= m_max;
+  }
+
+private:
+  uint64_t m_min; //!< smallest accepted value
+  uint64_t m_max; //!< largest accepted value
+};
+
+template <typename T>
+Ptr<const AttributeChecker>
+MakeUintegerChecker (uint64_t min = std::numeric_limits<T>::min (),
+                     uint64_t max = std::numeric_limits<T>::max ())
+{
+  return Ptr<const AttributeChecker> (new UintegerChecker (min, max), false);
+}
+
+} //namespace ns3
+
+#endif /* UINTEGER_H */
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include "dsss-error-rate-model.h"
+
+namespace ns3 {
+
+/// SINR above which CCK chunks never fail
+static const double WLAN_SIR_PERFECT = 10.0;
+/// SINR below which CCK chunks always fail
+static const double WLAN_SIR_IMPOSSIBLE = 0.1;
+
+double
+DsssErrorRateModel::DqpskFunction (double x)
+{
+  return ((std::sqrt (2.0) + 1.0) / std::sqrt (8.0 * 3.1415926 * std::sqrt (2.0)))
+         * (1.0 / std::sqrt (x)) * std::exp ( -(2.0 - std::sqrt (2.0)) * x);
+}
+
+double
+DsssErrorRateModel::GetDsssDbpskSuccessRate (double sinr, uint32_t nbits)
+{
+  double EbN0 = sinr * 22000000.0 / 1000000.0; //1 bit per symbol with 1 MSPS
+  double ber = 0.5 * std::exp (-EbN0);
+  return std::pow ((1.0 - ber), static_cast<double> (nbits));
+}
+
+double
+DsssErrorRateModel::GetDsssDqpskSuccessRate (double sinr, uint32_t nbits)
+{
+  double EbN0 = sinr * 22000000.0 / 1000000.0 / 2.0; //2 bits per symbol, 1 MSPS
+  double ber = DqpskFunction (EbN0);
+  return std::pow ((1.0 - ber), static_cast<double> (nbits));
+}
+
+double
+DsssErrorRateModel::GetDsssDqpskCck5_5SuccessRate (double sinr, uint32_t nbits)
+{
+  double ber;
+  if (sinr > WLAN_SIR_PERFECT)
+    {
+      ber = 0.0;
+    }
+  else if (sinr < WLAN_SIR_IMPOSSIBLE)
+    {
+      ber = 0.5;
+    }
+  else
+    {
+      //fitprob.py
+      double a1 = 5.3681634344056195e-001;
+      double a2 = 3.3092430025608586e-003;
+      double a3 = 4.1654372361004000e-001;
+      double a4 = 1.0288981434358866e+000;
+      ber = a1 * std::exp (-std::pow ((sinr - a2) / a3, a4));
+    }
+  return std::pow ((1.0 - ber), static_cast<double> (nbits));
+}
+
+double
+DsssErrorRateModel::GetDsssDqpskCck11SuccessRate (double sinr, uint32_t nbits)
+{
+  double ber;
+  if (sinr > WLAN_SIR_PERFECT)
+    {
+      ber = 0.0;
+    }
+  else if (sinr < WLAN_SIR_IMPOSSIBLE)
+    {
+      ber = 0.5;
+    }
+  else
+    {
+      //fitprob.py
+      double a1 = 7.9056742265333456e-003;
+      double a2 = -1.8397449399176302e-001;
+      double a3 = 1.0740689468707241e+000;
+      double a4 = 1.0523316904502553e+000;
+      double a5 = 3.0552298746496687e-001;
+      double a6 = 2.2032715128698435e+000;
+      ber = (a1 * sinr * sinr + a2 * sinr + a3) / (sinr * sinr * sinr + a4 * sinr * sinr + a5 * sinr + a6);
+    }
+  return std::pow ((1.0 - ber), static_cast<double> (nbits));
+}
+
+} //namespace ns3
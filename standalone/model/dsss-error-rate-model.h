@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DSSS_ERROR_RATE_MODEL_H
+#define DSSS_ERROR_RATE_MODEL_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's 802.11b error rate formulas, without the GSL
+ * integration: CCK uses the curve fits ns-3 falls back to when it is
+ * built without GSL.
+ */
+class DsssErrorRateModel
+{
+public:
+  /**
+   * \param x the Eb/N0 (ratio)
+   *
+   * \return the DQPSK bit error rate approximation
+   */
+  static double DqpskFunction (double x);
+  /**
+   * \param sinr the SINR of the chunk
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the chunk success rate of DBPSK (1 Mbps)
+   */
+  static double GetDsssDbpskSuccessRate (double sinr, uint32_t nbits);
+  /**
+   * \copydoc GetDsssDbpskSuccessRate
+   * (DQPSK, 2 Mbps)
+   */
+  static double GetDsssDqpskSuccessRate (double sinr, uint32_t nbits);
+  /**
+   * \copydoc GetDsssDbpskSuccessRate
+   * (CCK, 5.5 Mbps)
+   */
+  static double GetDsssDqpskCck5_5SuccessRate (double sinr, uint32_t nbits);
+  /**
+   * \copydoc GetDsssDbpskSuccessRate
+   * (CCK, 11 Mbps)
+   */
+  static double GetDsssDqpskCck11SuccessRate (double sinr, uint32_t nbits);
+};
+
+} //namespace ns3
+
+#endif /* DSSS_ERROR_RATE_MODEL_H */
@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ERROR_RATE_MODEL_H
+#define ERROR_RATE_MODEL_H
+
+#include <stdint.h>
+#include "wifi-mode.h"
+#include "wifi-tx-vector.h"
+#include "ns3/object.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's base class of the wifi error rate models.
+ */
+class ErrorRateModel : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  /**
+   * \param txVector the TXVECTOR; its mode is used
+   * \param ber the target bit error rate
+   *
+   * \return the SNR (ratio) at which a 1-bit chunk fails with ber, found
+   *         by bisection over GetChunkSuccessRate
+   */
+  double CalculateSnr (WifiTxVector txVector, double ber) const;
+
+  /**
+   * \param mode the WifiMode of the chunk
+   * \param txVector the TXVECTOR of the transmission
+   * \param snr the SNR of the chunk (ratio, not dB)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the probability that the chunk is received without error
+   */
+  virtual double GetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const = 0;
+};
+
+} //namespace ns3
+
+#endif /* ERROR_RATE_MODEL_H */
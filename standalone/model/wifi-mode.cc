@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include "wifi-mode.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+namespace {
+
+/**
+ * Description of one WifiMode.
+ */
+struct WifiModeItem
+{
+  std::string uniqueName;        //!< name
+  WifiModulationClass modClass;  //!< modulation class
+  WifiCodeRate codingRate;       //!< code rate
+  uint16_t constellationSize;    //!< constellation size
+  uint64_t dataRate;             //!< 20 MHz single stream data rate (bit/s)
+};
+
+/**
+ * \return the modes by UID; UID 0 is the invalid mode
+ */
+std::vector<WifiModeItem> &
+GetModes (void)
+{
+  static std::vector<WifiModeItem> modes (1, WifiModeItem ());
+  return modes;
+}
+
+const WifiModeItem &
+GetItem (uint32_t uid)
+{
+  std::vector<WifiModeItem> &modes = GetModes ();
+  NS_ABORT_MSG_IF (uid >= modes.size (), "invalid WifiMode UID " << uid);
+  return modes[uid];
+}
+
+} //anonymous namespace
+
+WifiMode::WifiMode ()
+  : m_uid (0)
+{
+}
+
+WifiMode::WifiMode (uint32_t uid)
+  : m_uid (uid)
+{
+}
+
+uint64_t
+WifiMode::GetDataRate (uint16_t channelWidth, uint16_t guardInterval, uint8_t nss) const
+{
+  return GetItem (m_uid).dataRate;
+}
+
+WifiCodeRate
+WifiMode::GetCodeRate (void) const
+{
+  return GetItem (m_uid).codingRate;
+}
+
+uint16_t
+WifiMode::GetConstellationSize (void) const
+{
+  return GetItem (m_uid).constellationSize;
+}
+
+std::string
+WifiMode::GetUniqueName (void) const
+{
+  return GetItem (m_uid).uniqueName;
+}
+
+uint32_t
+WifiMode::GetUid (void) const
+{
+  return m_uid;
+}
+
+WifiModulationClass
+WifiMode::GetModulationClass (void) const
+{
+  return GetItem (m_uid).modClass;
+}
+
+bool
+operator== (const WifiMode &a, const WifiMode &b)
+{
+  return a.GetUid () == b.GetUid ();
+}
+
+bool
+operator!= (const WifiMode &a, const WifiMode &b)
+{
+  return a.GetUid () != b.GetUid ();
+}
+
+std::ostream &
+operator<< (std::ostream &os, const WifiMode &mode)
+{
+  os << mode.GetUniqueName ();
+  return os;
+}
+
+WifiMode
+WifiModeFactory::CreateWifiMode (std::string uniqueName, WifiModulationClass modClass,
+                                 WifiCodeRate codingRate, uint16_t constellationSize,
+                                 uint64_t dataRate)
+{
+  std::vector<WifiModeItem> &modes = GetModes ();
+  for (uint32_t uid = 1; uid < modes.size (); uid++)
+    {
+      NS_ABORT_MSG_IF (modes[uid].uniqueName == uniqueName, "WifiMode " << uniqueName << " already exists");
+    }
+  WifiModeItem item;
+  item.uniqueName = uniqueName;
+  item.modClass = modClass;
+  item.codingRate = codingRate;
+  item.constellationSize = constellationSize;
+  item.dataRate = dataRate;
+  modes.push_back (item);
+  return WifiMode (modes.size () - 1);
+}
+
+} //namespace ns3
@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_MODE_H
+#define WIFI_MODE_H
+
+#include <stdint.h>
+#include <ostream>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * Modulation class of a WifiMode.
+ */
+enum WifiModulationClass
+{
+  WIFI_MOD_CLASS_UNKNOWN = 0, //!< unknown
+  WIFI_MOD_CLASS_IR,          //!< infrared (802.11 clause 16)
+  WIFI_MOD_CLASS_FHSS,        //!< frequency hopping (802.11 clause 14)
+  WIFI_MOD_CLASS_DSSS,        //!< DSSS (802.11 clause 15)
+  WIFI_MOD_CLASS_HR_DSSS,     //!< HR/DSSS (802.11b clause 16)
+  WIFI_MOD_CLASS_ERP_PBCC,    //!< ERP-PBCC
+  WIFI_MOD_CLASS_DSSS_OFDM,   //!< DSSS-OFDM
+  WIFI_MOD_CLASS_ERP_OFDM,    //!< ERP-OFDM (802.11g clause 19)
+  WIFI_MOD_CLASS_OFDM,        //!< OFDM (802.11a/p clause 17)
+  WIFI_MOD_CLASS_HT,          //!< HT (802.11n clause 20)
+  WIFI_MOD_CLASS_VHT          //!< VHT (802.11ac clause 22)
+};
+
+/**
+ * Forward error correction code rate of a WifiMode.
+ */
+enum WifiCodeRate
+{
+  WIFI_CODE_RATE_UNDEFINED, //!< no explicit coding (DSSS)
+  WIFI_CODE_RATE_3_4,       //!< rate 3/4
+  WIFI_CODE_RATE_2_3,       //!< rate 2/3
+  WIFI_CODE_RATE_1_2,       //!< rate 1/2
+  WIFI_CODE_RATE_5_6        //!< rate 5/6
+};
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's WifiMode: a handle, by UID, to an immutable mode
+ * description kept by WifiModeFactory.
+ */
+class WifiMode
+{
+public:
+  /**
+   * Create an invalid mode.
+   */
+  WifiMode ();
+
+  /**
+   * \param channelWidth the channel width in MHz
+   * \param guardInterval the guard interval in ns
+   * \param nss the number of spatial streams
+   *
+   * \return the data rate in bit/s; the stand-in ignores the arguments
+   *         and returns the rate of a 20 MHz, single stream channel
+   */
+  uint64_t GetDataRate (uint16_t channelWidth, uint16_t guardInterval, uint8_t nss) const;
+  WifiCodeRate GetCodeRate (void) const;
+  uint16_t GetConstellationSize (void) const;
+  std::string GetUniqueName (void) const;
+  uint32_t GetUid (void) const;
+  WifiModulationClass GetModulationClass (void) const;
+
+private:
+  friend class WifiModeFactory;
+
+  /**
+   * \param uid the UID of the mode in the factory
+   */
+  WifiMode (uint32_t uid);
+
+  uint32_t m_uid; //!< UID of the mode in the factory
+};
+
+bool operator== (const WifiMode &a, const WifiMode &b);
+bool operator!= (const WifiMode &a, const WifiMode &b);
+std::ostream & operator<< (std::ostream &os, const WifiMode &mode);
+
+/**
+ * \ingroup standalone
+ *
+ * Creates and describes the WifiModes; UIDs are assigned in creation order.
+ */
+class WifiModeFactory
+{
+public:
+  /**
+   * \param uniqueName the name of the mode
+   * \param modClass its modulation class
+   * \param codingRate its code rate
+   * \param constellationSize its constellation size
+   * \param dataRate its 20 MHz, single stream data rate in bit/s
+   *
+   * \return the new mode
+   */
+  static WifiMode CreateWifiMode (std::string uniqueName, WifiModulationClass modClass,
+                                  WifiCodeRate codingRate, uint16_t constellationSize,
+                                  uint64_t dataRate);
+};
+
+} //namespace ns3
+
+#endif /* WIFI_MODE_H */
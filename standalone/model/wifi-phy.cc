@@ -0,0 +1,507 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "wifi-phy.h"
+
+namespace ns3 {
+
+WifiMode
+WifiPhy::GetDsssRate1Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("DsssRate1Mbps", WIFI_MOD_CLASS_DSSS,
+                                     WIFI_CODE_RATE_UNDEFINED, 2, 1000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetDsssRate2Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("DsssRate2Mbps", WIFI_MOD_CLASS_DSSS,
+                                     WIFI_CODE_RATE_UNDEFINED, 4, 2000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetDsssRate5_5Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("DsssRate5_5Mbps", WIFI_MOD_CLASS_HR_DSSS,
+                                     WIFI_CODE_RATE_UNDEFINED, 16, 5500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetDsssRate11Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("DsssRate11Mbps", WIFI_MOD_CLASS_HR_DSSS,
+                                     WIFI_CODE_RATE_UNDEFINED, 256, 11000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate6Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate6Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_1_2, 2, 6000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate9Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate9Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_3_4, 2, 9000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate12Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate12Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_1_2, 4, 12000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate18Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate18Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_3_4, 4, 18000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate24Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate24Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_1_2, 16, 24000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate36Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate36Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_3_4, 16, 36000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate48Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate48Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_2_3, 64, 48000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetErpOfdmRate54Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("ErpOfdmRate54Mbps", WIFI_MOD_CLASS_ERP_OFDM,
+                                     WIFI_CODE_RATE_3_4, 64, 54000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate6Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate6Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 2, 6000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate9Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate9Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 2, 9000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate12Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate12Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 4, 12000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate18Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate18Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 4, 18000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate24Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate24Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 16, 24000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate36Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate36Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 16, 36000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate48Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate48Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_2_3, 64, 48000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate54Mbps (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate54Mbps", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 64, 54000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate3MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate3MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 2, 3000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate4_5MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate4_5MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 2, 4500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate6MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate6MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 4, 6000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate9MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate9MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 4, 9000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate12MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate12MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 16, 12000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate18MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate18MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 16, 18000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate24MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate24MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_2_3, 64, 24000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate27MbpsBW10MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate27MbpsBW10MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 64, 27000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate1_5MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate1_5MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 2, 1500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate2_25MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate2_25MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 2, 2250000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate3MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate3MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 4, 3000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate4_5MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate4_5MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 4, 4500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate6MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate6MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_1_2, 16, 6000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate9MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate9MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 16, 9000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate12MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate12MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_2_3, 64, 12000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetOfdmRate13_5MbpsBW5MHz (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("OfdmRate13_5MbpsBW5MHz", WIFI_MOD_CLASS_OFDM,
+                                     WIFI_CODE_RATE_3_4, 64, 13500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs0 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs0", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_1_2, 2, 6500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs1 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs1", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_1_2, 4, 13000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs2 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs2", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_3_4, 4, 19500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs3 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs3", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_1_2, 16, 26000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs4 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs4", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_3_4, 16, 39000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs5 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs5", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_2_3, 64, 52000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs6 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs6", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_3_4, 64, 58500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetHtMcs7 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("HtMcs7", WIFI_MOD_CLASS_HT,
+                                     WIFI_CODE_RATE_5_6, 64, 65000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs0 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs0", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_1_2, 2, 6500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs1 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs1", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_1_2, 4, 13000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs2 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs2", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_3_4, 4, 19500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs3 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs3", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_1_2, 16, 26000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs4 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs4", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_3_4, 16, 39000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs5 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs5", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_2_3, 64, 52000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs6 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs6", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_3_4, 64, 58500000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs7 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs7", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_5_6, 64, 65000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs8 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs8", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_3_4, 256, 78000000);
+  return mode;
+}
+
+WifiMode
+WifiPhy::GetVhtMcs9 (void)
+{
+  static WifiMode mode =
+    WifiModeFactory::CreateWifiMode ("VhtMcs9", WIFI_MOD_CLASS_VHT,
+                                     WIFI_CODE_RATE_5_6, 256, 86700000);
+  return mode;
+}
+
+} //namespace ns3
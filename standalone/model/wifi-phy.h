@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_PHY_H
+#define WIFI_PHY_H
+
+#include "wifi-mode.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's WifiPhy, reduced to the 802.11a/b/g/p, HT and VHT
+ * WifiMode getters.  HT and VHT modes are created once, not per channel
+ * width or stream count.
+ */
+class WifiPhy
+{
+public:
+  static WifiMode GetDsssRate1Mbps (void);
+  static WifiMode GetDsssRate2Mbps (void);
+  static WifiMode GetDsssRate5_5Mbps (void);
+  static WifiMode GetDsssRate11Mbps (void);
+  static WifiMode GetErpOfdmRate6Mbps (void);
+  static WifiMode GetErpOfdmRate9Mbps (void);
+  static WifiMode GetErpOfdmRate12Mbps (void);
+  static WifiMode GetErpOfdmRate18Mbps (void);
+  static WifiMode GetErpOfdmRate24Mbps (void);
+  static WifiMode GetErpOfdmRate36Mbps (void);
+  static WifiMode GetErpOfdmRate48Mbps (void);
+  static WifiMode GetErpOfdmRate54Mbps (void);
+  static WifiMode GetOfdmRate6Mbps (void);
+  static WifiMode GetOfdmRate9Mbps (void);
+  static WifiMode GetOfdmRate12Mbps (void);
+  static WifiMode GetOfdmRate18Mbps (void);
+  static WifiMode GetOfdmRate24Mbps (void);
+  static WifiMode GetOfdmRate36Mbps (void);
+  static WifiMode GetOfdmRate48Mbps (void);
+  static WifiMode GetOfdmRate54Mbps (void);
+  static WifiMode GetOfdmRate3MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate4_5MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate6MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate9MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate12MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate18MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate24MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate27MbpsBW10MHz (void);
+  static WifiMode GetOfdmRate1_5MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate2_25MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate3MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate4_5MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate6MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate9MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate12MbpsBW5MHz (void);
+  static WifiMode GetOfdmRate13_5MbpsBW5MHz (void);
+  static WifiMode GetHtMcs0 (void);
+  static WifiMode GetHtMcs1 (void);
+  static WifiMode GetHtMcs2 (void);
+  static WifiMode GetHtMcs3 (void);
+  static WifiMode GetHtMcs4 (void);
+  static WifiMode GetHtMcs5 (void);
+  static WifiMode GetHtMcs6 (void);
+  static WifiMode GetHtMcs7 (void);
+  static WifiMode GetVhtMcs0 (void);
+  static WifiMode GetVhtMcs1 (void);
+  static WifiMode GetVhtMcs2 (void);
+  static WifiMode GetVhtMcs3 (void);
+  static WifiMode GetVhtMcs4 (void);
+  static WifiMode GetVhtMcs5 (void);
+  static WifiMode GetVhtMcs6 (void);
+  static WifiMode GetVhtMcs7 (void);
+  static WifiMode GetVhtMcs8 (void);
+  static WifiMode GetVhtMcs9 (void);
+};
+
+} //namespace ns3
+
+#endif /* WIFI_PHY_H */
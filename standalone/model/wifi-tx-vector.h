@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_TX_VECTOR_H
+#define WIFI_TX_VECTOR_H
+
+#include <stdint.h>
+#include "wifi-mode.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup standalone
+ *
+ * Stand-in for ns-3's TXVECTOR: the mode, channel width, guard interval
+ * and number of spatial streams of a transmission.  The tanh error
+ * models only read it to compute data rates.
+ */
+class WifiTxVector
+{
+public:
+  WifiTxVector ()
+    : m_channelWidth (20),
+      m_guardInterval (800),
+      m_nss (1)
+  {
+  }
+  WifiMode GetMode (void) const
+  {
+    return m_mode;
+  }
+  void SetMode (WifiMode mode)
+  {
+    m_mode = mode;
+  }
+  uint16_t GetChannelWidth (void) const
+  {
+    return m_channelWidth;
+  }
+  void SetChannelWidth (uint16_t channelWidth)
+  {
+    m_channelWidth = channelWidth;
+  }
+  uint16_t GetGuardInterval (void) const
+  {
+    return m_guardInterval;
+  }
+  void SetGuardInterval (uint16_t guardInterval)
+  {
+    m_guardInterval = guardInterval;
+  }
+  uint8_t GetNss (void) const
+  {
+    return m_nss;
+  }
+  void SetNss (uint8_t nss)
+  {
+    m_nss = nss;
+  }
+
+private:
+  WifiMode m_mode;         //!< the mode of the transmission
+  uint16_t m_channelWidth; //!< the channel width (MHz)
+  uint16_t m_guardInterval; //!< the guard interval (ns)
+  uint8_t m_nss;           //!< the number of spatial streams
+};
+
+} //namespace ns3
+
+#endif /* WIFI_TX_VECTOR_H */
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Runs the test suites linked into it, like ns-3's test.py / test-runner.
+//
+//   test-runner [--suite=name] [--list] [--verbose]
+//
+// The exit status is 0 if every suite that ran passed.
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ns3/command-line.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+int
+main (int argc, char *argv[])
+{
+  std::string suite;
+  bool list = false;
+  bool verbose = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("suite", "Run only the named test suite", suite);
+  cmd.AddValue ("list", "List the test suites and exit", list);
+  cmd.AddValue ("verbose", "Report every test case, not only failures", verbose);
+  cmd.Parse (argc, argv);
+
+  std::vector<TestSuite *> &suites = TestSuite::GetTestSuites ();
+  bool found = false;
+  bool failed = false;
+  for (size_t i = 0; i < suites.size (); i++)
+    {
+      if (list)
+        {
+          std::cout << suites[i]->GetName () << std::endl;
+          continue;
+        }
+      if (suite != "" && suites[i]->GetName () != suite)
+        {
+          continue;
+        }
+      found = true;
+      suites[i]->Run (std::cout, verbose);
+      bool suiteFailed = suites[i]->IsStatusFailure ();
+      std::cout << (suiteFailed ? "FAIL: " : "PASS: ") << "TestSuite "
+                << suites[i]->GetName () << std::endl;
+      failed = failed || suiteFailed;
+    }
+  if (!list && !found)
+    {
+      std::cerr << "no test suite " << suite << std::endl;
+      return 1;
+    }
+  return failed ? 1 : 0;
+}
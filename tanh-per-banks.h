@@ -0,0 +1,392 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_BANKS_H
+#define TANH_PER_BANKS_H
+
+#include "tanh-per-coefficients.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The coefficient bank of ErrorRateModelN as a compile-time constant, so
+ * that code specialised on N (see TanhPerStaticCurves) can fold the
+ * coefficients into its instructions.  g_errorRateModelNCoefficients is
+ * initialised from it.
+ *
+ * \tparam N the model number N of ErrorRateModelN (2..9)
+ */
+template <uint32_t N>
+struct TanhPerBank;
+
+/// ErrorRateModel2: model without coding over an AWGN channel using EVT
+template <>
+struct TanhPerBank<2>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 3.15361290882268, -2.48945855523085, 0.502484877279319, -0.951326960807816,
+        -0.00130291809731900, 4.82643541770000e-05, -0.00220770784130900, 2.33967659230000e-05 },
+      { 3.98858928921030, -4.13316079950364, 0.498546812927676, -0.954393382427655,
+        -0.00145088765811600, 3.94720851110000e-05, -0.00206640623209800, 2.27680867770000e-05 },
+      { 4.56658569864409, -5.25127534216202, 0.500112472564906, -0.943566468787194,
+        -0.00160589553186300, 3.73453840370000e-05, -0.00232406553895000, 2.39042959190000e-05 },
+      { 5.43311605342393, -6.93535572518656, 0.497687804209667, -0.949195865321411,
+        -0.00168948191634600, 3.41443576670000e-05, -0.00224889609965300, 2.34826576290000e-05 },
+      { 8.25718745445097, -11.8162579554963, 0.520049959463506, -0.952788798553077,
+        -0.00153305210482100, 2.43288709980000e-05, -0.00179693108775900, 1.81898014630000e-05 },
+      { 8.95733278540931, -13.3483194110432, 0.504389650770466, -0.943300700966366,
+        -0.00158413502606700, 2.57560115960000e-05, -0.00183514506155200, 2.02420535230000e-05 },
+      { 11.6439264576348, -17.5875720240176, 0.503491268321830, -0.896103139005381,
+        -0.00169905886348200, 2.79302842800000e-05, -0.00188309046285100, 2.34253796000000e-05 },
+      { 12.2248566770556, -17.9954245796341, 0.523560568723562, -0.894450035297498,
+        -0.00192790322865100, 2.75060844500000e-05, -0.00218951587758800, 2.30320808130000e-05 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 3.83745364713474, -3.70096579924190, 0.414309145627238, -1.29168334999200,
+        -0.00164631481445100, 3.68457859450000e-05, -0.00186037943625500, 1.28206180550000e-05 },
+      { 4.55243774215753, -5.93997163678378, 0.415663727878080, -1.28405106019439,
+        -0.00168354936289700, 2.91304743380000e-05, -0.00194388883245300, 1.35121443600000e-05 },
+      { 5.05730850355095, -7.53562652839129, 0.414822720985070, -1.28912950027701,
+        -0.00175592764824900, 2.60870346880000e-05, -0.00192822524608500, 1.30596395740000e-05 },
+      { 5.70761964869242, -9.55413559784494, 0.411213430141612, -1.26226600035705,
+        -0.00204498057575100, 2.57287414410000e-05, -0.00242758598226100, 1.51177021660000e-05 },
+      { 7.90828254191640, -15.8236007708639, 0.415449799755198, -1.25241827226232,
+        -0.00184416641136100, 2.12134975710000e-05, -0.00193505099832700, 1.44482872670000e-05 },
+      { 8.69271102578059, -18.0245232826899, 0.419096083715168, -1.25210214485501,
+        -0.00198381147811500, 1.98920647190000e-05, -0.00212423626064900, 1.39952846760000e-05 },
+      { 11.1041073802217, -24.7020307416564, 0.420469666216188, -1.23635060957999,
+        -0.00183324706523300, 1.79757951710000e-05, -0.00189014040121100, 1.36304965130000e-05 },
+      { 11.3545345354669, -25.0538468553275, 0.423762016952948, -1.22298953198653,
+        -0.00192333515969100, 1.88462777690000e-05, -0.00203576758032700, 1.45972103440000e-05 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel3: model of non-homogeneous errors at the PHY layer
+template <>
+struct TanhPerBank<3>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 2.95273153815820, -5.49937095816888, 0.380191424504812, -1.62824884013951,
+        -0.000880615884263000, 2.33061382420000e-05, -0.00111366968978900, 1.16273869190000e-05 },
+      { 3.09728164355334, -6.80421746853342, 0.328041236715921, -1.53349089854729,
+        -0.00107506745469100, 2.62460040570000e-05, -0.00141170994740300, 1.57465105520000e-05 },
+      { 2.94555359381293, -5.49129502697386, 0.378488701301435, -1.62612532456776,
+        -0.000884430380729000, 2.35667682390000e-05, -0.00112609273185800, 1.18648439700000e-05 },
+      { 3.18602993951641, -6.91428039727763, 0.340445596363895, -1.55023742499814,
+        -0.000998639096183000, 2.42517148510000e-05, -0.00125592888617500, 1.42831896730000e-05 },
+      { 2.97391700051886, -5.52390591432793, 0.384960438942971, -1.63434376147593,
+        -0.000867822009011000, 2.26468069970000e-05, -0.00107669556353200, 1.10499534670000e-05 },
+      { 3.28558179937902, -7.04744951971556, 0.352595041899999, -1.56874327525276,
+        -0.000899594284047000, 2.32498462880000e-05, -0.00107517929067600, 1.39311922080000e-05 },
+      { 2.59146198280202, -4.09167669789535, 0.244193142408141, -1.26401467214646,
+        -0.000899345247847000, 3.17024961030000e-05, -0.00100520781352600, 1.59137151110000e-05 },
+      { 3.47220152950315, -7.25074924666894, 0.392318485661446, -1.61442331618719,
+        -0.000829729801280000, 1.72603548710000e-05, -0.000882757613872000, 8.08035128600000e-06 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 3.21273647479387, -6.30990319895334, 0.435776736299653, -1.79355058967980,
+        -0.00102665869510000, 2.01007901310000e-05, -0.00164253811735200, 9.55161661600000e-06 },
+      { 3.68205549159713, -7.97989082820422, 0.444811555882664, -1.73555630536803,
+        -0.00125298595819200, 2.02169356510000e-05, -0.00196290894721200, 1.08930567590000e-05 },
+      { 3.21108136657091, -6.30795651608752, 0.435578904493147, -1.79326121278733,
+        -0.00102777930847800, 2.01531113270000e-05, -0.00164518583325000, 9.58371661400000e-06 },
+      { 3.67988976011791, -7.97694128872967, 0.444660837951036, -1.73527716518577,
+        -0.00125544568351400, 2.02521895380000e-05, -0.00196665371902500, 1.09077416010000e-05 },
+      { 3.21072981996537, -6.30750248691130, 0.435552294935388, -1.79321423266091,
+        -0.00102811687071400, 2.01592848150000e-05, -0.00164572725152600, 9.58558896800000e-06 },
+      { 3.67496238028385, -7.97114333662946, 0.444128908633577, -1.73449943891260,
+        0.00125885462044900, 2.04187796460000e-05, -0.00197464977379500, 1.10258918250000e-05 },
+      { 3.42708506552991, -5.23800508099319, 0.447464627923785, -1.50503031772577,
+        -0.00118268929494700, 2.51581033950000e-05, -0.00200706298383900, 1.18407627240000e-05 },
+      { 3.68305359796586, -7.97981096480704, 0.445179196299169, -1.73590901478081,
+        -0.00125531734525200, 2.00651727790000e-05, -0.00196207306209600, 1.07534119080000e-05 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel4: PER upper bound for OFDM systems, with BER equation #1
+template <>
+struct TanhPerBank<4>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 1.46306201857628, 5.95561541100306, 0.226237282504625, -1.71546315817952,
+        -0.00159889753416400, -1.45219857140000e-05, -0.00322724871769100, 6.26992610800000e-06 },
+      { 2.20028804328588, -2.75913894519549, -0.188331121689950, -2.08712268055257,
+        -0.00213367060337000, 3.09509733460000e-05, -0.00163519839060700, -1.11858017600000e-06 },
+      { 2.66333131156803, -0.006674305540532, 0.217977092689326, -1.71463577288853,
+        -0.000835317397577000, 0.000359398121850000, -0.00272304331280200, 6.20234037600000e-06 },
+      { 1.97982127104145, -8.97158192001013, -0.197326319094122, -2.06646474517010,
+        -0.00493153190533500, 9.86025214900000e-06, -0.000765512350149000, -1.04553919300000e-06 },
+      { 3.60490590203545, -8.76893665712924, 0.236697472606611, -1.49445844224010,
+        -0.00194957082428200, 1.73400133600000e-05, -0.00237670252549700, 6.64486162700000e-06 },
+      { 1.10714954194030, -19.1444727243866, -0.109834362737900, -1.76045729768401,
+        -0.00475151946507600, 3.00690143200000e-06, -0.00143651704417000, -2.12367667200000e-06 },
+      { 2.74618227880884, -25.0754769976109, 4.44889674208461, -6.07833355891381,
+        -0.000997162826614000, -2.46007936000000e-07, -3.35392409560000e-05, -2.39168030240000e-05 },
+      { 3.98019415655143, -30.4639101990618, 0.106644432467539, -1.81439791918775,
+        -0.00204614663164000, -2.19533346000000e-06, -0.00219070536632800, -5.68746732600000e-06 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 1.32734904726860, 5.61477605584785, 0.222385147011877, -1.63296289924399,
+        -0.00224003619294600, -1.40917843820000e-05, -0.00152375817313500, 7.56246945100000e-06 },
+      { 2.20070014272456, -2.36833721156488, 0.142769968699474, -1.78863769462741,
+        -0.00146909455800900, 3.75149414450000e-05, -0.000663182202450000, 5.14409391100000e-06 },
+      { 2.48667827182840, -0.01796427922533, 0.222203394789610, -1.63276420106606,
+        -0.000879536547534000, 0.000289786686597000, -0.00152657654515900, 7.57676958900000e-06 },
+      { 2.50949247047356, -7.63747286807608, 0.135993607969712, -1.78183841176321,
+        -0.00137268686404400, 1.77069846630000e-05, -0.000697005569516000, 5.46586150500000e-06 },
+      { 3.55551733749826, -8.75514006657530, 0.231577891465743, -1.47269109306373,
+        -0.00164727375900500, 1.94472878550000e-05, -0.00156992282919200, 8.74809600300000e-06 },
+      { 3.41074572519436, -18.2325539763006, 0.149914391789427, -1.68423249556659,
+        -0.00106915194172600, 1.16209240120000e-05, -0.000589221457350000, 5.61836654000000e-06 },
+      { 3.32879933678709, -21.2950551063640, 0.0985334723578920, -1.43374632887761,
+        -0.00143242470635600, 1.13520683510000e-05, -0.000851643213731000, 6.20363264600000e-06 },
+      { 4.33735589053607, -26.5116664058213, 0.144273978542138, -1.58010535358386,
+        -0.00109609031386100, 1.05761414390000e-05, -0.000816717344487000, 6.80347557400000e-06 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel5: PER upper bound for OFDM systems, with BER model #2
+template <>
+struct TanhPerBank<5>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 1.61138386888626, 4.29260167970805, 0.231929609679903, -1.71634262438178,
+        -0.00162769470440000, -2.43079331850000e-05, -0.00285681163913800, 5.87951954800000e-06 },
+      { 1.94615854883002, -4.71690210651555, -0.273995924534726, -2.08390751836259,
+        -0.00288847517092400, 1.97657817870000e-05, -0.00145484203885700, -1.31445867400000e-06 },
+      { 2.47167647911655, -1.08954354629650, 0.242276123529716, -1.72175604324440,
+        -0.00162874958766000, 6.39645305440000e-05, -0.00315104052888700, 5.70417033700000e-06 },
+      { 1.19326524267804, -9.56336746772198, -0.205643142870542, -1.83481916803012,
+        -0.00459480072717800, 8.82280631000000e-06, -0.00156658072345100, -1.23681150700000e-06 },
+      { 3.67542085364883, -9.80067096133878, 0.231656232645288, -1.44992805162847,
+        -0.00276016911196100, 2.15409079870000e-05, -0.00446708147232800, 1.10651337490000e-05 },
+      { 1.32796345893313, -21.2138789230135, -0.0753923406032680, -1.78503016704826,
+        -0.00287682422299000, 2.12951812800000e-06, -0.00121185966258200, -2.32223495600000e-06 },
+      { 2.9706669736597, -23.5174789638136, 0.0573963894395750, -1.47839379502606,
+        -0.00161154113318100, 6.06697771200000e-06, -0.00113050292085500, 2.03741552000000e-06 },
+      { 2.86226013212772, -28.6484622342323, 0.0595722770677000, -1.63130299517520,
+        -0.00449246683710400, 4.14777569800000e-06, -0.00999999999997200, -2.00781753000000e-07 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 1.53442982196917, 4.05710350646561, 0.213066698707621, -1.63327084386124,
+        -0.00224558191191500, -2.48814731190000e-05, -0.00126012905261700, 7.53341973600000e-06 },
+      { 2.35150202829538, -4.12945578029811, 0.165523468673682, -1.81088509915497,
+        -0.00135920966027400, 2.45352702460000e-05, -0.000616293108631000, 3.93835221900000e-06 },
+      { 2.34472467863693, -1.11675241853941, 0.210821870495884, -1.62969047079476,
+        -0.00144360246487500, 6.24681005070000e-05, -0.00126903894408900, 7.74483189400000e-06 },
+      { 2.70882168732344, -9.48390849278393, 0.151170534553341, -1.79851097175591,
+        -0.00119063645274200, 1.41152490010000e-05, -0.000643492972531000, 4.41025208000000e-06 },
+      { 3.68677507961820, -10.1618350584828, 0.221804263867398, -1.47140587607795,
+        -0.00150149002064800, 1.82110924710000e-05, -0.00130103590643900, 8.82463065000000e-06 },
+      { 3.14377108047318, -19.2608443404126, 0.100694092837421, -1.62578656504809,
+        -0.00162664919384900, 1.38652121560000e-05, -0.00137643614811600, 8.74985465800000e-06 },
+      { 3.60949600144035, -22.8943998963378, 0.127747406047680, -1.45508941902630,
+        -0.000876301785273000, 1.01439603760000e-05, -0.000447157850848000, 4.92972727400000e-06 },
+      { 4.48486557598502, -28.0041595517627, 0.142661335582167, -1.57798447346382,
+        -0.00124463604871000, 9.76160487500000e-06, -0.000980979275177000, 6.23905381100000e-06 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel6: PER upper bound for OFDM systems, with BER model #3
+template <>
+struct TanhPerBank<6>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 0.335291664744712, 2.23574472295461, 0.526893265712439, -0.828996427669230,
+        -0.00235787512680500, -3.79684645860000e-05, -0.00108985380149900, 2.56951745480000e-05 },
+      { 3.22627342985238, -7.72707732317285, 0.323505773495795, -2.31395536084290,
+        -0.00224218339467600, 2.38738277050000e-05, -0.00438078263616900, 1.18870425480000e-05 },
+      { 2.23090824068082, -0.736606359532674, 0.555194255579575, -0.810491549672661,
+        -0.000768452876922000, 8.11634845590000e-05, -0.00133237863502100, 2.78724912440000e-05 },
+      { 4.99288993069917, -15.7061537536960, 0.433026253485951, -2.46605809414054,
+        -0.00151869636174200, 1.08539604380000e-05, -0.00141021966231900, 4.67821801400000e-06 },
+      { 8.81904411460908, -15.1685982636890, 0.862025788210656, -1.90788452141029,
+        -0.00141245908409400, 1.92115595050000e-05, -0.00152849046933700, 1.40234780260000e-05 },
+      { 4.07975295700955, -39.8580158614952, 0.193627133829597, -3.42856118172394,
+        -0.00181413133376600, 1.14192879260000e-05, -0.000824737433929000, 7.84350273500000e-06 },
+      { 11.9058287475515, -56.7503038844136, 0.690740356157001, -3.97389297551151,
+        -0.00213000623531800, 1.09369391050000e-05, -0.00220936189031600, 9.25272456700000e-06 },
+      { 5.50256881283438, -72.2461203632284, 0.236404052965108, -4.73297258096957,
+        -0.00304282714148000, 8.19396237100000e-06, -0.00439946902232000, 6.85187293200000e-06 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 1.28559917013792, 2.73862154881481, 0.612513362256033, -1.26851961143474,
+        -0.00183303494596700, -5.99433013100000e-05, -0.00180326609582800, 2.19663854090000e-05 },
+      { 4.47224587170416, -9.03318905901939, 0.615261956164304, -2.59180864699573,
+        -0.00133231288291500, 2.22333350610000e-05, -0.00120683245609900, 1.16169640610000e-05 },
+      { 3.50777452102760, -1.56824274751812, 0.611163530459552, -1.24954783880221,
+        -0.00138108144089000, 7.01359090690000e-05, -0.00217398695004000, 2.34586472950000e-05 },
+      { 6.25760971723200, -16.6754763015406, 0.606273894611279, -2.57138718927113,
+        -0.00145726245782200, 1.80355291480000e-05, -0.00141320297359100, 1.20671939960000e-05 },
+      { 9.09752365956446, -19.1725861010277, 0.811793100557465, -2.36750481680100,
+        -0.00166851829893100, 2.08511262260000e-05, -0.00173288334571200, 1.54111143970000e-05 },
+      { 10.9838847054258, -46.4165323920125, 0.744209291716758, -3.91732373457366,
+        -0.00109796661608800, 9.33876194100000e-06, -0.00102355959340300, 7.21119546200000e-06 },
+      { 13.4471984991730, -62.6097119960087, 0.784588787126040, -4.36857424847745,
+        -0.00158011263515500, 5.97019898200000e-06, -0.00155408140195100, 4.50390431000000e-06 },
+      { 16.9781205762569, -79.8073911369286, 0.963107165952382, -5.21284829834553,
+        -0.00190239357592000, 1.01717214540000e-05, -0.00189928186171600, 8.85410943500000e-06 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel7: model without coding over an AWGN channel, with BER model #1
+template <>
+struct TanhPerBank<7>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 3.18712005311264, -2.53402985982601, 0.512124344709710, -0.967172461695009,
+        -0.00127065833947700, 4.64052888920000e-05, -0.00199936292221500, 2.15894126840000e-05 },
+      { 4.01704107198649, -4.17524473538837, 0.504976602094147, -0.960075820074446,
+        -0.00142321602435100, 3.85836303400000e-05, -0.00203928598415800, 2.22624944680000e-05 },
+      { 4.65038115371709, -5.37439284893574, 0.509346078667877, -0.963164266385265,
+        -0.00150242974481100, 3.51972873420000e-05, -0.00203467039200700, 2.19546354410000e-05 },
+      { 5.47730184715388, -7.01554037125649, 0.501705177011373, -0.957141467753506,
+        -0.00157840283168600, 3.29193538490000e-05, -0.00203886867392800, 2.25430338380000e-05 },
+      { 7.53217053924909, -10.7199295096673, 0.475893528064206, -0.875051759871723,
+        -0.00206147512547500, 3.70289195970000e-05, -0.00255818529625800, 2.95758262450000e-05 },
+      { 8.52358249699360, -12.8819941683319, 0.476747044319774, -0.909500805747538,
+        -0.00150797467714500, 2.68734807300000e-05, -0.00175072940328900, 2.15145123820000e-05 },
+      { 10.8800376302248, -16.2502253423559, 0.472024439756865, -0.833005772269576,
+        -0.00223555302116900, 3.43987779230000e-05, -0.00256339994311000, 2.93489797700000e-05 },
+      { 10.3900143773572, -15.9502061272675, 0.435539139906829, -0.802675513368845,
+        -0.00261996927367500, 3.65854207360000e-05, -0.00294023880374300, 3.09399349870000e-05 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 3.71357779681352, -3.60148816807538, 0.416307879146935, -1.25632009312102,
+        -0.00153470547759200, 3.77990896950000e-05, -0.00176811900491000, 1.40504360840000e-05 },
+      { 4.52269300582032, -5.82749587885524, 0.436217417932856, -1.26074150498730,
+        -0.00166660082153000, 2.93279382790000e-05, -0.00197891138142400, 1.37726980680000e-05 },
+      { 4.91030190560169, -7.32387712830015, 0.412802735092729, -1.25354393953141,
+        -0.00159383505250600, 2.71758590830000e-05, -0.00172679398405800, 1.42402589740000e-05 },
+      { 5.67764015094186, -9.60633279394574, 0.416897031670484, -1.26270677333351,
+        -0.00163723951892500, 2.36418279620000e-05, -0.00175596141740800, 1.35796168100000e-05 },
+      { 7.71959109498556, -15.4414590996220, 0.413714542898705, -1.22089631163770,
+        -0.00160202357818000, 2.13489390340000e-05, -0.00168196694213600, 1.48401799680000e-05 },
+      { 8.30157351114409, -16.9489236808397, 0.407761124115450, -1.18249859502912,
+        -0.00213110872577500, 2.39599777400000e-05, -0.00240565699195100, 1.77524478240000e-05 },
+      { 10.3945334477579, -23.3870872693267, 0.397010232996495, -1.17170738525975,
+        -0.00176504636023400, 2.20401828600000e-05, -0.00189255929120100, 1.76280121170000e-05 },
+      { 10.5106560357283, -23.3625099988628, 0.393815868483560, -1.14845210184909,
+        -0.00218974291529700, 2.40405833790000e-05, -0.00231488009942000, 1.91387094500000e-05 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel8: model without coding over an AWGN channel, with BER model #2
+template <>
+struct TanhPerBank<8>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 3.64586491152694, -3.44092737951818, 0.507662641851073, -0.962851433845432,
+        -0.00135748494916600, 4.11659530700000e-05, -0.00202341705980600, 2.20317557640000e-05 },
+      { 4.48171979822115, -5.07149268437161, 0.504080220574546, -0.958035443905520,
+        -0.00150873848073600, 3.61740920950000e-05, -0.00206161039756300, 2.21918607150000e-05 },
+      { 5.12101505758392, -6.30538338103856, 0.505590327590540, -0.962911473143776,
+        -0.00151743878136500, 3.31635743060000e-05, -0.00197594446622600, 2.17654166720000e-05 },
+      { 5.78145674973695, -7.68659192663585, 0.485532921368855, -0.933291069533266,
+        -0.00177290110685800, 3.45057142310000e-05, -0.00225982973464700, 2.45681610620000e-05 },
+      { 7.93965445569684, -11.6927779990548, 0.471836365159739, -0.873224921515755,
+        -0.00185213754604900, 3.26502232590000e-05, -0.00247253542625000, 2.71369025080000e-05 },
+      { 9.00653678542744, -13.3861445556868, 0.484293710707878, -0.892584114046291,
+        -0.00191003958326000, 3.06830522700000e-05, -0.00220458742160800, 2.47367036110000e-05 },
+      { 10.7128450446588, -16.7974263714224, 0.439757838410512, -0.820202625556524,
+        -0.00205202450638900, 3.52768419730000e-05, -0.00231027190033000, 3.04598525450000e-05 },
+      { 10.6172673883474, -16.2922205234529, 0.431478192477952, -0.778889437744041,
+        -0.00276659419511200, 4.09127425260000e-05, -0.00329294707230100, 3.58993099290000e-05 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 4.14234585717076, -4.86536918335464, 0.421380251589724, -1.26795871201802,
+        -0.00155598218133600, 3.16173923570000e-05, -0.00172915405155700, 1.32711265170000e-05 },
+      { 5.11064582667763, -7.15021306122026, 0.460168017515940, -1.27717769386733,
+        -0.00165442109457300, 2.55637647700000e-05, -0.00185179600017600, 1.25895510670000e-05 },
+      { 5.32272552300413, -8.55378640253555, 0.414366836669799, -1.25689285349013,
+        -0.00166357218841100, 2.53393046080000e-05, -0.00180313148100600, 1.40308370120000e-05 },
+      { 6.43294470512147, -10.9097853664419, 0.455713244865281, -1.27111917480121,
+        -0.00171091821350300, 2.19350440680000e-05, -0.00185277454571000, 1.30029674060000e-05 },
+      { 7.97881087107872, -16.0185837945465, 0.408086134395531, -1.18136491199331,
+        -0.00209329056430600, 2.48969185470000e-05, -0.00241274977923600, 1.84038521760000e-05 },
+      { 8.61169194876993, -18.1329215316931, 0.402528332859269, -1.18325149393763,
+        -0.00208782638674300, 2.36771150090000e-05, -0.00237792721752200, 1.79702194620000e-05 },
+      { 11.0063566801119, -24.0241274023891, 0.409665934722813, -1.15256086935968,
+        -0.00234011598015300, 2.35132061630000e-05, -0.00257961655945100, 1.89265061750000e-05 },
+      { 11.0568786502572, -24.5633891313650, 0.403005960749043, -1.15054342547446,
+        -0.00215983634271300, 2.34343231620000e-05, -0.00234411291352700, 1.89405047020000e-05 }
+    }
+  }; //!< the bank
+};
+
+/// ErrorRateModel9: model without coding over an AWGN channel, with BER model #3
+template <>
+struct TanhPerBank<9>
+{
+  static constexpr TanhPerCoefficientSet coefficients = {
+    { // arreglo_modelo, PER >= 0.1
+      { 6.41589393961101, -6.63248831224323, 1.32674636346909, -1.75542118471084,
+        -0.00125219445543800, 4.19190509680000e-05, -0.00168551009657400, 3.34906481340000e-05 },
+      { 8.44358365886742, -9.36351800575378, 1.28158458446421, -1.70878607554813,
+        -0.00144652037491900, 4.23370388260000e-05, -0.00175088210201500, 3.54787570140000e-05 },
+      { 10.8511444053128, -12.4537519961998, 1.39063097170049, -1.83767981365811,
+        -0.00128694025637600, 3.38187770580000e-05, -0.00149599409466400, 2.88543290090000e-05 },
+      { 13.6676621063051, -16.1189859063861, 1.43024858560490, -1.88852706754412,
+        -0.00126055423699600, 3.03204426210000e-05, -0.00140247239925100, 2.63157563320000e-05 },
+      { 29.9955698008513, -38.1798623327371, 2.47184770956964, -3.32797072698532,
+        -0.000772225353294000, 2.73392185600000e-06, -0.000775396073379000, 4.98599436000000e-07 },
+      { 32.8064368091098, -41.1042632806494, 2.36299265870667, -3.11447046875340,
+        -0.00113454156657000, 8.67756789100000e-06, -0.00115247304080400, 6.47938279000000e-06 },
+      { 42.5587419030691, -57.9136352919157, 2.58699548657170, -3.65265668067265,
+        -0.00114010138485000, 1.41333125930000e-05, -0.00117027807174600, 1.30314427970000e-05 },
+      { 37.9722624011597, -54.5988490758475, 2.22599111525397, -3.33769395356031,
+        -0.00122765564869400, 2.34005885570000e-05, -0.00126396736441200, 2.22822440310000e-05 }
+    },
+    { // arreglo_modelo1, PER < 0.1
+      { 7.39452831722626, -11.0146575792821, 1.20814579937179, -2.79732652760556,
+        -0.00134545727765800, 3.32828568350000e-05, -0.00146772047548300, 2.42370497800000e-05 },
+      { 9.69001933206027, -16.1441787456810, 1.23558360850818, -2.83432737360352,
+        -0.00153817967724900, 2.90517644810000e-05, -0.00167475668041100, 2.26956424510000e-05 },
+      { 11.9026770509106, -18.7822735374819, 1.35176451190510, -2.73128982577359,
+        -0.00268251502647900, 3.25243247290000e-05, -0.00310201915651100, 2.63277208610000e-05 },
+      { 13.2563614330778, -24.8897831985656, 1.21824462291625, -2.85968032173227,
+        -0.00129296996582700, 2.62830041250000e-05, -0.00131613858984900, 2.20185564020000e-05 },
+      { 21.3036193901636, -41.8745370356488, 1.62227927207286, -3.64356152631642,
+        -0.00268699786610000, 2.58803947620000e-05, -0.00277160437187400, 2.28652660290000e-05 },
+      { 18.4846264504979, -46.2279364870631, 1.21502404512244, -3.48937430216901,
+        -0.00102025084641200, 3.03724415650000e-05, -0.000984355013820000, 2.77119225110000e-05 },
+      { 22.2058153429767, -66.5191492455813, 1.25438963481338, -4.19530232680861,
+        -0.00175040812828400, 3.27204333980000e-05, -0.00183312081798900, 3.11342732850000e-05 },
+      { 31.0833319574465, -75.6739782026714, 1.74593392269252, -4.61602678313490,
+        -0.00108081094409200, 2.47727678800000e-05, -0.00107302187738900, 2.33294218180000e-05 }
+    }
+  }; //!< the bank
+};
+
+} //namespace ns3
+
+#endif /* TANH_PER_BANKS_H */
@@ -0,0 +1,615 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "tanh-per-coefficient-file.h"
+#include "fnv-hash.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TanhPerCoefficientFile");
+
+/// Header of a binary coefficient cache; the bank follows it
+struct TanhPerCoefficientCacheHeader
+{
+  char magic[8];             //!< CACHE_MAGIC
+  uint32_t byteOrder;        //!< CACHE_BYTE_ORDER, as written by the host
+  uint32_t payloadBytes;     //!< sizeof (TanhPerCoefficientSet)
+  uint64_t sourceSize;       //!< size of the coefficient file (bytes)
+  int64_t sourceSeconds;     //!< modification time of the coefficient file (s)
+  int64_t sourceNanoseconds; //!< sub-second part of the modification time (ns)
+  uint64_t checksum;         //!< FNV-1a of the header, with this field 0, and of the bank
+  uint64_t reserved[2];      //!< 0; pads the header to 64 bytes, aligning the bank
+};
+
+static_assert (sizeof (TanhPerCoefficientCacheHeader) == 64, "cache header is not packed");
+
+/// Magic number of a binary coefficient cache, with its format version
+static const char CACHE_MAGIC[8] = { 'T', 'P', 'E', 'R', 'C', 'O', 'F', '1' };
+/// Reads back differently on a host of the other byte order
+static const uint32_t CACHE_BYTE_ORDER = 0x01020304;
+/// Size of a binary coefficient cache (bytes)
+static const size_t CACHE_BYTES = sizeof (TanhPerCoefficientCacheHeader) + sizeof (TanhPerCoefficientSet);
+
+/// Size and modification time of a file
+struct TanhPerFileStamp
+{
+  uint64_t size;       //!< size (bytes)
+  int64_t seconds;     //!< modification time (s)
+  int64_t nanoseconds; //!< sub-second part of the modification time (ns)
+};
+
+/**
+ * \param fileName a file
+ * \param stamp set to its size and modification time
+ *
+ * \return true if the file exists
+ */
+static bool
+GetFileStamp (const std::string &fileName, TanhPerFileStamp &stamp)
+{
+  struct stat st;
+  if (stat (fileName.c_str (), &st) != 0)
+    {
+      return false;
+    }
+  stamp.size = st.st_size;
+  stamp.seconds = st.st_mtime;
+#if defined (__APPLE__)
+  stamp.nanoseconds = st.st_mtimespec.tv_nsec;
+#else
+  stamp.nanoseconds = st.st_mtim.tv_nsec;
+#endif
+  return true;
+}
+
+/**
+ * \param header a cache header
+ * \param coefficients the bank that follows it
+ *
+ * \return the checksum the header should hold
+ */
+static uint64_t
+GetChecksum (const TanhPerCoefficientCacheHeader &header, const TanhPerCoefficientSet &coefficients)
+{
+  TanhPerCoefficientCacheHeader zeroed = header;
+  zeroed.checksum = 0;
+  return HashBytes (&coefficients, sizeof (coefficients), HashBytes (&zeroed, sizeof (zeroed)));
+}
+
+/**
+ * \param text a number, possibly surrounded by white space
+ * \param value set to the number
+ *
+ * \return true if text is a finite number and nothing else
+ */
+static bool
+ParseNumber (const std::string &text, double &value)
+{
+  const char *begin = text.c_str ();
+  char *end;
+  value = strtod (begin, &end);
+  if (end == begin)
+    {
+      return false;
+    }
+  while (*end == ' ' || *end == '\t' || *end == '\r')
+    {
+      end++;
+    }
+  return *end == 0 && std::isfinite (value);
+}
+
+/**
+ * \param values c1 c2 c3 c4 d1 d2 d3 d4, in file order
+ * \param row set to the coefficients
+ */
+static void
+SetRow (const double values[8], TanhPerCoefficients &row)
+{
+  row.c1 = values[0];
+  row.c2 = values[1];
+  row.c3 = values[2];
+  row.c4 = values[3];
+  row.d1 = values[4];
+  row.d2 = values[5];
+  row.d3 = values[6];
+  row.d4 = values[7];
+}
+
+/**
+ * \param text the contents of a CSV coefficient file
+ * \param fileName its name, for the error messages
+ * \param coefficients set to the bank
+ * \param error set to the reason if the text cannot be parsed
+ *
+ * \return true if the text holds all 16 rows
+ */
+static bool
+ParseCsv (const std::string &text, const std::string &fileName,
+          TanhPerCoefficientSet &coefficients, std::string &error)
+{
+  bool seen[2][8] = {};
+  std::istringstream is (text);
+  std::string line;
+  for (uint32_t lineNumber = 1; std::getline (is, line); lineNumber++)
+    {
+      std::ostringstream where;
+      where << fileName << ":" << lineNumber << ": ";
+      line = line.substr (0, line.find ('#'));
+      if (line.find_first_not_of (" \t\r") == std::string::npos)
+        {
+          continue;
+        }
+      std::vector<std::string> fields;
+      std::istringstream ls (line);
+      std::string field;
+      while (std::getline (ls, field, ','))
+        {
+          size_t first = field.find_first_not_of (" \t\r");
+          size_t last = field.find_last_not_of (" \t\r");
+          fields.push_back (first == std::string::npos ? "" : field.substr (first, last - first + 1));
+        }
+      if (fields[0] == "table")
+        {
+          // header line
+          continue;
+        }
+      if (fields.size () != 10)
+        {
+          error = where.str () + "expected table,row and 8 coefficients";
+          return false;
+        }
+      int table = (fields[0] == "low") ? 0 : (fields[0] == "high") ? 1 : -1;
+      double row;
+      if (table < 0 || !ParseNumber (fields[1], row) || row < 0 || row > 7 || row != std::floor (row))
+        {
+          error = where.str () + "expected low or high and a row from 0 to 7";
+          return false;
+        }
+      double values[8];
+      for (uint32_t i = 0; i < 8; i++)
+        {
+          if (!ParseNumber (fields[2 + i], values[i]))
+            {
+              error = where.str () + "\"" + fields[2 + i] + "\" is not a finite number";
+              return false;
+            }
+        }
+      if (seen[table][uint32_t (row)])
+        {
+          error = where.str () + "row given twice";
+          return false;
+        }
+      seen[table][uint32_t (row)] = true;
+      SetRow (values, table == 0 ? coefficients.low[uint32_t (row)] : coefficients.high[uint32_t (row)]);
+    }
+  for (uint32_t table = 0; table < 2; table++)
+    {
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          if (!seen[table][row])
+            {
+              std::ostringstream os;
+              os << fileName << ": no " << (table == 0 ? "low" : "high") << " row " << row;
+              error = os.str ();
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+/**
+ * A cursor over the text of a JSON coefficient file.
+ */
+struct TanhPerJsonCursor
+{
+  const std::string &text; //!< the file contents
+  size_t pos;              //!< offset of the next character
+
+  /**
+   * Skip white space.
+   *
+   * \return the next character, or 0 at the end
+   */
+  char Peek (void)
+  {
+    while (pos < text.size () && (text[pos] == ' ' || text[pos] == '\t'
+                                  || text[pos] == '\r' || text[pos] == '\n'))
+      {
+        pos++;
+      }
+    return pos < text.size () ? text[pos] : 0;
+  }
+  /**
+   * \param c a character
+   *
+   * \return true if c is next, and was consumed
+   */
+  bool Accept (char c)
+  {
+    if (Peek () != c)
+      {
+        return false;
+      }
+    pos++;
+    return true;
+  }
+  /**
+   * \param value set to the string, without its quotes
+   *
+   * \return true if a string was read
+   */
+  bool ReadString (std::string &value)
+  {
+    if (!Accept ('"'))
+      {
+        return false;
+      }
+    value.clear ();
+    while (pos < text.size () && text[pos] != '"')
+      {
+        if (text[pos] == '\\' && pos + 1 < text.size ())
+          {
+            pos++;
+          }
+        value += text[pos++];
+      }
+    return Accept ('"');
+  }
+  /**
+   * \param value set to the number
+   *
+   * \return true if a finite number was read
+   */
+  bool ReadNumber (double &value)
+  {
+    Peek ();
+    const char *begin = text.c_str () + pos;
+    char *end;
+    value = strtod (begin, &end);
+    pos += end - begin;
+    return end != begin && std::isfinite (value);
+  }
+  /**
+   * \param rows set to the eight rows of a table
+   *
+   * \return true if an array of eight arrays of eight numbers was read
+   */
+  bool ReadTable (TanhPerCoefficients rows[8])
+  {
+    if (!Accept ('['))
+      {
+        return false;
+      }
+    for (uint32_t row = 0; row < 8; row++)
+      {
+        double values[8];
+        if ((row > 0 && !Accept (',')) || !Accept ('['))
+          {
+            return false;
+          }
+        for (uint32_t i = 0; i < 8; i++)
+          {
+            if ((i > 0 && !Accept (',')) || !ReadNumber (values[i]))
+              {
+                return false;
+              }
+          }
+        if (!Accept (']'))
+          {
+            return false;
+          }
+        SetRow (values, rows[row]);
+      }
+    return Accept (']');
+  }
+  /**
+   * \return the line of the next character, from 1
+   */
+  uint32_t GetLine (void) const
+  {
+    uint32_t line = 1;
+    for (size_t i = 0; i < pos && i < text.size (); i++)
+      {
+        line += (text[i] == '\n');
+      }
+    return line;
+  }
+};
+
+/**
+ * \param text the contents of a JSON coefficient file
+ * \param fileName its name, for the error messages
+ * \param coefficients set to the bank
+ * \param error set to the reason if the text cannot be parsed
+ *
+ * \return true if the text holds both tables
+ */
+static bool
+ParseJson (const std::string &text, const std::string &fileName,
+           TanhPerCoefficientSet &coefficients, std::string &error)
+{
+  TanhPerJsonCursor cursor = { text, 0 };
+  bool seen[2] = { false, false };
+  bool ok = cursor.Accept ('{');
+  for (bool first = true; ok && !cursor.Accept ('}'); first = false)
+    {
+      std::string name;
+      ok = (first || cursor.Accept (',')) && cursor.ReadString (name) && cursor.Accept (':');
+      if (!ok)
+        {
+          break;
+        }
+      if (name == "low" || name == "high")
+        {
+          uint32_t table = (name == "high");
+          ok = !seen[table] && cursor.ReadTable (table == 0 ? coefficients.low : coefficients.high);
+          seen[table] = true;
+        }
+      else
+        {
+          // metadata
+          std::string ignored;
+          double number;
+          ok = (cursor.Peek () == '"') ? cursor.ReadString (ignored) : cursor.ReadNumber (number);
+        }
+    }
+  if (ok && cursor.Peek () != 0)
+    {
+      ok = false;
+    }
+  if (!ok)
+    {
+      std::ostringstream os;
+      os << fileName << ":" << cursor.GetLine ()
+         << ": expected an object with \"low\" and \"high\" arrays of 8 rows of 8 numbers";
+      error = os.str ();
+      return false;
+    }
+  if (!seen[0] || !seen[1])
+    {
+      error = fileName + ": no \"" + (seen[0] ? "high" : "low") + "\" table";
+      return false;
+    }
+  return true;
+}
+
+bool
+TanhPerCoefficientFile::Parse (const std::string &fileName, TanhPerCoefficientSet &coefficients,
+                               std::string &error)
+{
+  std::ifstream is (fileName.c_str (), std::ios::binary);
+  if (!is)
+    {
+      error = fileName + ": " + strerror (errno);
+      return false;
+    }
+  std::ostringstream contents;
+  contents << is.rdbuf ();
+  std::string text = contents.str ();
+  size_t first = text.find_first_not_of (" \t\r\n");
+  if (first != std::string::npos && text[first] == '{')
+    {
+      return ParseJson (text, fileName, coefficients, error);
+    }
+  return ParseCsv (text, fileName, coefficients, error);
+}
+
+bool
+TanhPerCoefficientFile::WriteCsv (const std::string &fileName, const TanhPerCoefficientSet &coefficients)
+{
+  std::ofstream os (fileName.c_str ());
+  os << "table,row,c1,c2,c3,c4,d1,d2,d3,d4\n" << std::setprecision (17);
+  for (uint32_t table = 0; table < 2; table++)
+    {
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          const TanhPerCoefficients &c = (table == 0) ? coefficients.low[row] : coefficients.high[row];
+          os << (table == 0 ? "low," : "high,") << row << "," << c.c1 << "," << c.c2 << "," << c.c3
+             << "," << c.c4 << "," << c.d1 << "," << c.d2 << "," << c.d3 << "," << c.d4 << "\n";
+        }
+    }
+  os.close ();
+  return !os.fail ();
+}
+
+std::string
+TanhPerCoefficientFile::GetCacheFileName (const std::string &fileName)
+{
+  return fileName + ".bin";
+}
+
+/**
+ * Write the binary cache of a coefficient file as it was when stamp was
+ * taken.
+ *
+ * \param fileName the coefficient file
+ * \param coefficients the bank it holds
+ * \param stamp its size and modification time
+ *
+ * \return true if the cache was written
+ */
+static bool
+WriteCacheFile (const std::string &fileName, const TanhPerCoefficientSet &coefficients,
+                const TanhPerFileStamp &stamp)
+{
+  TanhPerCoefficientCacheHeader header;
+  memset (&header, 0, sizeof (header));
+  memcpy (header.magic, CACHE_MAGIC, sizeof (CACHE_MAGIC));
+  header.byteOrder = CACHE_BYTE_ORDER;
+  header.payloadBytes = sizeof (TanhPerCoefficientSet);
+  header.sourceSize = stamp.size;
+  header.sourceSeconds = stamp.seconds;
+  header.sourceNanoseconds = stamp.nanoseconds;
+  header.checksum = GetChecksum (header, coefficients);
+
+  std::string cacheName = TanhPerCoefficientFile::GetCacheFileName (fileName);
+  std::ostringstream temporary;
+  temporary << cacheName << "." << getpid () << ".tmp";
+  std::ofstream os (temporary.str ().c_str (), std::ios::binary);
+  os.write (reinterpret_cast<const char *> (&header), sizeof (header));
+  os.write (reinterpret_cast<const char *> (&coefficients), sizeof (coefficients));
+  os.close ();
+  if (os.fail () || rename (temporary.str ().c_str (), cacheName.c_str ()) != 0)
+    {
+      unlink (temporary.str ().c_str ());
+      return false;
+    }
+  return true;
+}
+
+bool
+TanhPerCoefficientFile::WriteCache (const std::string &fileName, const TanhPerCoefficientSet &coefficients)
+{
+  TanhPerFileStamp stamp;
+  return GetFileStamp (fileName, stamp) && WriteCacheFile (fileName, coefficients, stamp);
+}
+
+const TanhPerCoefficientSet *
+TanhPerCoefficientFile::Map (const std::string &fileName)
+{
+  TanhPerFileStamp stamp;
+  if (!GetFileStamp (fileName, stamp))
+    {
+      return 0;
+    }
+  std::string cacheName = GetCacheFileName (fileName);
+  int fd = open (cacheName.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      return 0;
+    }
+  struct stat st;
+  void *mapping = MAP_FAILED;
+  if (fstat (fd, &st) == 0 && size_t (st.st_size) == CACHE_BYTES)
+    {
+      mapping = mmap (0, CACHE_BYTES, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+  close (fd);
+  if (mapping == MAP_FAILED)
+    {
+      NS_LOG_INFO ("cannot map " << cacheName);
+      return 0;
+    }
+  const TanhPerCoefficientCacheHeader &header = *static_cast<const TanhPerCoefficientCacheHeader *> (mapping);
+  const TanhPerCoefficientSet *coefficients = reinterpret_cast<const TanhPerCoefficientSet *> (&header + 1);
+  if (memcmp (header.magic, CACHE_MAGIC, sizeof (CACHE_MAGIC)) != 0
+      || header.byteOrder != CACHE_BYTE_ORDER
+      || header.payloadBytes != sizeof (TanhPerCoefficientSet)
+      || header.sourceSize != stamp.size
+      || header.sourceSeconds != stamp.seconds
+      || header.sourceNanoseconds != stamp.nanoseconds
+      || header.checksum != GetChecksum (header, *coefficients))
+    {
+      NS_LOG_INFO (cacheName << " is stale or corrupt");
+      munmap (mapping, CACHE_BYTES);
+      return 0;
+    }
+  return coefficients;
+}
+
+void
+TanhPerCoefficientFile::Unmap (const TanhPerCoefficientSet *coefficients)
+{
+  const TanhPerCoefficientCacheHeader *header =
+    reinterpret_cast<const TanhPerCoefficientCacheHeader *> (coefficients) - 1;
+  munmap (const_cast<TanhPerCoefficientCacheHeader *> (header), CACHE_BYTES);
+}
+
+/**
+ * \return the mutex guarding the loaded banks
+ */
+static std::mutex &
+GetLoadMutex (void)
+{
+  static std::mutex *mutex = new std::mutex ();
+  return *mutex;
+}
+
+/**
+ * \return the loaded banks by file name; never destroyed, as the stores
+ *         of the models hold them until the end of the program
+ */
+static std::map<std::string, const TanhPerCoefficientSet *> &
+GetLoadedSets (void)
+{
+  static std::map<std::string, const TanhPerCoefficientSet *> *sets =
+    new std::map<std::string, const TanhPerCoefficientSet *> ();
+  return *sets;
+}
+
+const TanhPerCoefficientSet *
+TanhPerCoefficientFile::Load (const std::string &fileName, std::string &error)
+{
+  std::lock_guard<std::mutex> lock (GetLoadMutex ());
+  std::map<std::string, const TanhPerCoefficientSet *>::iterator it = GetLoadedSets ().find (fileName);
+  if (it != GetLoadedSets ().end ())
+    {
+      return it->second;
+    }
+  const TanhPerCoefficientSet *coefficients = Map (fileName);
+  if (coefficients != 0)
+    {
+      NS_LOG_INFO ("mapped " << GetCacheFileName (fileName));
+    }
+  else
+    {
+      // stamped before parsing, so that a file changed meanwhile leaves a
+      // cache that does not match it
+      TanhPerFileStamp stamp;
+      if (!GetFileStamp (fileName, stamp))
+        {
+          error = fileName + ": " + strerror (errno);
+          return 0;
+        }
+      TanhPerCoefficientSet *parsed = new TanhPerCoefficientSet;
+      if (!Parse (fileName, *parsed, error))
+        {
+          delete parsed;
+          return 0;
+        }
+      if (WriteCacheFile (fileName, *parsed, stamp))
+        {
+          NS_LOG_INFO ("compiled " << fileName << " into " << GetCacheFileName (fileName));
+        }
+      else
+        {
+          NS_LOG_INFO ("cannot write " << GetCacheFileName (fileName));
+        }
+      coefficients = parsed;
+    }
+  GetLoadedSets ()[fileName] = coefficients;
+  return coefficients;
+}
+
+} //namespace ns3
@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_COEFFICIENT_FILE_H
+#define TANH_PER_COEFFICIENT_FILE_H
+
+#include <stdint.h>
+#include <string>
+#include "tanh-per-coefficients.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Coefficient banks read from text files, so that new fits can be used
+ * without recompiling.  Two formats are accepted.  CSV has one line per
+ * row, optionally after a "table,row,c1,..." header line:
+ *
+ *   low,0,c1,c2,c3,c4,d1,d2,d3,d4
+ *   ...
+ *   high,7,c1,c2,c3,c4,d1,d2,d3,d4
+ *
+ * where "low" rows are arreglo_modelo and "high" rows arreglo_modelo1.
+ * JSON is an object with a "low" and a "high" array of eight arrays of
+ * the eight coefficients c1 c2 c3 c4 d1 d2 d3 d4; other members with a
+ * string or number value are ignored.  '#' starts a comment in CSV.
+ * Every one of the 16 rows must be given.
+ *
+ * The first time a file is loaded it is compiled into a binary cache,
+ * FILE.bin, which records the size and modification time of FILE and a
+ * checksum of its contents.  Later loads, in this or another process,
+ * map the cache read-only instead of parsing FILE again, as long as FILE
+ * is unchanged and the cache checks out; otherwise FILE is parsed and
+ * the cache rewritten.  A cache that cannot be written (e.g. read-only
+ * directory) only costs the parse.
+ */
+class TanhPerCoefficientFile
+{
+public:
+  /**
+   * Load a coefficient file, once per process: later calls with the same
+   * name return the same bank.
+   *
+   * \param fileName the CSV or JSON file
+   * \param error set to the reason if the file cannot be loaded
+   *
+   * \return the bank, which lives for the whole program, or 0 on error
+   */
+  static const TanhPerCoefficientSet * Load (const std::string &fileName, std::string &error);
+  /**
+   * \param fileName the CSV or JSON file
+   * \param coefficients set to the bank the file holds
+   * \param error set to the reason if the file cannot be parsed
+   *
+   * \return true if the file was parsed
+   */
+  static bool Parse (const std::string &fileName, TanhPerCoefficientSet &coefficients,
+                     std::string &error);
+  /**
+   * \param fileName the CSV file to write
+   * \param coefficients the bank
+   *
+   * \return true if the file was written
+   */
+  static bool WriteCsv (const std::string &fileName, const TanhPerCoefficientSet &coefficients);
+
+  /**
+   * \param fileName a coefficient file
+   *
+   * \return the name of its binary cache
+   */
+  static std::string GetCacheFileName (const std::string &fileName);
+  /**
+   * Write the binary cache of a coefficient file.  It is written to a
+   * temporary file that is then renamed, so processes loading the same
+   * file at once never see a partial cache.
+   *
+   * \param fileName the coefficient file
+   * \param coefficients the bank it holds
+   *
+   * \return true if the cache was written
+   */
+  static bool WriteCache (const std::string &fileName, const TanhPerCoefficientSet &coefficients);
+  /**
+   * Map the binary cache of a coefficient file, if it is valid for the
+   * file as it is now.
+   *
+   * \param fileName the coefficient file
+   *
+   * \return the bank in the read-only mapping, or 0 if there is no valid
+   *         cache; release it with Unmap
+   */
+  static const TanhPerCoefficientSet * Map (const std::string &fileName);
+  /**
+   * \param coefficients a bank returned by Map
+   */
+  static void Unmap (const TanhPerCoefficientSet *coefficients);
+};
+
+} //namespace ns3
+
+#endif /* TANH_PER_COEFFICIENT_FILE_H */
@@ -0,0 +1,58 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "tanh-per-coefficients.h"
+#include "tanh-per-banks.h"
+
+namespace ns3 {
+
+// The banks are defined in tanh-per-banks.h, where code specialised on a
+// model can read them at compile time; these are their runtime copies.
+constexpr TanhPerCoefficientSet TanhPerBank<2>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<3>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<4>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<5>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<6>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<7>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<8>::coefficients;
+constexpr TanhPerCoefficientSet TanhPerBank<9>::coefficients;
+
+const TanhPerCoefficientSet g_errorRateModel2Coefficients = TanhPerBank<2>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel3Coefficients = TanhPerBank<3>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel4Coefficients = TanhPerBank<4>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel5Coefficients = TanhPerBank<5>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel6Coefficients = TanhPerBank<6>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel7Coefficients = TanhPerBank<7>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel8Coefficients = TanhPerBank<8>::coefficients;
+const TanhPerCoefficientSet g_errorRateModel9Coefficients = TanhPerBank<9>::coefficients;
+
+const TanhPerCoefficientSet *
+GetTanhPerCoefficientSet (uint32_t model)
+{
+  static const TanhPerCoefficientSet *sets[] = {
+    &g_errorRateModel2Coefficients, &g_errorRateModel3Coefficients,
+    &g_errorRateModel4Coefficients, &g_errorRateModel5Coefficients,
+    &g_errorRateModel6Coefficients, &g_errorRateModel7Coefficients,
+    &g_errorRateModel8Coefficients, &g_errorRateModel9Coefficients
+  };
+  if (model < 2 || model > 9)
+    {
+      return 0;
+    }
+  return sets[model - 2];
+}
+
+} //namespace ns3
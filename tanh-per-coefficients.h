@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TANH_PER_COEFFICIENTS_H
+#define TANH_PER_COEFFICIENTS_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Coefficients of one OFDM row of the tanh PER fit.  For a chunk of nbits
+ * bits the curve parameters are
+ *
+ *   a_R = c1 * exp (d1 * nbits) + c2 * exp (d2 * nbits)
+ *   b_R = c3 * exp (d3 * nbits) + c4 * exp (d4 * nbits)
+ *
+ * and the packet error rate at snr (in dB) is (1 - tanh (a_R - b_R * snr)) / 2.
+ */
+struct TanhPerCoefficients
+{
+  double c1; //!< first a_R amplitude
+  double c2; //!< second a_R amplitude
+  double c3; //!< first b_R amplitude
+  double c4; //!< second b_R amplitude
+  double d1; //!< first a_R exponent (per bit)
+  double d2; //!< second a_R exponent (per bit)
+  double d3; //!< first b_R exponent (per bit)
+  double d4; //!< second b_R exponent (per bit)
+};
+
+/**
+ * \ingroup wifi
+ *
+ * The full coefficient bank of one ErrorRateModelN.  Rows are indexed as
+ * 0: BPSK 1/2, 1: BPSK 3/4, 2: QPSK 1/2, 3: QPSK 3/4, 4: 16-QAM 1/2,
+ * 5: 16-QAM 3/4, 6: 64-QAM 2/3, 7: 64-QAM 3/4.
+ *
+ * The bank lives in static, read-only storage for the lifetime of the
+ * program, so GetChunkSuccessRate only reads it and never builds it.
+ */
+struct TanhPerCoefficientSet
+{
+  TanhPerCoefficients low[8];  //!< arreglo_modelo: used while PER >= 0.1
+  TanhPerCoefficients high[8]; //!< arreglo_modelo1: used once -10 log10 (PER) > 10
+};
+
+extern const TanhPerCoefficientSet g_errorRateModel2Coefficients; //!< ErrorRateModel2 bank
+extern const TanhPerCoefficientSet g_errorRateModel3Coefficients; //!< ErrorRateModel3 bank
+extern const TanhPerCoefficientSet g_errorRateModel4Coefficients; //!< ErrorRateModel4 bank
+extern const TanhPerCoefficientSet g_errorRateModel5Coefficients; //!< ErrorRateModel5 bank
+extern const TanhPerCoefficientSet g_errorRateModel6Coefficients; //!< ErrorRateModel6 bank
+extern const TanhPerCoefficientSet g_errorRateModel7Coefficients; //!< ErrorRateModel7 bank
+extern const TanhPerCoefficientSet g_errorRateModel8Coefficients; //!< ErrorRateModel8 bank
+extern const TanhPerCoefficientSet g_errorRateModel9Coefficients; //!< ErrorRateModel9 bank
+
+/**
+ * \param model the model number N of ErrorRateModelN
+ *
+ * \return the coefficient bank of ErrorRateModelN, or 0 if there is none
+ */
+const TanhPerCoefficientSet * GetTanhPerCoefficientSet (uint32_t model);
+
+} //namespace ns3
+
+#endif /* TANH_PER_COEFFICIENTS_H */
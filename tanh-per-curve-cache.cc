@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <cmath>
+#include <limits>
+#include "tanh-per-curve-cache.h"
+#include "tanh-per-static-curves.h"
+
+namespace ns3 {
+
+TanhPerCurveCache::TanhPerCurveCache (const TanhPerCoefficientSet &coefficients)
+  : m_coefficients (&coefficients),
+    m_compute (GetTanhPerStaticCurveFunction (coefficients))
+{
+  for (uint32_t i = 0; i < BUCKETS; i++)
+    {
+      m_buckets[i].store (0, std::memory_order_relaxed);
+    }
+  for (uint32_t i = 0; i < STRIPES; i++)
+    {
+      m_hits[i].value.store (0, std::memory_order_relaxed);
+      m_misses[i].value.store (0, std::memory_order_relaxed);
+    }
+}
+
+TanhPerCurveCache::~TanhPerCurveCache ()
+{
+  Clear ();
+}
+
+void
+TanhPerCurveCache::Clear (void)
+{
+  for (uint32_t i = 0; i < BUCKETS; i++)
+    {
+      Node *node = m_buckets[i].exchange (0, std::memory_order_acquire);
+      while (node != 0)
+        {
+          Node *next = node->next;
+          delete node;
+          node = next;
+        }
+    }
+}
+
+void
+TanhPerCurveCache::ComputeParameters (const TanhPerCoefficients &c, uint32_t nbits,
+                                      double &a, double &b)
+{
+  a = c.c1 * std::exp (c.d1 * nbits) + c.c2 * std::exp (c.d2 * nbits);
+  b = c.c3 * std::exp (c.d3 * nbits) + c.c4 * std::exp (c.d4 * nbits);
+}
+
+void
+TanhPerCurveCache::SetRegimeSwitch (TanhPerCurve &curve)
+{
+  // PER < 0.1 <=> tanh (aLow - bLow * snr) > 0.8
+  double xSwitch = std::atanh (0.8);
+  if (curve.bLow != 0)
+    {
+      curve.switchDb = (curve.aLow - xSwitch) / curve.bLow;
+      curve.highAbove = curve.bLow < 0;
+    }
+  else
+    {
+      // flat curve: one regime for every SNR
+      curve.highAbove = true;
+      curve.switchDb = (curve.aLow > xSwitch) ? -std::numeric_limits<double>::infinity ()
+        : std::numeric_limits<double>::infinity ();
+    }
+}
+
+TanhPerCurveCache::Node *
+TanhPerCurveCache::Compute (uint8_t row, uint32_t nbits) const
+{
+  Node *node = new Node;
+  node->row = row;
+  node->nbits = nbits;
+  TanhPerCurve &curve = node->curve;
+  if (m_compute != 0)
+    {
+      m_compute (row, nbits, curve);
+      return node;
+    }
+  ComputeParameters (m_coefficients->low[row], nbits, curve.aLow, curve.bLow);
+  ComputeParameters (m_coefficients->high[row], nbits, curve.aHigh, curve.bHigh);
+  SetRegimeSwitch (curve);
+  return node;
+}
+
+uint32_t
+TanhPerCurveCache::GetStripe (void)
+{
+  static std::atomic<uint32_t> threads (0);
+  static thread_local uint32_t stripe = threads.fetch_add (1, std::memory_order_relaxed) % STRIPES;
+  return stripe;
+}
+
+const TanhPerCurve &
+TanhPerCurveCache::Lookup (uint8_t row, uint32_t nbits)
+{
+  std::atomic<Node *> &head = m_buckets[((nbits * 2654435761u) ^ (row * 40503u)) % BUCKETS];
+  Node *first = head.load (std::memory_order_acquire);
+  for (Node *node = first; node != 0; node = node->next)
+    {
+      if (node->nbits == nbits && node->row == row)
+        {
+          m_hits[GetStripe ()].value.fetch_add (1, std::memory_order_relaxed);
+          return node->curve;
+        }
+    }
+  m_misses[GetStripe ()].value.fetch_add (1, std::memory_order_relaxed);
+  Node *added = Compute (row, nbits);
+  added->next = first;
+  while (!head.compare_exchange_weak (added->next, added,
+                                      std::memory_order_release, std::memory_order_acquire))
+    {
+      // added->next is now the new head: look through the nodes other
+      // threads published since first
+      for (Node *node = added->next; node != first; node = node->next)
+        {
+          if (node->nbits == nbits && node->row == row)
+            {
+              delete added;
+              return node->curve;
+            }
+        }
+      first = added->next;
+    }
+  return added->curve;
+}
+
+uint64_t
+TanhPerCurveCache::GetHits (void) const
+{
+  uint64_t hits = 0;
+  for (uint32_t i = 0; i < STRIPES; i++)
+    {
+      hits += m_hits[i].value.load (std::memory_order_relaxed);
+    }
+  return hits;
+}
+
+uint64_t
+TanhPerCurveCache::GetMisses (void) const
+{
+  uint64_t misses = 0;
+  for (uint32_t i = 0; i < STRIPES; i++)
+    {
+      misses += m_misses[i].value.load (std::memory_order_relaxed);
+    }
+  return misses;
+}
+
+} //namespace ns3
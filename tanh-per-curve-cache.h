@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TANH_PER_CURVE_CACHE_H
+#define TANH_PER_CURVE_CACHE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "tanh-per-coefficients.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The tanh PER curve parameters of one coefficient row for a given chunk
+ * size, for both PER regimes.
+ *
+ * The arreglo_modelo1 fit takes over once the arreglo_modelo curve drops
+ * below PER = 0.1, i.e. once aLow - bLow * snr > atanh (0.8).  That happens
+ * on one side of switchDb = (aLow - atanh (0.8)) / bLow, so the regime is
+ * chosen with a single comparison before the curve is evaluated.  The
+ * choice only differs from testing -10 log10 (PER) > 10 on the evaluated
+ * curve, as the models used to do, when the SNR is within 1e-14 dB of
+ * switchDb, where rounding in tanh and log10 decides either way.
+ */
+struct TanhPerCurve
+{
+  double aLow;     //!< a_R from arreglo_modelo
+  double bLow;     //!< b_R from arreglo_modelo
+  double aHigh;    //!< a_R from arreglo_modelo1
+  double bHigh;    //!< b_R from arreglo_modelo1
+  double switchDb; //!< SNR (dB) at which the arreglo_modelo curve reaches PER = 0.1
+  bool highAbove;  //!< whether arreglo_modelo1 applies above (rather than below) switchDb
+
+  /**
+   * \param snrDb the SNR in dB
+   *
+   * \return true if the arreglo_modelo1 fit applies at snrDb
+   */
+  bool IsHighRegime (double snrDb) const
+  {
+    return highAbove ? snrDb > switchDb : snrDb < switchDb;
+  }
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Memoises the a_R / b_R parameters of a coefficient bank per
+ * (row, nbits) pair.  Simulations use only a handful of frame sizes, so
+ * once warm every lookup is served without evaluating any exp ().
+ *
+ * Lookup is lock-free, so a cache shared by models running on several
+ * threads never serialises them.  The curves live in immutable nodes of
+ * a fixed array of singly linked lists: a lookup walks one list, and a
+ * miss computes the curve and publishes its node with a single
+ * compare-and-swap on the list head.  Threads that race to add the same
+ * pair compute the same curve, and all but the first discard theirs, so
+ * every thread sees the values the single-threaded code would compute.
+ * Nodes are only freed with the cache.  The hit and miss counters are
+ * striped across cache lines so that counting does not make the threads
+ * contend either.
+ *
+ * Misses on the bank of one of ErrorRateModel2..9 are computed by code
+ * specialised on that bank (TanhPerStaticCurves); other banks are read
+ * at run time.
+ */
+class TanhPerCurveCache
+{
+public:
+  /**
+   * \param coefficients the bank the curves are derived from; it must
+   *        outlive the cache
+   */
+  TanhPerCurveCache (const TanhPerCoefficientSet &coefficients);
+  ~TanhPerCurveCache ();
+
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the curve parameters of the given row for nbits bits, valid
+   *         as long as the cache
+   */
+  const TanhPerCurve & Lookup (uint8_t row, uint32_t nbits);
+  /**
+   * \return the number of lookups served from the cache
+   */
+  uint64_t GetHits (void) const;
+  /**
+   * \return the number of lookups that had to compute a new curve
+   */
+  uint64_t GetMisses (void) const;
+
+  /**
+   * Compute the a_R and b_R parameters of one coefficient row.
+   *
+   * \param c the coefficient row
+   * \param nbits the number of bits in the chunk
+   * \param a set to a_R
+   * \param b set to b_R
+   */
+  static void ComputeParameters (const TanhPerCoefficients &c, uint32_t nbits,
+                                 double &a, double &b);
+  /**
+   * Set the switchDb and highAbove members of a curve from its aLow and
+   * bLow members.
+   *
+   * \param curve the curve
+   */
+  static void SetRegimeSwitch (TanhPerCurve &curve);
+
+private:
+  /// An immutable cached curve
+  struct Node
+  {
+    uint8_t row;        //!< coefficient row
+    uint32_t nbits;     //!< chunk size
+    TanhPerCurve curve; //!< curve of row for nbits bits
+    Node *next;         //!< next node of the same list
+  };
+  /// A counter alone on its cache line
+  struct Counter
+  {
+    std::atomic<uint64_t> value; //!< the count
+    char padding[64 - sizeof (std::atomic<uint64_t>)]; //!< keeps other counters off the line
+  };
+
+  /// Number of lists the nodes are hashed into
+  static const uint32_t BUCKETS = 1024;
+  /// Number of stripes of each counter
+  static const uint32_t STRIPES = 16;
+
+  TanhPerCurveCache (const TanhPerCurveCache &);
+  TanhPerCurveCache & operator= (const TanhPerCurveCache &);
+
+  /**
+   * Compute the curve of one coefficient row.
+   *
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return a new node holding the curve
+   */
+  Node * Compute (uint8_t row, uint32_t nbits) const;
+  /**
+   * Free every node.
+   */
+  void Clear (void);
+  /**
+   * \return the counter stripe of the calling thread
+   */
+  static uint32_t GetStripe (void);
+
+  const TanhPerCoefficientSet *m_coefficients; //!< the bank the curves are derived from
+  /// the curve computation specialised on m_coefficients, or 0 for the generic one
+  void (*m_compute) (uint8_t row, uint32_t nbits, TanhPerCurve &curve);
+  std::atomic<Node *> m_buckets[BUCKETS];      //!< lists of nodes by hash of (row, nbits)
+  Counter m_hits[STRIPES];                     //!< lookups served from m_buckets
+  Counter m_misses[STRIPES];                   //!< lookups that computed a node
+};
+
+} //namespace ns3
+
+#endif /* TANH_PER_CURVE_CACHE_H */
@@ -0,0 +1,896 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2010 The Boeing Company
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Authors: Gary Pei <guangyu.pei@boeing.com>
+ *
+ * Modified by: 
+ * Lesly Maygua <lesly.maygua@epn.edu.ec>
+ * Luis Urquiza <luis.urquiza@epn.edu.ec>
+ * Alejandro Flores <xalejandroflores@gmail.com>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "tanh-per-error-rate-model.h"
+#include "wifi-phy.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "tanh-per-coefficient-file.h"
+#include "tanh-per-table-file.h"
+#include "tanh-per-simd.h"
+#include "ofdm-fec-bound.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TanhPerErrorRateModel");
+
+NS_OBJECT_ENSURE_REGISTERED (TanhPerErrorRateModel);
+
+/// Number of chunks whose curve parameters are gathered before evaluating them
+static const size_t BATCH_BLOCK_SIZE = 64;
+/// Largest success rate difference accepted between the vector and libm kernels
+static const double VECTOR_KERNEL_TOLERANCE = 1e-13;
+/**
+ * Calls with fewer chunks than this, the widest vector, are evaluated
+ * with the libm kernels even if VectorKernel is set: the polynomials only
+ * pay off once they fill a vector, and the cut-off does not depend on the
+ * CPU, so the results stay the same on every CPU.
+ */
+static const size_t VECTOR_KERNEL_MIN_CHUNKS = 8;
+/// Default grid spacing of the lookup tables (dB)
+static const double LUT_DEFAULT_RESOLUTION = 0.01;
+/// Default largest error of the lookup tables
+static const double LUT_DEFAULT_MAX_ERROR = 1e-6;
+/// Default memory cap of the lookup tables (bytes)
+static const uint64_t LUT_DEFAULT_MAX_BYTES = 16 << 20;
+
+TypeId
+TanhPerErrorRateModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TanhPerErrorRateModel")
+    .SetParent<ErrorRateModel> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<TanhPerErrorRateModel> ()
+    .AddAttribute ("CoefficientSet",
+                   "The ErrorRateModelN (2..9) whose coefficients are used, "
+                   "or 0 for the set of the model's own TypeId.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::SetCoefficientSet,
+                                         &TanhPerErrorRateModel::GetCoefficientSet),
+                   MakeUintegerChecker<uint32_t> (0, 9))
+    .AddAttribute ("CoefficientFile",
+                   "A CSV or JSON file to load the coefficient set from instead "
+                   "of CoefficientSet, or empty.  It is compiled into FILE.bin, "
+                   "which later runs map instead of parsing FILE again.",
+                   StringValue (""),
+                   MakeStringAccessor (&TanhPerErrorRateModel::SetCoefficientFile,
+                                       &TanhPerErrorRateModel::GetCoefficientFile),
+                   MakeStringChecker ())
+    .AddAttribute ("TableFile",
+                   "A file of precomputed lookup tables, and the coefficient set "
+                   "they sample, to map read-only and share with every process "
+                   "on the host, or empty.  It overrides CoefficientSet and "
+                   "CoefficientFile and implies LookupTable.",
+                   StringValue (""),
+                   MakeStringAccessor (&TanhPerErrorRateModel::SetTableFile,
+                                       &TanhPerErrorRateModel::GetTableFile),
+                   MakeStringChecker ())
+    .AddAttribute ("CurveCacheHits",
+                   "Number of a_R/b_R parameter lookups served from the cache.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::GetCurveCacheHits),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("CurveCacheMisses",
+                   "Number of a_R/b_R parameter lookups that had to compute them.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::GetCurveCacheMisses),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("VectorKernel",
+                   "Evaluate batches with the polynomial AVX-512/AVX2/scalar "
+                   "kernels instead of std::log10 and std::tanh.  The results "
+                   "are identical on every CPU and within 1e-13 of the libm ones.  "
+                   "Calls of fewer than 8 chunks, such as GetChunkSuccessRate, "
+                   "keep the libm kernels, which are faster for them.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&TanhPerErrorRateModel::SetVectorKernel,
+                                        &TanhPerErrorRateModel::GetVectorKernel),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LookupTable",
+                   "Answer OFDM chunks by linear interpolation in per-(row, nbits) "
+                   "tables of the success rate over a uniform dB grid instead of "
+                   "evaluating tanh.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&TanhPerErrorRateModel::SetLookupTable,
+                                        &TanhPerErrorRateModel::GetLookupTable),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LookupTableResolution",
+                   "Grid spacing of the lookup tables in dB.  Steep curves get a "
+                   "finer grid where this one could not meet LookupTableMaxError.",
+                   DoubleValue (LUT_DEFAULT_RESOLUTION),
+                   MakeDoubleAccessor (&TanhPerErrorRateModel::SetLookupTableResolution,
+                                       &TanhPerErrorRateModel::GetLookupTableResolution),
+                   MakeDoubleChecker<double> (1e-6, 10))
+    .AddAttribute ("LookupTableMaxError",
+                   "Largest absolute success rate error of the lookup tables "
+                   "against the analytic curves, checked when they are built.",
+                   DoubleValue (LUT_DEFAULT_MAX_ERROR),
+                   MakeDoubleAccessor (&TanhPerErrorRateModel::SetLookupTableMaxError,
+                                       &TanhPerErrorRateModel::GetLookupTableMaxError),
+                   MakeDoubleChecker<double> (1e-12, 0.5))
+    .AddAttribute ("LookupTableMaxBytes",
+                   "Most bytes the lookup tables may hold; beyond it the least "
+                   "recently used (row, nbits) tables are dropped.  0 for no limit.",
+                   UintegerValue (LUT_DEFAULT_MAX_BYTES),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::SetLookupTableMaxBytes,
+                                         &TanhPerErrorRateModel::GetLookupTableMaxBytes),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("LookupTableMinUses",
+                   "Number of lookups of a (row, nbits) pair that builds its lookup "
+                   "tables; until then the pair is evaluated analytically.  1 builds "
+                   "every table on first use; larger values keep chunk sizes seen only "
+                   "a few times, as interference produces, from building tables.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::SetLookupTableMinUses,
+                                         &TanhPerErrorRateModel::GetLookupTableMinUses),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("LookupTableBytes",
+                   "Number of bytes held by the lookup tables.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::GetLookupTableBytes),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("LookupTableEvictions",
+                   "Number of lookup tables dropped to stay within LookupTableMaxBytes.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TanhPerErrorRateModel::GetLookupTableEvictions),
+                   MakeUintegerChecker<uint64_t> ())
+  ;
+  return tid;
+}
+
+TanhPerErrorRateModel::TanhPerErrorRateModel ()
+  : modelType (15),
+    m_defaultCoefficients (g_errorRateModel2Coefficients),
+    m_coefficientSet (0),
+    m_tableFile (0),
+    m_curves (TanhPerCurveStore::Get (g_errorRateModel2Coefficients)),
+    m_kernels (&GetTanhPerLibmKernels ()),
+    m_lookupTable (false),
+    m_lutResolution (LUT_DEFAULT_RESOLUTION),
+    m_lutMaxError (LUT_DEFAULT_MAX_ERROR),
+    m_lutMaxBytes (LUT_DEFAULT_MAX_BYTES),
+    m_lutMinUses (1)
+{
+}
+
+TanhPerErrorRateModel::TanhPerErrorRateModel (const TanhPerCoefficientSet &coefficients)
+  : modelType (15),
+    m_defaultCoefficients (coefficients),
+    m_coefficientSet (0),
+    m_tableFile (0),
+    m_curves (TanhPerCurveStore::Get (coefficients)),
+    m_kernels (&GetTanhPerLibmKernels ()),
+    m_lookupTable (false),
+    m_lutResolution (LUT_DEFAULT_RESOLUTION),
+    m_lutMaxError (LUT_DEFAULT_MAX_ERROR),
+    m_lutMaxBytes (LUT_DEFAULT_MAX_BYTES),
+    m_lutMinUses (1)
+{
+}
+
+void
+TanhPerErrorRateModel::SetErrorModel (uint32_t _model)
+{
+  modelType = _model;
+}
+
+uint32_t
+TanhPerErrorRateModel::GetModel (void) const
+{
+  return modelType;
+}
+
+void
+TanhPerErrorRateModel::SetCoefficientSet (uint32_t model)
+{
+  NS_LOG_FUNCTION (this << model);
+  NS_ABORT_MSG_IF (model != 0 && GetTanhPerCoefficientSet (model) == 0,
+                   "No tanh PER coefficient set for model " << model);
+  m_coefficientSet = model;
+  ConfigureCoefficients ();
+}
+
+uint32_t
+TanhPerErrorRateModel::GetCoefficientSet (void) const
+{
+  return m_coefficientSet;
+}
+
+void
+TanhPerErrorRateModel::SetCoefficientFile (std::string fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  if (fileName == m_coefficientFile)
+    {
+      return;
+    }
+  m_coefficientFile = fileName;
+  ConfigureCoefficients ();
+}
+
+std::string
+TanhPerErrorRateModel::GetCoefficientFile (void) const
+{
+  return m_coefficientFile;
+}
+
+void
+TanhPerErrorRateModel::SetTableFile (std::string fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  if (fileName == m_tableFileName)
+    {
+      return;
+    }
+  m_tableFileName = fileName;
+  m_tableFile = 0;
+  if (fileName != "")
+    {
+      std::string error;
+      m_tableFile = TanhPerTableFile::Open (fileName, error);
+      NS_ABORT_MSG_IF (m_tableFile == 0, "Cannot attach tanh PER tables: " << error);
+    }
+  ConfigureCoefficients ();
+}
+
+std::string
+TanhPerErrorRateModel::GetTableFile (void) const
+{
+  return m_tableFileName;
+}
+
+void
+TanhPerErrorRateModel::ConfigureCoefficients (void)
+{
+  const TanhPerCoefficientSet *coefficients = &m_defaultCoefficients;
+  if (m_tableFile != 0)
+    {
+      coefficients = &m_tableFile->GetCoefficients ();
+    }
+  else if (m_coefficientFile != "")
+    {
+      std::string error;
+      coefficients = TanhPerCoefficientFile::Load (m_coefficientFile, error);
+      NS_ABORT_MSG_IF (coefficients == 0, "Cannot load tanh PER coefficients: " << error);
+    }
+  else if (m_coefficientSet != 0)
+    {
+      coefficients = GetTanhPerCoefficientSet (m_coefficientSet);
+    }
+  m_curves = TanhPerCurveStore::Get (*coefficients);
+  ConfigureLookupTable ();
+}
+
+/**
+ * Check the vector kernels against libm and the portable polynomial
+ * kernels they mirror.
+ *
+ * \return true if they are usable
+ */
+static bool
+CheckVectorKernels (void)
+{
+  const TanhPerKernels &vector = GetTanhPerVectorKernels ();
+  double libmError = CheckTanhPerKernels (vector, GetTanhPerLibmKernels ());
+  double scalarError = CheckTanhPerKernels (vector, *GetTanhPerKernels ("scalar"));
+  NS_LOG_INFO ("tanh PER kernels " << vector.name << ": max error " << libmError
+               << " against libm, " << scalarError << " against scalar");
+  return libmError <= VECTOR_KERNEL_TOLERANCE && scalarError == 0;
+}
+
+void
+TanhPerErrorRateModel::SetVectorKernel (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  if (enable)
+    {
+      static bool checked = CheckVectorKernels ();
+      NS_ABORT_MSG_UNLESS (checked, "tanh PER kernels " << GetTanhPerVectorKernels ().name
+                           << " failed their accuracy check");
+      m_kernels = &GetTanhPerVectorKernels ();
+    }
+  else
+    {
+      m_kernels = &GetTanhPerLibmKernels ();
+    }
+}
+
+bool
+TanhPerErrorRateModel::GetVectorKernel (void) const
+{
+  return m_kernels != &GetTanhPerLibmKernels ();
+}
+
+const TanhPerKernels &
+TanhPerErrorRateModel::GetKernels (size_t n) const
+{
+  return n < VECTOR_KERNEL_MIN_CHUNKS ? GetTanhPerLibmKernels () : *m_kernels;
+}
+
+void
+TanhPerErrorRateModel::ConfigureLookupTable (void)
+{
+  m_luts = 0;
+  if (m_tableFile != 0)
+    {
+      m_luts = TanhPerLutStore::Get (m_curves, m_tableFile->GetResolution (),
+                                     m_tableFile->GetMaxError (), m_lutMaxBytes, m_lutMinUses,
+                                     m_tableFile);
+    }
+  else if (m_lookupTable)
+    {
+      double error = TanhPerLutStore::SelfTest (m_curves, m_lutResolution, m_lutMaxError);
+      NS_LOG_INFO ("tanh PER tables at " << m_lutResolution << " dB: max error " << error);
+      NS_ABORT_MSG_IF (!(error <= m_lutMaxError), "tanh PER tables at " << m_lutResolution
+                       << " dB are off by " << error << ", more than " << m_lutMaxError);
+      // acquired now rather than on first use, from whichever thread that is
+      m_luts = TanhPerLutStore::Get (m_curves, m_lutResolution, m_lutMaxError, m_lutMaxBytes,
+                                     m_lutMinUses);
+    }
+}
+
+void
+TanhPerErrorRateModel::SetLookupTable (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  m_lookupTable = enable;
+  ConfigureLookupTable ();
+}
+
+bool
+TanhPerErrorRateModel::GetLookupTable (void) const
+{
+  return m_lookupTable;
+}
+
+void
+TanhPerErrorRateModel::SetLookupTableResolution (double resolution)
+{
+  NS_LOG_FUNCTION (this << resolution);
+  m_lutResolution = resolution;
+  ConfigureLookupTable ();
+}
+
+double
+TanhPerErrorRateModel::GetLookupTableResolution (void) const
+{
+  return m_lutResolution;
+}
+
+void
+TanhPerErrorRateModel::SetLookupTableMaxError (double maxError)
+{
+  NS_LOG_FUNCTION (this << maxError);
+  m_lutMaxError = maxError;
+  ConfigureLookupTable ();
+}
+
+double
+TanhPerErrorRateModel::GetLookupTableMaxError (void) const
+{
+  return m_lutMaxError;
+}
+
+void
+TanhPerErrorRateModel::SetLookupTableMaxBytes (uint64_t maxBytes)
+{
+  NS_LOG_FUNCTION (this << maxBytes);
+  m_lutMaxBytes = maxBytes;
+  ConfigureLookupTable ();
+}
+
+uint64_t
+TanhPerErrorRateModel::GetLookupTableMaxBytes (void) const
+{
+  return m_lutMaxBytes;
+}
+
+void
+TanhPerErrorRateModel::SetLookupTableMinUses (uint32_t minUses)
+{
+  NS_LOG_FUNCTION (this << minUses);
+  m_lutMinUses = minUses;
+  ConfigureLookupTable ();
+}
+
+uint32_t
+TanhPerErrorRateModel::GetLookupTableMinUses (void) const
+{
+  return m_lutMinUses;
+}
+
+uint64_t
+TanhPerErrorRateModel::GetLookupTableBytes (void) const
+{
+  return m_luts ? m_luts->GetBytes () : 0;
+}
+
+uint64_t
+TanhPerErrorRateModel::GetLookupTableEvictions (void) const
+{
+  return m_luts ? m_luts->GetEvictions () : 0;
+}
+
+void
+TanhPerErrorRateModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_luts)
+    {
+      NS_LOG_INFO ("tanh PER lookup tables shared by " << m_luts->GetReferenceCount ()
+                   << " models: " << m_luts->GetSize () << " resident, "
+                   << m_luts->GetBytes () << " bytes (peak " << m_luts->GetPeakBytes ()
+                   << " of " << m_lutMaxBytes << "), " << m_luts->GetEvictions () << " evicted");
+    }
+  // the last model to let go of a store deletes it
+  m_luts = 0;
+  ErrorRateModel::DoDispose ();
+}
+
+uint64_t
+TanhPerErrorRateModel::GetCurveCacheHits (void) const
+{
+  return m_curves->GetHits ();
+}
+
+uint64_t
+TanhPerErrorRateModel::GetCurveCacheMisses (void) const
+{
+  return m_curves->GetMisses ();
+}
+
+double
+TanhPerErrorRateModel::GetFecChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const
+{
+  NS_LOG_FUNCTION (this << mode << snr << nbits);
+  uint16_t constellation;
+  uint32_t bValue;
+  if (!OfdmFecBound::GetParameters (mode, constellation, bValue))
+    {
+      return GetChunkSuccessRate (mode, txVector, snr, nbits);
+    }
+  return OfdmFecBound::GetChunkSuccessRate (constellation, bValue, snr, nbits);
+}
+
+void
+TanhPerErrorRateModel::GetFecChunkSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                                    const double *snr, const uint32_t *nbits,
+                                                    double *successRate, size_t n) const
+{
+  NS_LOG_FUNCTION (this << mode << n);
+  uint16_t constellation;
+  uint32_t bValue;
+  if (!OfdmFecBound::GetParameters (mode, constellation, bValue))
+    {
+      GetChunkSuccessRateBatch (mode, txVector, snr, nbits, successRate, n);
+      return;
+    }
+  OfdmFecBound::GetChunkSuccessRateBatch (constellation, bValue, snr, nbits, successRate, n);
+}
+
+/**
+ * \return the handlers of every WifiMode, shared by all models
+ */
+static TanhPerModeTable &
+GetModeTable (void)
+{
+  static TanhPerModeTable table;
+  return table;
+}
+
+//New error model adaptation based on paper
+void
+TanhPerErrorRateModel::GetCurveParameters (uint8_t row, const double *snrDb, const uint32_t *nbits,
+                                           double *a, double *b, size_t n) const
+{
+  const TanhPerCurve *curve = 0;
+  uint32_t curveNbits = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      if (curve == 0 || nbits[i] != curveNbits)
+        {
+          curveNbits = nbits[i];
+          curve = &m_curves->Lookup (row, curveNbits);
+        }
+      if (curve->IsHighRegime (snrDb[i]))
+        {
+          //(10 - en adelante): the arreglo_modelo fit is below PER = 0.1
+          a[i] = curve->aHigh;
+          b[i] = curve->bHigh;
+        }
+      else
+        {
+          a[i] = curve->aLow;
+          b[i] = curve->bLow;
+        }
+    }
+}
+
+double
+TanhPerErrorRateModel::GetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const
+{
+  double successRate;
+  GetChunkSuccessRateBatch (mode, txVector, &snr, &nbits, &successRate, 1);
+  return successRate;
+}
+
+void
+TanhPerErrorRateModel::GetChunkSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                                 const double *snr, const uint32_t *nbits,
+                                                 double *successRate, size_t n) const
+{
+  uint8_t handler = GetModeTable ().Lookup (mode);
+  if (handler < TanhPerModeTable::DSSS_DBPSK)
+    {
+      //OFDM, ERP-OFDM, HT or VHT: handler is the coefficient row
+      const TanhPerKernels &kernels = GetKernels (n);
+      double snrDb[BATCH_BLOCK_SIZE];
+      if (m_luts)
+        {
+          // one lookup per run of equal chunk sizes, whether or not it
+          // finds a table
+          std::shared_ptr<const TanhPerLut> lut;
+          uint32_t lutNbits = 0;
+          bool lookedUp = false;
+          double a[BATCH_BLOCK_SIZE];
+          double b[BATCH_BLOCK_SIZE];
+          for (size_t start = 0; start < n; start += BATCH_BLOCK_SIZE)
+            {
+              size_t count = std::min (n - start, BATCH_BLOCK_SIZE);
+              kernels.toDb (snr + start, snrDb, count);
+              for (size_t i = 0; i < count; )
+                {
+                  if (!lookedUp || nbits[start + i] != lutNbits)
+                    {
+                      lutNbits = nbits[start + i];
+                      lut = m_luts->Lookup (handler, lutNbits);
+                      lookedUp = true;
+                    }
+                  size_t end = i + 1;
+                  while (end < count && nbits[start + end] == lutNbits)
+                    {
+                      end++;
+                    }
+                  if (lut != 0)
+                    {
+                      for (; i < end; i++)
+                        {
+                          successRate[start + i] = lut->GetSuccessRate (snrDb[i]);
+                        }
+                      continue;
+                    }
+                  // not looked up often enough yet to have its table
+                  GetCurveParameters (handler, snrDb + i, nbits + start + i, a + i, b + i, end - i);
+                  kernels.success (snrDb + i, a + i, b + i, successRate + start + i, end - i);
+                  i = end;
+                }
+            }
+          return;
+        }
+      double a[BATCH_BLOCK_SIZE];
+      double b[BATCH_BLOCK_SIZE];
+      for (size_t start = 0; start < n; start += BATCH_BLOCK_SIZE)
+        {
+          size_t count = std::min (n - start, BATCH_BLOCK_SIZE);
+          kernels.toDb (snr + start, snrDb, count);
+          GetCurveParameters (handler, snrDb, nbits + start, a, b, count);
+          kernels.success (snrDb, a, b, successRate + start, count);
+        }
+      return;
+    }
+
+  double (*dsss) (double, uint32_t) = 0;
+  switch (handler)
+    {
+    case TanhPerModeTable::DSSS_DBPSK:
+      dsss = &DsssErrorRateModel::GetDsssDbpskSuccessRate;
+      break;
+    case TanhPerModeTable::DSSS_DQPSK:
+      dsss = &DsssErrorRateModel::GetDsssDqpskSuccessRate;
+      break;
+    case TanhPerModeTable::DSSS_CCK_5_5:
+      dsss = &DsssErrorRateModel::GetDsssDqpskCck5_5SuccessRate;
+      break;
+    case TanhPerModeTable::DSSS_CCK_11:
+      dsss = &DsssErrorRateModel::GetDsssDqpskCck11SuccessRate;
+      break;
+    default:
+      std::fill (successRate, successRate + n, 0.0);
+      return;
+    }
+  for (size_t i = 0; i < n; i++)
+    {
+      //the DSSS models have always been handed the SNR in dB here
+      successRate[i] = dsss (10 * std::log10 (snr[i]), nbits[i]);
+    }
+}
+
+double
+TanhPerErrorRateModel::GetChunkLogSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const
+{
+  double logSuccessRate;
+  GetChunkLogSuccessRateBatch (mode, txVector, &snr, &nbits, &logSuccessRate, 1);
+  return logSuccessRate;
+}
+
+void
+TanhPerErrorRateModel::GetChunkLogSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                                    const double *snr, const uint32_t *nbits,
+                                                    double *logSuccessRate, size_t n) const
+{
+  uint8_t handler = GetModeTable ().Lookup (mode);
+  if (handler < TanhPerModeTable::DSSS_DBPSK)
+    {
+      const TanhPerKernels &kernels = GetKernels (n);
+      double snrDb[BATCH_BLOCK_SIZE];
+      double a[BATCH_BLOCK_SIZE];
+      double b[BATCH_BLOCK_SIZE];
+      for (size_t start = 0; start < n; start += BATCH_BLOCK_SIZE)
+        {
+          size_t count = std::min (n - start, BATCH_BLOCK_SIZE);
+          kernels.toDb (snr + start, snrDb, count);
+          GetCurveParameters (handler, snrDb, nbits + start, a, b, count);
+          for (size_t i = 0; i < count; i++)
+            {
+              // 1 - (1 - tanh (x)) / 2 = 1 / (1 + exp (-2 x)), whose log is
+              // -softplus (-2 x); split so that exp () never overflows and
+              // log1p () keeps the digits of a success rate close to 1
+              double z = -2 * (a[i] - b[i] * snrDb[i]);
+              logSuccessRate[start + i] = -(std::max (z, 0.0) + std::log1p (std::exp (-std::fabs (z))));
+            }
+        }
+      return;
+    }
+
+  // the DSSS formulas have no closed log form; take the log of their result
+  GetChunkSuccessRateBatch (mode, txVector, snr, nbits, logSuccessRate, n);
+  for (size_t i = 0; i < n; i++)
+    {
+      logSuccessRate[i] = std::log (logSuccessRate[i]);
+    }
+}
+
+double
+TanhPerErrorRateModel::GetFrameSuccessRate (WifiMode mode, WifiTxVector txVector,
+                                            const double *snr, const uint32_t *nbits, size_t n) const
+{
+  double successRate[BATCH_BLOCK_SIZE];
+  double frameSuccessRate = 1;
+  for (size_t start = 0; start < n; start += BATCH_BLOCK_SIZE)
+    {
+      size_t count = std::min (n - start, BATCH_BLOCK_SIZE);
+      GetChunkSuccessRateBatch (mode, txVector, snr + start, nbits + start, successRate, count);
+      for (size_t i = 0; i < count; i++)
+        {
+          frameSuccessRate *= successRate[i];
+        }
+    }
+  return frameSuccessRate;
+}
+
+double
+TanhPerErrorRateModel::GetFrameLogSuccessRate (WifiMode mode, WifiTxVector txVector,
+                                               const double *snr, const uint32_t *nbits, size_t n) const
+{
+  double logSuccessRate[BATCH_BLOCK_SIZE];
+  double frameLogSuccessRate = 0;
+  for (size_t start = 0; start < n; start += BATCH_BLOCK_SIZE)
+    {
+      size_t count = std::min (n - start, BATCH_BLOCK_SIZE);
+      GetChunkLogSuccessRateBatch (mode, txVector, snr + start, nbits + start, logSuccessRate, count);
+      for (size_t i = 0; i < count; i++)
+        {
+          frameLogSuccessRate += logSuccessRate[i];
+        }
+    }
+  return frameLogSuccessRate;
+}
+
+double
+TanhPerErrorRateModel::GetSnrForTargetPer (WifiMode mode, uint32_t nbits, double per) const
+{
+  uint8_t handler = GetModeTable ().Lookup (mode);
+  if (handler < TanhPerModeTable::DSSS_DBPSK || handler > TanhPerModeTable::DSSS_CCK_11)
+    {
+      return std::pow (10.0, ComputeSnrForTargetPer (mode, handler, nbits, per) / 10);
+    }
+  double snrDb;
+  if (!m_curves->FindDsssThreshold (handler, nbits, per, snrDb))
+    {
+      snrDb = ComputeSnrForTargetPer (mode, handler, nbits, per);
+      m_curves->AddDsssThreshold (handler, nbits, per, snrDb);
+    }
+  return std::pow (10.0, snrDb / 10);
+}
+
+double
+TanhPerErrorRateModel::ComputeSnrForTargetPer (WifiMode mode, uint8_t handler, uint32_t nbits, double per) const
+{
+  const double inf = std::numeric_limits<double>::infinity ();
+  if (!(per > 0))
+    {
+      return inf;
+    }
+  if (per >= 1)
+    {
+      return -inf;
+    }
+  if (handler < TanhPerModeTable::DSSS_DBPSK)
+    {
+      const TanhPerCurve &curve = m_curves->Lookup (handler, nbits);
+      // PER <= per <=> a_R - b_R * snr >= atanh (1 - 2 per), written so
+      // that a tiny per keeps its digits
+      double x = 0.5 * (std::log1p (-per) - std::log (per));
+      // the answer is the upper end of the SNRs that miss the target
+      double threshold = -inf;
+      for (uint32_t high = 0; high < 2; high++)
+        {
+          double a = high ? curve.aHigh : curve.aLow;
+          double b = high ? curve.bHigh : curve.bLow;
+          // the SNRs at which this regime applies...
+          double from = -inf;
+          double to = inf;
+          if (bool (high) == curve.highAbove)
+            {
+              from = curve.switchDb;
+            }
+          else
+            {
+              to = curve.switchDb;
+            }
+          // ...and at which its curve misses the target
+          if (b < 0)
+            {
+              to = std::min (to, (a - x) / b);
+            }
+          else if (b > 0)
+            {
+              from = std::max (from, (a - x) / b);
+            }
+          else if (a >= x)
+            {
+              continue;
+            }
+          if (from < to)
+            {
+              threshold = std::max (threshold, to);
+            }
+        }
+      return threshold;
+    }
+  if (handler > TanhPerModeTable::DSSS_CCK_11)
+    {
+      // no fit for this mode: never received
+      return inf;
+    }
+
+  // the DSSS formulas have no closed inverse; their success rate grows
+  // with the SNR over the range the models are meant for, so the answer
+  // is where it crosses the target
+  WifiTxVector txVector;
+  double lowDb = 0;
+  double highDb = 100;
+  if (1 - GetChunkSuccessRate (mode, txVector, std::pow (10.0, highDb / 10), nbits) > per)
+    {
+      return inf;
+    }
+  if (1 - GetChunkSuccessRate (mode, txVector, std::pow (10.0, lowDb / 10), nbits) <= per)
+    {
+      return lowDb;
+    }
+  while (highDb - lowDb > 1e-9)
+    {
+      double midDb = (lowDb + highDb) / 2;
+      if (1 - GetChunkSuccessRate (mode, txVector, std::pow (10.0, midDb / 10), nbits) <= per)
+        {
+          highDb = midDb;
+        }
+      else
+        {
+          lowDb = midDb;
+        }
+    }
+  return highDb;
+}
+
+WifiMode
+TanhPerErrorRateModel::SelectBestMode (double snr, uint32_t nbits, const std::vector<WifiMode> &modes,
+                                       WifiTxVector txVector) const
+{
+  NS_ASSERT_MSG (!modes.empty (), "no candidate mode");
+  double snrDb;
+  GetKernels (1).toDb (&snr, &snrDb, 1);
+  size_t best = 0;
+  double bestGoodput = -1;
+  for (size_t start = 0; start < modes.size (); start += BATCH_BLOCK_SIZE)
+    {
+      size_t count = std::min (modes.size () - start, BATCH_BLOCK_SIZE);
+      // gather the curves of the OFDM candidates into one kernel call
+      double candidateSnrDb[BATCH_BLOCK_SIZE];
+      double a[BATCH_BLOCK_SIZE];
+      double b[BATCH_BLOCK_SIZE];
+      double successRate[BATCH_BLOCK_SIZE];
+      size_t ofdm[BATCH_BLOCK_SIZE];
+      size_t nOfdm = 0;
+      for (size_t i = 0; i < count; i++)
+        {
+          const WifiMode &mode = modes[start + i];
+          uint8_t handler = GetModeTable ().Lookup (mode);
+          if (handler >= TanhPerModeTable::DSSS_DBPSK)
+            {
+              successRate[i] = GetChunkSuccessRate (mode, txVector, snr, nbits);
+            }
+          else if (std::shared_ptr<const TanhPerLut> lut = m_luts ? m_luts->Lookup (handler, nbits)
+                                                                  : std::shared_ptr<const TanhPerLut> ())
+            {
+              successRate[i] = lut->GetSuccessRate (snrDb);
+            }
+          else
+            {
+              candidateSnrDb[nOfdm] = snrDb;
+              GetCurveParameters (handler, &snrDb, &nbits, &a[nOfdm], &b[nOfdm], 1);
+              ofdm[nOfdm++] = i;
+            }
+        }
+      double ofdmSuccessRate[BATCH_BLOCK_SIZE];
+      GetKernels (nOfdm).success (candidateSnrDb, a, b, ofdmSuccessRate, nOfdm);
+      for (size_t k = 0; k < nOfdm; k++)
+        {
+          successRate[ofdm[k]] = ofdmSuccessRate[k];
+        }
+
+      for (size_t i = 0; i < count; i++)
+        {
+          // the DSSS models, handed the SNR in dB, give inf or NaN below 0 dB
+          if (!(successRate[i] >= 0 && successRate[i] <= 1))
+            {
+              continue;
+            }
+          double rate = modes[start + i].GetDataRate (txVector.GetChannelWidth (),
+                                                      txVector.GetGuardInterval (),
+                                                      txVector.GetNss ());
+          double goodput = rate * successRate[i];
+          if (goodput > bestGoodput)
+            {
+              best = start + i;
+              bestGoodput = goodput;
+            }
+        }
+    }
+  return modes[best];
+}
+
+} //namespace ns3
@@ -0,0 +1,430 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2010 The Boeing Company
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Gary Pei <guangyu.pei@boeing.com>
+ * Modified by: 
+ * Lesly Maygua <lesly.maygua@epn.edu.ec>
+ * Luis Urquiza <luis.urquiza@epn.edu.ec>
+ */
+
+#ifndef TANH_PER_ERROR_RATE_MODEL_H
+#define TANH_PER_ERROR_RATE_MODEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "wifi-mode.h"
+#include "wifi-tx-vector.h"
+#include "error-rate-model.h"
+#include "dsss-error-rate-model.h"
+#include "tanh-per-curve-cache.h"
+#include "tanh-per-lut.h"
+#include "tanh-per-mode-table.h"
+#include "tanh-per-model-store.h"
+#include "tanh-per-simd.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * A table-driven error rate model for the tanh PER fits of models 2 to 9.
+ * For OFDM modulation the packet error rate of a chunk is
+ * (1 - tanh (a_R - b_R * snr)) / 2, with a_R and b_R derived from one row
+ * of a TanhPerCoefficientSet; which set is used is chosen by the
+ * CoefficientSet attribute or by the ErrorRateModelN subclass, unless the
+ * CoefficientFile attribute names a file to load it from, or the TableFile
+ * attribute a file of precomputed tables that holds it.  For DSSS
+ * modulations (802.11b), the model uses the DsssErrorRateModel.
+ */
+class TanhPerErrorRateModel : public ErrorRateModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  TanhPerErrorRateModel ();
+  /**
+   * \param coefficients the coefficient set used when the CoefficientSet
+   *        attribute is 0; it must live for the whole program
+   */
+  TanhPerErrorRateModel (const TanhPerCoefficientSet &coefficients);
+
+  virtual double GetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const;
+  /**
+   * Evaluate GetChunkSuccessRate for n chunks sent with the same mode.
+   * The mode is dispatched once, the curve parameters are looked up once
+   * per run of equal nbits, and the curves are evaluated in a tight loop.
+   *
+   * \param mode the WifiMode of all chunks
+   * \param txVector the TXVECTOR of all chunks
+   * \param snr the SNR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk
+   * \param successRate set to the success rate of each chunk
+   * \param n the number of chunks
+   */
+  void GetChunkSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                 const double *snr, const uint32_t *nbits,
+                                 double *successRate, size_t n) const;
+  /**
+   * Return the natural log of GetChunkSuccessRate, so that the success
+   * rate of a frame can be accumulated as a sum over its chunks.  For
+   * OFDM modulation it is evaluated as -log (1 + exp (2 (b_R * snr - a_R))),
+   * which keeps full relative precision both when the success rate is
+   * tiny and when it is so close to 1 that GetChunkSuccessRate rounds it
+   * to 1.  The curves are always evaluated with std::exp and std::log1p,
+   * whatever the LookupTable and VectorKernel attributes; only the SNR to
+   * dB conversion follows VectorKernel.
+   *
+   * \param mode the WifiMode the chunk is sent with
+   * \param txVector the TXVECTOR of the chunk
+   * \param snr the SNR of the chunk (ratio, not dB)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return log of the success rate of the chunk, -infinity if it is 0
+   */
+  double GetChunkLogSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const;
+  /**
+   * Evaluate GetChunkLogSuccessRate for n chunks sent with the same mode.
+   *
+   * \param mode the WifiMode of all chunks
+   * \param txVector the TXVECTOR of all chunks
+   * \param snr the SNR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk
+   * \param logSuccessRate set to the log of the success rate of each chunk
+   * \param n the number of chunks
+   */
+  void GetChunkLogSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                    const double *snr, const uint32_t *nbits,
+                                    double *logSuccessRate, size_t n) const;
+  /**
+   * Return the success rate of a whole frame: the product of the success
+   * rates of its n chunks, as InterferenceHelper accumulates them chunk
+   * by chunk, but with the mode dispatched once and the chunks evaluated
+   * by GetChunkSuccessRateBatch.  The result is the same as multiplying
+   * GetChunkSuccessRate over the chunks in order; with VectorKernel, only
+   * to within the error of the vector kernels once there are 8 chunks or
+   * more, as GetChunkSuccessRate itself keeps the libm kernels.
+   *
+   * \param mode the WifiMode the frame is sent with
+   * \param txVector the TXVECTOR of the frame
+   * \param snr the SINR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk, i.e. its duration
+   *        times the data rate of mode
+   * \param n the number of chunks
+   *
+   * \return the probability that every chunk is received
+   */
+  double GetFrameSuccessRate (WifiMode mode, WifiTxVector txVector,
+                              const double *snr, const uint32_t *nbits, size_t n) const;
+  /**
+   * Return the log of the success rate of a whole frame, as the sum of
+   * GetChunkLogSuccessRate over its n chunks.
+   *
+   * \param mode the WifiMode the frame is sent with
+   * \param txVector the TXVECTOR of the frame
+   * \param snr the SINR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk
+   * \param n the number of chunks
+   *
+   * \return log of the probability that every chunk is received
+   */
+  double GetFrameLogSuccessRate (WifiMode mode, WifiTxVector txVector,
+                                 const double *snr, const uint32_t *nbits, size_t n) const;
+  /**
+   * Return the SNR from which on a chunk meets a target packet error
+   * rate, e.g. the threshold of a rate control algorithm.  For OFDM
+   * modulation the tanh curve is inverted in closed form,
+   * snr_dB = (a_R - atanh (1 - 2 per)) / b_R, in each regime over the SNRs
+   * where it applies.  The two fits do not meet exactly at the regime
+   * switch, so the packet error rate may briefly reach the target below
+   * the switch and exceed it again above; the threshold is past both.
+   * DSSS modes are searched by bisection from 0 to 100 dB, and the
+   * answers are remembered by the TanhPerCurveStore of the bank.
+   *
+   * \param mode the WifiMode the chunk is sent with
+   * \param nbits the number of bits in the chunk
+   * \param per the target packet error rate, in (0, 1)
+   *
+   * \return the smallest SNR (ratio, not dB) above which the packet error
+   *         rate is at most per; 0 for a per of 1 or more, infinity if it
+   *         is never met.  A DSSS mode that meets per from 0 dB on
+   *         returns 1, the lower end of its search.
+   */
+  double GetSnrForTargetPer (WifiMode mode, uint32_t nbits, double per) const;
+  /**
+   * Return the candidate mode with the highest goodput, data rate times
+   * chunk success rate, at the given SNR.  The success rates of all OFDM
+   * candidates are evaluated together by one call of the array kernels
+   * (or read from the lookup tables, if they are enabled), so the result
+   * is the argmax of GetChunkSuccessRate times the data rate, obtained
+   * without one call and one mode dispatch per candidate.  (With
+   * VectorKernel and 8 OFDM candidates or more, the success rates are
+   * those of the vector kernels, within 1e-13 of GetChunkSuccessRate.)  Ties go to the
+   * candidate listed first.  Candidates whose success rate is not a
+   * probability, as the DSSS models give below 0 dB, are passed over;
+   * if every candidate is, the first one is returned.
+   *
+   * \param snr the SNR (ratio, not dB)
+   * \param nbits the number of bits in the chunk
+   * \param modes the candidate modes; must not be empty
+   * \param txVector the TXVECTOR whose channel width, guard interval and
+   *        number of spatial streams give the data rate of each candidate
+   *
+   * \return the candidate with the highest goodput
+   */
+  WifiMode SelectBestMode (double snr, uint32_t nbits, const std::vector<WifiMode> &modes,
+                           WifiTxVector txVector) const;
+
+  /**
+   * Return the success rate of a chunk under the analytic FEC model of
+   * the NIST error rate model (see OfdmFecBound) instead of the tanh
+   * fits: the union bound Pe of the code rate on the decoded bit error
+   * rate, from the uncoded bit error rate of the constellation over
+   * AWGN, and (1 - Pe)^nbits.  It serves as an analytic reference next
+   * to the fits.  Modes the bound does not cover (DSSS) get
+   * GetChunkSuccessRate.
+   *
+   * \param mode the WifiMode the chunk is sent with
+   * \param txVector the TXVECTOR of the chunk
+   * \param snr the SNR of the chunk (ratio, not dB)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the success rate of the chunk
+   */
+  double GetFecChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint32_t nbits) const;
+  /**
+   * Evaluate GetFecChunkSuccessRate for n chunks sent with the same mode,
+   * with the mode dispatched and the distance spectrum looked up once.
+   *
+   * \param mode the WifiMode of all chunks
+   * \param txVector the TXVECTOR of all chunks
+   * \param snr the SNR of each chunk (ratio, not dB)
+   * \param nbits the number of bits in each chunk
+   * \param successRate set to the success rate of each chunk
+   * \param n the number of chunks
+   */
+  void GetFecChunkSuccessRateBatch (WifiMode mode, WifiTxVector txVector,
+                                    const double *snr, const uint32_t *nbits,
+                                    double *successRate, size_t n) const;
+
+  /**
+   * \return the value last given to SetErrorModel
+   */
+  uint32_t GetModel (void) const;
+  /**
+   * Record a model number for callers that tag the model they installed;
+   * it does not change the curves (see SetCoefficientSet).
+   *
+   * \param _model the model number
+   */
+  virtual void SetErrorModel (uint32_t _model);
+  uint32_t modelType; //!< the value last given to SetErrorModel
+
+  /**
+   * \return the number of curve parameter lookups served from the
+   *         per-(row, nbits) cache
+   */
+  uint64_t GetCurveCacheHits (void) const;
+  /**
+   * \return the number of curve parameter lookups that had to compute
+   *         the parameters and add them to the per-(row, nbits) cache
+   */
+  uint64_t GetCurveCacheMisses (void) const;
+
+  /**
+   * Select the coefficient set of ErrorRateModelN.
+   *
+   * \param model the model number N (2..9), or 0 for the set this object
+   *        was constructed with
+   */
+  void SetCoefficientSet (uint32_t model);
+  /**
+   * \return the model number of the selected coefficient set, or 0 if it
+   *         is the set this object was constructed with
+   */
+  uint32_t GetCoefficientSet (void) const;
+  /**
+   * Use the coefficient set of a CSV or JSON file instead of a built-in
+   * one (see TanhPerCoefficientFile).  The program aborts if the file
+   * cannot be loaded.
+   *
+   * \param fileName the coefficient file, or "" for the set selected by
+   *        SetCoefficientSet
+   */
+  void SetCoefficientFile (std::string fileName);
+  /**
+   * \return the coefficient file in use, or "" for a built-in set
+   */
+  std::string GetCoefficientFile (void) const;
+  /**
+   * Attach a file of precomputed lookup tables (see TanhPerTableFile):
+   * the model takes its coefficient set from the file and answers OFDM
+   * chunks from the tables, as with SetLookupTable, at the resolution and
+   * error bound the file was built with.  Chunk sizes the file does not
+   * hold get tables of their own.  The program aborts if the file cannot
+   * be attached.
+   *
+   * \param fileName the table file, or "" to detach it
+   */
+  void SetTableFile (std::string fileName);
+  /**
+   * \return the table file attached, or ""
+   */
+  std::string GetTableFile (void) const;
+  /**
+   * Choose the kernels used by GetChunkSuccessRateBatch.  The first time
+   * the vector kernels are enabled they are checked against libm over
+   * every coefficient row; the program aborts if they fail.  Calls of
+   * fewer than 8 chunks, GetChunkSuccessRate among them, use the libm
+   * kernels either way: for them the polynomials are slower.
+   *
+   * \param enable true for the fastest polynomial kernels the CPU
+   *        supports, false for the bit-exact std::log10 / std::tanh ones
+   */
+  void SetVectorKernel (bool enable);
+  /**
+   * \return true if the polynomial kernels are in use
+   */
+  bool GetVectorKernel (void) const;
+  /**
+   * Answer OFDM chunks from per-(row, nbits) tables of the success rate
+   * over a uniform dB grid instead of evaluating tanh.  Whenever the
+   * tables are enabled or reconfigured they are checked against the
+   * curves over every coefficient row; the program aborts if any is off
+   * by more than the LookupTableMaxError attribute.
+   *
+   * \param enable true to use the tables
+   */
+  void SetLookupTable (bool enable);
+  /**
+   * \return true if the tables are in use
+   */
+  bool GetLookupTable (void) const;
+  /**
+   * \param resolution the largest grid spacing of the tables (dB)
+   */
+  void SetLookupTableResolution (double resolution);
+  /**
+   * \return the largest grid spacing of the tables (dB)
+   */
+  double GetLookupTableResolution (void) const;
+  /**
+   * \param maxError the largest absolute success rate error allowed
+   *        against the analytic curves
+   */
+  void SetLookupTableMaxError (double maxError);
+  /**
+   * \return the largest absolute success rate error allowed against the
+   *         analytic curves
+   */
+  double GetLookupTableMaxError (void) const;
+  /**
+   * \param maxBytes the most bytes the lookup tables may hold before the
+   *        least recently used ones are dropped, or 0 for no limit
+   */
+  void SetLookupTableMaxBytes (uint64_t maxBytes);
+  /**
+   * \return the most bytes the lookup tables may hold, or 0 for no limit
+   */
+  uint64_t GetLookupTableMaxBytes (void) const;
+  /**
+   * \param minUses the number of lookups of a (row, nbits) pair that
+   *        builds its lookup tables; earlier lookups evaluate the curve
+   */
+  void SetLookupTableMinUses (uint32_t minUses);
+  /**
+   * \return the number of lookups of a (row, nbits) pair that builds its
+   *         lookup tables
+   */
+  uint32_t GetLookupTableMinUses (void) const;
+  /**
+   * \return the number of bytes held by the lookup tables
+   */
+  uint64_t GetLookupTableBytes (void) const;
+  /**
+   * \return the number of lookup tables dropped to stay within the cap
+   */
+  uint64_t GetLookupTableEvictions (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Acquire the curve store of the coefficient set chosen by
+   * m_tableFileName, m_coefficientFile or m_coefficientSet, and drop
+   * everything derived from the previous one.
+   */
+  void ConfigureCoefficients (void);
+  /**
+   * Drop the tables and, if they are enabled, run the self-test of the
+   * current settings and acquire their store.  The tables of a table
+   * file were checked when it was written and are not tested again.
+   */
+  void ConfigureLookupTable (void);
+  /**
+   * Select the curve parameters of n OFDM chunks, taking the regime of
+   * each from its SNR.
+   *
+   * \param row the coefficient row of the chunks' mode
+   * \param snrDb the SNR of each chunk (dB)
+   * \param nbits the number of bits in each chunk
+   * \param a set to a_R of each chunk
+   * \param b set to b_R of each chunk
+   * \param n the number of chunks
+   */
+  void GetCurveParameters (uint8_t row, const double *snrDb, const uint32_t *nbits,
+                           double *a, double *b, size_t n) const;
+  /**
+   * \param n the number of chunks of a call
+   *
+   * \return the kernels that evaluate them: m_kernels, or the libm ones
+   *         for calls too short to fill a vector
+   */
+  const TanhPerKernels & GetKernels (size_t n) const;
+  /**
+   * Compute GetSnrForTargetPer for one dispatched mode.
+   *
+   * \param mode the WifiMode the chunk is sent with
+   * \param handler the mode table entry of mode
+   * \param nbits the number of bits in the chunk
+   * \param per the target packet error rate, in (0, 1)
+   *
+   * \return the smallest SNR (dB) above which the packet error rate is at
+   *         most per
+   */
+  double ComputeSnrForTargetPer (WifiMode mode, uint8_t handler, uint32_t nbits, double per) const;
+
+  const TanhPerCoefficientSet &m_defaultCoefficients; //!< set selected by CoefficientSet 0
+  uint32_t m_coefficientSet;              //!< value of the CoefficientSet attribute
+  std::string m_coefficientFile;          //!< value of the CoefficientFile attribute
+  std::string m_tableFileName;            //!< value of the TableFile attribute
+  const TanhPerTableFile *m_tableFile;    //!< the attached table file, or 0
+  Ptr<TanhPerCurveStore> m_curves;        //!< shared a_R / b_R parameters by (row, nbits)
+  const TanhPerKernels *m_kernels;        //!< array kernels used by the batch evaluation
+  bool m_lookupTable;                     //!< whether OFDM chunks are answered from m_luts
+  double m_lutResolution;                 //!< largest grid spacing of the tables (dB)
+  double m_lutMaxError;                   //!< largest error allowed for the tables
+  uint64_t m_lutMaxBytes;                 //!< memory cap of the tables, or 0
+  uint32_t m_lutMinUses;                  //!< lookups of a pair that build its tables
+  Ptr<TanhPerLutStore> m_luts;            //!< shared tables, while they are enabled
+};
+
+} //namespace ns3
+
+#endif /* TANH_PER_ERROR_RATE_MODEL_H */
@@ -0,0 +1,1320 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Offline fitter of the tanh PER coefficient banks (the arreglo_modelo
+// and arreglo_modelo1 tables) from PER measurements.
+//
+// Place this file in the ns-3 "scratch/" directory and run e.g.
+//   ./waf --run "tanh-per-fit --samples=per.csv --output=my-fit.csv"
+//
+// The samples are CSV lines "mode,nbits,snr_db,per[,packets]", optionally
+// after a "mode,..." header line; '#' starts a comment.  mode is a
+// coefficient row (0 = BPSK 1/2 .. 7 = 64-QAM 3/4) or the unique name of
+// an OFDM, ERP-OFDM or HT mode (e.g. OfdmRate24Mbps), and packets the
+// number of packets the PER was measured over (1 if not given).  Samples
+// with PER of 0 or 1 carry no information on the curve and are skipped.
+//
+// The eight coefficient rows are fitted in parallel, one per thread at a
+// time, by weighted least squares on y = atanh (1 - 2 PER) = a_R - b_R *
+// snr_db, each sample weighted by the inverse variance of its y,
+// proportional to packets * PER * (1 - PER):
+//   1. a_R and b_R of every chunk size, by linear least squares;
+//   2. c1 c2 d1 d2 to those a_R and c3 c4 d3 d4 to those b_R, by
+//      Levenberg-Marquardt started from the best exponent pairs of a grid;
+//   3. all eight coefficients jointly to the samples, by Levenberg-
+//      Marquardt started from step 2.
+// The samples of each chunk size are first split between the regimes.
+// The models switch to arreglo_modelo1 where the arreglo_modelo curve
+// drops below PER = 0.1, but the arreglo_modelo1 curve may start above it,
+// so the split is not by the PER of the samples: it is the SNR threshold
+// that lets a straight line in y on either side fit best.  The samples
+// then only enter the fit through six sums per (regime, chunk size), so
+// every Levenberg-Marquardt iteration costs a few operations per chunk
+// size however many samples there are.  Regimes with fewer than four
+// chunk sizes get a single exponential (two or three sizes) or a
+// constant (one size).
+//
+// The fit is written as a CSV coefficient file for the CoefficientFile
+// attribute of TanhPerErrorRateModel, and, with --format=cxx, printed as
+// a TanhPerBank specialisation for tanh-per-banks.h.  Fit statistics and
+// timings go to stderr.
+//
+// Self-check:
+//   --synthesize=FILE    write the PER of ErrorRateModel<--model> at
+//                        every 20 MHz OFDM rate, several chunk sizes and
+//                        an SNR grid (--snr-step dB) to FILE and exit;
+//                        --packets=K draws each PER as the error rate of
+//                        K simulated packets instead
+//   --reference=N        report the largest PER deviation of the fit from
+//                        ErrorRateModelN at the samples, leaving out those
+//                        between the regime switches of the two, where the
+//                        curves jump; --max-deviation=X makes the program
+//                        exit with status 2 if it exceeds X
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/tanh-per-coefficient-file.h"
+#include "ns3/tanh-per-curve-cache.h"
+#include "ns3/tanh-per-mode-table.h"
+
+using namespace ns3;
+
+/// Largest number of Levenberg-Marquardt iterations of one fit
+static const uint32_t MAX_ITERATIONS = 5000;
+/// Number of grid exponent pairs each exponential fit is started from
+static const uint32_t STARTS = 16;
+
+/**
+ * One PER sample.
+ */
+struct FitSample
+{
+  double snr; //!< snr_db
+  double y;   //!< atanh (1 - 2 PER)
+  double w;   //!< weight, the inverse of the variance of y up to a constant
+};
+
+/// The samples of one row, by chunk size
+typedef std::map<uint32_t, std::vector<FitSample> > FitSizes;
+
+/**
+ * The samples of one thread's share of the file.
+ */
+struct ParseResult
+{
+  FitSizes sizes[8];     //!< samples by row and chunk size
+  uint64_t samples;      //!< samples read
+  uint64_t skipped;      //!< samples with PER of 0 or 1
+  uint64_t malformed;    //!< lines that could not be parsed
+  std::string firstBad;  //!< the first of them
+};
+
+/**
+ * Weighted sums over the samples of one (row, regime, chunk size) that
+ * are sufficient for the least squares fit of y = a - b * snr.
+ */
+struct FitMoments
+{
+  double count; //!< number of samples
+  double n;     //!< sum of the weights
+  double s;     //!< sum of snr_db
+  double ss;    //!< sum of snr_db^2
+  double y;     //!< sum of y
+  double ys;    //!< sum of y * snr_db
+  double yy;    //!< sum of y^2
+};
+
+/**
+ * One chunk size of a regime.
+ */
+struct FitGroup
+{
+  double x;     //!< chunk size divided by the largest one of the row
+  FitMoments m; //!< the moments of its samples in the regime
+  bool solved;  //!< whether a and b could be fitted from this size alone
+  double a;     //!< a_R of the size alone
+  double b;     //!< b_R of the size alone
+};
+
+/**
+ * The fit of one regime of a coefficient row.
+ */
+struct FitRegime
+{
+  std::vector<FitGroup> groups; //!< the chunk sizes with samples in the regime
+  double samples;               //!< number of samples in the regime
+  double weight;                //!< sum of their weights
+  TanhPerCoefficients result;   //!< the fitted row
+  double rms;                   //!< weighted rms residual of y
+  uint32_t iterations;          //!< Levenberg-Marquardt iterations of step 3
+  std::string error;            //!< why the regime could not be fitted, if it could not
+};
+
+/**
+ * The fit of one coefficient row, in both regimes.
+ */
+struct FitRowProblem
+{
+  uint32_t row;             //!< the coefficient row
+  const FitSizes *sizes;    //!< its samples
+  FitRegime regimes[2];     //!< arreglo_modelo and arreglo_modelo1
+  uint64_t crossed;         //!< samples on the other side of the fitted regime switch
+};
+
+/**
+ * Solve a small dense linear system by Gaussian elimination with partial
+ * pivoting.
+ *
+ * \param a the k x k matrix, row major; destroyed
+ * \param b the right-hand side; destroyed
+ * \param x set to the solution
+ * \param k the order of the system
+ *
+ * \return false if the matrix is singular
+ */
+static bool
+Solve (double *a, double *b, double *x, uint32_t k)
+{
+  for (uint32_t col = 0; col < k; col++)
+    {
+      uint32_t pivot = col;
+      for (uint32_t i = col + 1; i < k; i++)
+        {
+          if (std::fabs (a[i * k + col]) > std::fabs (a[pivot * k + col]))
+            {
+              pivot = i;
+            }
+        }
+      if (!(std::fabs (a[pivot * k + col]) > 0))
+        {
+          return false;
+        }
+      if (pivot != col)
+        {
+          for (uint32_t j = 0; j < k; j++)
+            {
+              std::swap (a[col * k + j], a[pivot * k + j]);
+            }
+          std::swap (b[col], b[pivot]);
+        }
+      for (uint32_t i = col + 1; i < k; i++)
+        {
+          double f = a[i * k + col] / a[col * k + col];
+          for (uint32_t j = col; j < k; j++)
+            {
+              a[i * k + j] -= f * a[col * k + j];
+            }
+          b[i] -= f * b[col];
+        }
+    }
+  for (uint32_t i = k; i-- > 0; )
+    {
+      double sum = b[i];
+      for (uint32_t j = i + 1; j < k; j++)
+        {
+          sum -= a[i * k + j] * x[j];
+        }
+      x[i] = sum / a[i * k + i];
+    }
+  return true;
+}
+
+/**
+ * Minimise a cost by Levenberg-Marquardt.  The cost provides
+ * double Evaluate (const double *theta, double *gradient, double *hessian) const,
+ * which returns the cost at theta and, unless they are 0, fills in its
+ * gradient and its Gauss-Newton Hessian (k x k, row major).
+ *
+ * \param cost the cost
+ * \param theta the starting point, set to the minimum found
+ * \param fixed which parameters are held at their starting value
+ * \param k the number of parameters (at most 8)
+ * \param iterations set to the number of iterations run
+ *
+ * \return the cost at theta
+ */
+template <typename Cost>
+static double
+Minimise (const Cost &cost, double *theta, const bool *fixed, uint32_t k, uint32_t &iterations)
+{
+  double gradient[8];
+  double hessian[64];
+  double a[64];
+  double b[8];
+  double step[8];
+  double trial[8];
+  double f = cost.Evaluate (theta, gradient, hessian);
+  double lambda = 1e-3;
+  for (iterations = 0; iterations < MAX_ITERATIONS && std::isfinite (f); iterations++)
+    {
+      for (uint32_t i = 0; i < k; i++)
+        {
+          for (uint32_t j = 0; j < k; j++)
+            {
+              a[i * k + j] = (fixed[i] || fixed[j]) ? 0 : hessian[i * k + j];
+            }
+          // Marquardt's scaling, kept positive where the parameter has no
+          // effect at theta (e.g. an exponent whose amplitude is 0)
+          a[i * k + i] = fixed[i] ? 1
+            : hessian[i * k + i] * (1 + lambda) + lambda * 1e-12 * (1 + f);
+          b[i] = fixed[i] ? 0 : -gradient[i];
+        }
+      if (!Solve (a, b, step, k))
+        {
+          lambda *= 10;
+          continue;
+        }
+      for (uint32_t i = 0; i < k; i++)
+        {
+          trial[i] = theta[i] + step[i];
+        }
+      double fTrial = cost.Evaluate (trial, 0, 0);
+      if (std::isfinite (fTrial) && fTrial < f)
+        {
+          bool converged = f - fTrial <= 1e-15 * f;
+          std::copy (trial, trial + k, theta);
+          f = cost.Evaluate (theta, gradient, hessian);
+          lambda = std::max (lambda / 10, 1e-15);
+          if (converged)
+            {
+              break;
+            }
+        }
+      else
+        {
+          lambda *= 10;
+          if (lambda > 1e15)
+            {
+              break;
+            }
+        }
+    }
+  return f;
+}
+
+/**
+ * Least squares of c1 e^(d1 x) + c2 e^(d2 x) to points (x, v), with
+ * parameters (c1, c2, d1, d2).
+ */
+class Exp2Cost
+{
+public:
+  /**
+   * \param x the abscissae
+   * \param v the values
+   */
+  Exp2Cost (const std::vector<double> &x, const std::vector<double> &v)
+    : m_x (x),
+      m_v (v)
+  {
+  }
+  /**
+   * \param theta (c1, c2, d1, d2)
+   * \param gradient set to the gradient unless 0
+   * \param hessian set to the Gauss-Newton Hessian unless 0
+   *
+   * \return the sum of squared residuals
+   */
+  double Evaluate (const double *theta, double *gradient, double *hessian) const
+  {
+    double f = 0;
+    if (gradient != 0)
+      {
+        std::fill (gradient, gradient + 4, 0.0);
+        std::fill (hessian, hessian + 16, 0.0);
+      }
+    for (uint32_t i = 0; i < m_x.size (); i++)
+      {
+        double e1 = std::exp (theta[2] * m_x[i]);
+        double e2 = std::exp (theta[3] * m_x[i]);
+        double r = theta[0] * e1 + theta[1] * e2 - m_v[i];
+        f += r * r;
+        if (gradient != 0)
+          {
+            double j[4] = { e1, e2, theta[0] * m_x[i] * e1, theta[1] * m_x[i] * e2 };
+            for (uint32_t p = 0; p < 4; p++)
+              {
+                gradient[p] += 2 * j[p] * r;
+                for (uint32_t q = 0; q < 4; q++)
+                  {
+                    hessian[p * 4 + q] += 2 * j[p] * j[q];
+                  }
+              }
+          }
+      }
+    return f;
+  }
+
+private:
+  const std::vector<double> &m_x; //!< the abscissae
+  const std::vector<double> &m_v; //!< the values
+};
+
+/**
+ * Weighted least squares of atanh (1 - 2 PER) = a (x) - b (x) * snr_db to the
+ * samples of a regime, where a (x) = c1 e^(d1 x) + c2 e^(d2 x) and
+ * b (x) = c3 e^(d3 x) + c4 e^(d4 x), with parameters
+ * (c1, c2, d1, d2, c3, c4, d3, d4).  The cost of a chunk size is a
+ * quadratic in (a, b) given by its moments.
+ */
+class SampleCost
+{
+public:
+  /**
+   * \param groups the chunk sizes of the problem
+   */
+  SampleCost (const std::vector<FitGroup> &groups)
+    : m_groups (groups)
+  {
+  }
+  /**
+   * \param theta (c1, c2, d1, d2, c3, c4, d3, d4)
+   * \param gradient set to the gradient unless 0
+   * \param hessian set to the Gauss-Newton Hessian unless 0
+   *
+   * \return the weighted sum of squared residuals of y over the samples
+   */
+  double Evaluate (const double *theta, double *gradient, double *hessian) const
+  {
+    double f = 0;
+    if (gradient != 0)
+      {
+        std::fill (gradient, gradient + 8, 0.0);
+        std::fill (hessian, hessian + 64, 0.0);
+      }
+    for (std::vector<FitGroup>::const_iterator g = m_groups.begin (); g != m_groups.end (); g++)
+      {
+        const FitMoments &m = g->m;
+        double e[4];
+        for (uint32_t i = 0; i < 4; i++)
+          {
+            e[i] = std::exp (theta[(i / 2) * 4 + 2 + i % 2] * g->x);
+          }
+        double a = theta[0] * e[0] + theta[1] * e[1];
+        double b = theta[4] * e[2] + theta[5] * e[3];
+        f += m.yy - 2 * a * m.y + 2 * b * m.ys + a * a * m.n - 2 * a * b * m.s + b * b * m.ss;
+        if (gradient != 0)
+          {
+            // derivatives of a (first four parameters) and b (last four)
+            double ja[4] = { e[0], e[1], theta[0] * g->x * e[0], theta[1] * g->x * e[1] };
+            double jb[4] = { e[2], e[3], theta[4] * g->x * e[2], theta[5] * g->x * e[3] };
+            double ga = 2 * (a * m.n - b * m.s - m.y);
+            double gb = 2 * (b * m.ss - a * m.s + m.ys);
+            for (uint32_t p = 0; p < 4; p++)
+              {
+                gradient[p] += ga * ja[p];
+                gradient[4 + p] += gb * jb[p];
+                for (uint32_t q = 0; q < 4; q++)
+                  {
+                    hessian[p * 8 + q] += 2 * m.n * ja[p] * ja[q];
+                    hessian[(4 + p) * 8 + 4 + q] += 2 * m.ss * jb[p] * jb[q];
+                    hessian[p * 8 + 4 + q] -= 2 * m.s * ja[p] * jb[q];
+                    hessian[(4 + p) * 8 + q] -= 2 * m.s * jb[p] * ja[q];
+                  }
+              }
+          }
+      }
+    return std::max (f, 0.0);
+  }
+
+private:
+  const std::vector<FitGroup> &m_groups; //!< the chunk sizes
+};
+
+/**
+ * Fit c1 e^(d1 x) + c2 e^(d2 x) to points.  Four or more points get both
+ * exponentials, two or three a single one (c2 = d2 = 0) and one point a
+ * constant (c1 only).  The fit is started from the exponent pairs of a
+ * grid whose amplitudes, found by linear least squares, fit best.
+ *
+ * \param x the abscissae, in [0, 1]
+ * \param v the values
+ * \param theta set to (c1, c2, d1, d2)
+ * \param fixed set to which of them were held at 0
+ */
+static void
+FitExp2 (const std::vector<double> &x, const std::vector<double> &v, double *theta, bool *fixed)
+{
+  static const double grid[] = { -256, -128, -64, -32, -16, -8, -4, -2, -1, -0.5, -0.25,
+                                 0, 0.25, 0.5, 1, 2, 4 };
+  static const uint32_t gridSize = sizeof (grid) / sizeof (grid[0]);
+  uint32_t k = x.size ();
+  std::fill (theta, theta + 4, 0.0);
+  std::fill (fixed, fixed + 4, false);
+  if (k == 1)
+    {
+      theta[0] = v[0];
+      fixed[1] = fixed[2] = fixed[3] = true;
+      return;
+    }
+  bool single = k < 4;
+  fixed[1] = fixed[3] = single;
+
+  // rank the exponent pairs by the cost of their best amplitudes
+  std::vector<std::pair<double, std::pair<double, double> > > starts;
+  for (uint32_t i = 0; i < gridSize; i++)
+    {
+      for (uint32_t j = single ? 0 : i + 1; j < (single ? 1 : gridSize); j++)
+        {
+          double d1 = grid[i];
+          double d2 = single ? 0 : grid[j];
+          double m11 = 0, m12 = 0, m22 = 0, r1 = 0, r2 = 0;
+          for (uint32_t p = 0; p < k; p++)
+            {
+              double e1 = std::exp (d1 * x[p]);
+              double e2 = single ? 0 : std::exp (d2 * x[p]);
+              m11 += e1 * e1;
+              m12 += e1 * e2;
+              m22 += e2 * e2;
+              r1 += e1 * v[p];
+              r2 += e2 * v[p];
+            }
+          double c[2] = { r1 / m11, 0 };
+          if (!single)
+            {
+              double a[4] = { m11, m12, m12, m22 };
+              double b[2] = { r1, r2 };
+              if (!Solve (a, b, c, 2))
+                {
+                  continue;
+                }
+            }
+          double candidate[4] = { c[0], c[1], d1, d2 };
+          double f = Exp2Cost (x, v).Evaluate (candidate, 0, 0);
+          if (std::isfinite (f))
+            {
+              starts.push_back (std::make_pair (f, std::make_pair (d1, d2)));
+            }
+        }
+    }
+  std::sort (starts.begin (), starts.end ());
+
+  Exp2Cost cost (x, v);
+  double best = std::numeric_limits<double>::infinity ();
+  for (uint32_t s = 0; s < std::min<uint32_t> (STARTS, starts.size ()); s++)
+    {
+      double d1 = starts[s].second.first;
+      double d2 = starts[s].second.second;
+      double m11 = 0, m12 = 0, m22 = 0, r1 = 0, r2 = 0;
+      for (uint32_t p = 0; p < k; p++)
+        {
+          double e1 = std::exp (d1 * x[p]);
+          double e2 = single ? 0 : std::exp (d2 * x[p]);
+          m11 += e1 * e1;
+          m12 += e1 * e2;
+          m22 += e2 * e2;
+          r1 += e1 * v[p];
+          r2 += e2 * v[p];
+        }
+      double candidate[4] = { r1 / m11, 0, d1, d2 };
+      if (!single)
+        {
+          double a[4] = { m11, m12, m12, m22 };
+          double b[2] = { r1, r2 };
+          Solve (a, b, candidate, 2);
+        }
+      uint32_t iterations;
+      double f = Minimise (cost, candidate, fixed, 4, iterations);
+      if (f < best)
+        {
+          best = f;
+          std::copy (candidate, candidate + 4, theta);
+        }
+    }
+}
+
+/**
+ * Fit one regime of a coefficient row: steps 1 to 3 of the file comment.
+ *
+ * \param regime the regime, whose result, rms, iterations or error are set
+ * \param scale the largest chunk size of the row, by which the exponents
+ *        are scaled during the fit
+ */
+static void
+FitCurve (FitRegime &regime, double scale)
+{
+  // 1. a and b of every chunk size with samples at two SNRs or more
+  std::vector<double> x, a, b;
+  for (std::vector<FitGroup>::iterator g = regime.groups.begin (); g != regime.groups.end (); g++)
+    {
+      const FitMoments &m = g->m;
+      double det = m.n * m.ss - m.s * m.s;
+      g->solved = det > 1e-9 * m.n * m.ss;
+      if (g->solved)
+        {
+          g->a = (m.y * m.ss - m.s * m.ys) / det;
+          g->b = (m.s * m.y - m.n * m.ys) / det;
+          x.push_back (g->x);
+          a.push_back (g->a);
+          b.push_back (g->b);
+        }
+    }
+  if (x.empty ())
+    {
+      regime.error = "no chunk size has samples at two SNRs or more";
+      return;
+    }
+  regime.error = "";
+
+  // 2. a (x) and b (x) separately
+  double theta[8];
+  bool fixed[8];
+  FitExp2 (x, a, theta, fixed);
+  FitExp2 (x, b, theta + 4, fixed + 4);
+
+  // 3. everything jointly, on the samples
+  SampleCost cost (regime.groups);
+  double f = Minimise (cost, theta, fixed, 8, regime.iterations);
+  regime.rms = std::sqrt (f / regime.weight);
+
+  TanhPerCoefficients &c = regime.result;
+  c.c1 = theta[0];
+  c.c2 = theta[1];
+  c.d1 = theta[2] / scale;
+  c.d2 = theta[3] / scale;
+  c.c3 = theta[4];
+  c.c4 = theta[5];
+  c.d3 = theta[6] / scale;
+  c.d4 = theta[7] / scale;
+}
+
+/**
+ * Add a sample to moments.
+ *
+ * \param m the moments
+ * \param sample the sample
+ */
+static void
+AddSample (FitMoments &m, const FitSample &sample)
+{
+  m.count++;
+  m.n += sample.w;
+  m.s += sample.w * sample.snr;
+  m.ss += sample.w * sample.snr * sample.snr;
+  m.y += sample.w * sample.y;
+  m.ys += sample.w * sample.y * sample.snr;
+  m.yy += sample.w * sample.y * sample.y;
+}
+
+/**
+ * \param m the moments of some samples
+ *
+ * \return the sum of squared residuals of the least squares line
+ *         y = a - b * snr through them
+ */
+static double
+GetLineResidual (const FitMoments &m)
+{
+  if (m.count == 0)
+    {
+      return 0;
+    }
+  double det = m.n * m.ss - m.s * m.s;
+  if (!(det > 1e-9 * m.n * m.ss))
+    {
+      return std::max (m.yy - m.y * m.y / m.n, 0.0);
+    }
+  double a = (m.y * m.ss - m.s * m.ys) / det;
+  double b = (m.s * m.y - m.n * m.ys) / det;
+  return std::max (m.yy - a * m.y + b * m.ys, 0.0);
+}
+
+/**
+ * Split the samples of one chunk size between the regimes.  The
+ * arreglo_modelo samples are those on the high-PER side of an SNR
+ * threshold, and y is linear in the SNR on each side, so the threshold is
+ * the one that leaves the least squares lines of both sides with the
+ * smallest residual (a change point regression); ties go to the
+ * threshold closest to PER = 0.1.  The split is exact for samples of a
+ * bank, even where the arreglo_modelo1 curve starts above PER = 0.1.
+ *
+ * \param samples the samples of the chunk size
+ * \param low set to the moments of the arreglo_modelo samples
+ * \param high set to the moments of the arreglo_modelo1 samples
+ * \param split set to whether each sample is an arreglo_modelo1 one
+ */
+static void
+SplitSamples (const std::vector<FitSample> &samples, FitMoments &low, FitMoments &high,
+              std::vector<uint8_t> &split)
+{
+  // PER < 0.1 <=> y > atanh (0.8)
+  double ySwitch = std::atanh (0.8);
+  FitMoments all;
+  memset (&all, 0, sizeof (all));
+  for (uint32_t i = 0; i < samples.size (); i++)
+    {
+      AddSample (all, samples[i]);
+    }
+  // order the samples from the high-PER end, where y is smallest
+  bool increasing = all.n * all.ys - all.s * all.y >= 0;
+  uint32_t n = samples.size ();
+  std::vector<uint32_t> order (n);
+  for (uint32_t i = 0; i < n; i++)
+    {
+      order[i] = i;
+    }
+  std::sort (order.begin (), order.end (),
+             [&samples, increasing] (uint32_t x, uint32_t y)
+    {
+      return increasing ? samples[x].snr < samples[y].snr : samples[x].snr > samples[y].snr;
+    });
+
+  // prefix[k]: moments of the first k samples, the arreglo_modelo candidates
+  std::vector<FitMoments> prefix (n + 1);
+  memset (&prefix[0], 0, sizeof (FitMoments));
+  uint32_t byPer = n;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      prefix[i + 1] = prefix[i];
+      AddSample (prefix[i + 1], samples[order[i]]);
+      if (byPer == n && samples[order[i]].y > ySwitch)
+        {
+          byPer = i;
+        }
+    }
+
+  // lines need three samples to leave a residual, so smaller sides are
+  // not considered; candidates are scanned outwards from the PER split
+  uint32_t best = byPer;
+  double bestResidual = std::numeric_limits<double>::infinity ();
+  double tolerance = 1e-9 * (1 + all.yy);
+  for (uint32_t d = 0; d <= n; d++)
+    {
+      for (int side = -1; side <= 1; side += 2)
+        {
+          int64_t k = int64_t (byPer) + side * int64_t (d);
+          if ((d == 0 && side == 1) || k < 0 || k > n
+              || (k > 0 && k < 3) || (n - k > 0 && n - k < 3))
+            {
+              continue;
+            }
+          FitMoments rest = all;
+          rest.count -= prefix[k].count;
+          rest.n -= prefix[k].n;
+          rest.s -= prefix[k].s;
+          rest.ss -= prefix[k].ss;
+          rest.y -= prefix[k].y;
+          rest.ys -= prefix[k].ys;
+          rest.yy -= prefix[k].yy;
+          double residual = GetLineResidual (prefix[k]) + GetLineResidual (rest);
+          if (residual < bestResidual - tolerance)
+            {
+              best = k;
+              bestResidual = residual;
+            }
+        }
+    }
+  memset (&low, 0, sizeof (low));
+  memset (&high, 0, sizeof (high));
+  split.resize (n);
+  for (uint32_t i = 0; i < n; i++)
+    {
+      split[order[i]] = i >= best;
+      AddSample (i < best ? low : high, samples[order[i]]);
+    }
+}
+
+/**
+ * Fit one coefficient row in both regimes.
+ *
+ * \param problem the row, whose regimes and crossed are set
+ */
+static void
+FitRow (FitRowProblem &problem)
+{
+  const FitSizes &sizes = *problem.sizes;
+  double scale = sizes.empty () ? 1 : sizes.rbegin ()->first;
+  std::vector<std::vector<uint8_t> > splits (sizes.size ());
+  uint32_t i = 0;
+  for (FitSizes::const_iterator it = sizes.begin (); it != sizes.end (); it++, i++)
+    {
+      FitGroup group[2];
+      memset (group, 0, sizeof (group));
+      SplitSamples (it->second, group[0].m, group[1].m, splits[i]);
+      for (uint32_t r = 0; r < 2; r++)
+        {
+          if (group[r].m.count > 0)
+            {
+              group[r].x = it->first / scale;
+              problem.regimes[r].groups.push_back (group[r]);
+              problem.regimes[r].samples += group[r].m.count;
+              problem.regimes[r].weight += group[r].m.n;
+            }
+        }
+    }
+  for (uint32_t r = 0; r < 2; r++)
+    {
+      FitRegime &regime = problem.regimes[r];
+      if (regime.groups.empty ())
+        {
+          regime.error = "no samples";
+          continue;
+        }
+      FitCurve (regime, scale);
+    }
+
+  // samples the models will evaluate with the other regime than they
+  // were fitted to, as the fitted switch does not fall between them
+  problem.crossed = 0;
+  if (problem.regimes[0].error != "")
+    {
+      return;
+    }
+  i = 0;
+  for (FitSizes::const_iterator it = sizes.begin (); it != sizes.end (); it++, i++)
+    {
+      TanhPerCurve curve;
+      TanhPerCurveCache::ComputeParameters (problem.regimes[0].result, it->first,
+                                            curve.aLow, curve.bLow);
+      TanhPerCurveCache::SetRegimeSwitch (curve);
+      for (uint32_t j = 0; j < it->second.size (); j++)
+        {
+          problem.crossed += curve.IsHighRegime (it->second[j].snr) != splits[i][j];
+        }
+    }
+}
+
+/**
+ * Fit the rows on the given number of threads, each taking the next
+ * unfitted row until there are none.
+ *
+ * \param problems the rows
+ * \param threads the number of threads
+ */
+static void
+FitRows (std::vector<FitRowProblem> &problems, uint32_t threads)
+{
+  std::atomic<uint32_t> next (0);
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers.push_back (std::thread ([&problems, &next] ()
+        {
+          for (uint32_t i = next++; i < problems.size (); i = next++)
+            {
+              FitRow (problems[i]);
+            }
+        }));
+    }
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join ();
+    }
+}
+
+/**
+ * \return the coefficient rows of the OFDM, ERP-OFDM and HT modes, by
+ *         unique name
+ */
+static std::map<std::string, uint8_t>
+GetModeRows (void)
+{
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (), WifiPhy::GetOfdmRate12Mbps (),
+    WifiPhy::GetOfdmRate18Mbps (), WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate3MbpsBW10MHz (), WifiPhy::GetOfdmRate4_5MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW10MHz (), WifiPhy::GetOfdmRate9MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW10MHz (), WifiPhy::GetOfdmRate18MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate24MbpsBW10MHz (), WifiPhy::GetOfdmRate27MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate1_5MbpsBW5MHz (), WifiPhy::GetOfdmRate2_25MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate3MbpsBW5MHz (), WifiPhy::GetOfdmRate4_5MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW5MHz (), WifiPhy::GetOfdmRate9MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW5MHz (), WifiPhy::GetOfdmRate13_5MbpsBW5MHz (),
+    WifiPhy::GetErpOfdmRate6Mbps (), WifiPhy::GetErpOfdmRate9Mbps (),
+    WifiPhy::GetErpOfdmRate12Mbps (), WifiPhy::GetErpOfdmRate18Mbps (),
+    WifiPhy::GetErpOfdmRate24Mbps (), WifiPhy::GetErpOfdmRate36Mbps (),
+    WifiPhy::GetErpOfdmRate48Mbps (), WifiPhy::GetErpOfdmRate54Mbps (),
+    WifiPhy::GetHtMcs0 (), WifiPhy::GetHtMcs1 (), WifiPhy::GetHtMcs2 (), WifiPhy::GetHtMcs3 (),
+    WifiPhy::GetHtMcs4 (), WifiPhy::GetHtMcs5 (), WifiPhy::GetHtMcs6 (), WifiPhy::GetHtMcs7 ()
+  };
+  std::map<std::string, uint8_t> rows;
+  for (uint32_t i = 0; i < sizeof (modes) / sizeof (modes[0]); i++)
+    {
+      uint8_t row = TanhPerModeTable::Classify (modes[i]);
+      if (row < 8)
+        {
+          rows[modes[i].GetUniqueName ()] = row;
+        }
+    }
+  return rows;
+}
+
+/**
+ * Parse one share of the sample file.
+ *
+ * \param begin the first character of the share, at the start of a line
+ * \param end one past its last character, at the end of a line
+ * \param modeRows the coefficient rows by mode name
+ * \param result the samples and counts of the share
+ */
+static void
+ParseSamples (const char *begin, const char *end, const std::map<std::string, uint8_t> *modeRows,
+              ParseResult *result)
+{
+  std::string lastName;
+  uint8_t lastRow = 0;
+  FitSizes *lastSizes = 0;
+  uint32_t lastNbits = 0;
+  std::vector<FitSample> *lastSamples = 0;
+  for (const char *line = begin; line < end; )
+    {
+      const char *eol = static_cast<const char *> (memchr (line, '\n', end - line));
+      if (eol == 0)
+        {
+          eol = end;
+        }
+      const char *p = line;
+      line = eol + 1;
+      while (p < eol && (*p == ' ' || *p == '\t'))
+        {
+          p++;
+        }
+      if (p == eol || *p == '#' || *p == '\r' || (eol - p >= 5 && memcmp (p, "mode,", 5) == 0))
+        {
+          continue;
+        }
+      const char *comma = static_cast<const char *> (memchr (p, ',', eol - p));
+      if (comma == 0)
+        {
+          comma = eol;
+        }
+      const char *nameEnd = comma;
+      while (nameEnd > p && (nameEnd[-1] == ' ' || nameEnd[-1] == '\t'))
+        {
+          nameEnd--;
+        }
+      bool valid = comma < eol;
+      uint8_t row = 0;
+      if (valid && nameEnd - p == 1 && *p >= '0' && *p <= '7')
+        {
+          row = *p - '0';
+        }
+      else if (valid && nameEnd - p == static_cast<long> (lastName.size ())
+               && memcmp (p, lastName.data (), lastName.size ()) == 0)
+        {
+          row = lastRow;
+        }
+      else if (valid)
+        {
+          std::map<std::string, uint8_t>::const_iterator it = modeRows->find (std::string (p, nameEnd));
+          valid = it != modeRows->end ();
+          if (valid)
+            {
+              lastName = it->first;
+              lastRow = row = it->second;
+            }
+        }
+      char *next;
+      unsigned long nbits = 0;
+      double snr = 0, per = 0, packets = 1;
+      if (valid)
+        {
+          nbits = strtoul (comma + 1, &next, 10);
+          valid = next > comma + 1 && *next == ',' && nbits > 0 && nbits <= 0xffffffffUL;
+        }
+      if (valid)
+        {
+          snr = strtod (next + 1, &next);
+          valid = *next == ',' && std::isfinite (snr);
+        }
+      if (valid)
+        {
+          per = strtod (next + 1, &next);
+          valid = per >= 0 && per <= 1;
+        }
+      if (valid && *next == ',')
+        {
+          packets = strtod (next + 1, &next);
+          valid = packets > 0 && std::isfinite (packets);
+        }
+      if (valid)
+        {
+          while (next < eol && (*next == ' ' || *next == '\t' || *next == '\r'))
+            {
+              next++;
+            }
+          valid = next == eol;
+        }
+      if (!valid)
+        {
+          if (result->malformed++ == 0)
+            {
+              result->firstBad = std::string (p, eol);
+            }
+          continue;
+        }
+      if (per <= 0 || per >= 1)
+        {
+          result->skipped++;
+          continue;
+        }
+      FitSizes *sizes = &result->sizes[row];
+      if (sizes != lastSizes || nbits != lastNbits)
+        {
+          lastSamples = &(*sizes)[nbits];
+          lastSizes = sizes;
+          lastNbits = nbits;
+        }
+      // atanh (1 - 2 PER), without losing the precision of a small PER;
+      // the PER of K packets has variance PER (1 - PER) / K, so y has
+      // 1 / (4 K PER (1 - PER))
+      FitSample sample = { snr, 0.5 * std::log ((1 - per) / per), packets * per * (1 - per) };
+      lastSamples->push_back (sample);
+      result->samples++;
+    }
+}
+
+/**
+ * \param c the coefficient bank
+ * \param row the coefficient row
+ * \param nbits the chunk size
+ *
+ * \return the curve of the row for nbits bits
+ */
+static TanhPerCurve
+GetCurve (const TanhPerCoefficientSet &c, uint32_t row, uint32_t nbits)
+{
+  TanhPerCurve curve;
+  TanhPerCurveCache::ComputeParameters (c.low[row], nbits, curve.aLow, curve.bLow);
+  TanhPerCurveCache::ComputeParameters (c.high[row], nbits, curve.aHigh, curve.bHigh);
+  TanhPerCurveCache::SetRegimeSwitch (curve);
+  return curve;
+}
+
+/**
+ * \param curve the curve
+ * \param snrDb the SNR in dB
+ *
+ * \return the PER of the curve, selecting the regime as the models do
+ */
+static double
+GetPer (const TanhPerCurve &curve, double snrDb)
+{
+  double x = curve.IsHighRegime (snrDb) ? curve.aHigh - curve.bHigh * snrDb
+    : curve.aLow - curve.bLow * snrDb;
+  // (1 - tanh (x)) / 2, without losing the precision of a small PER
+  return 1 / (1 + std::exp (2 * x));
+}
+
+/**
+ * Write the PER of a built-in bank at every 20 MHz OFDM rate, several
+ * chunk sizes and an SNR grid.
+ *
+ * \param fileName the sample file to write
+ * \param model N of ErrorRateModelN
+ * \param snrStep the SNR grid spacing (dB)
+ * \param packets if not 0, draw each PER as the error rate of this many packets
+ *
+ * \return the number of samples written, or 0 on error
+ */
+static uint64_t
+Synthesize (const std::string &fileName, uint32_t model, double snrStep, uint32_t packets)
+{
+  static const uint32_t bytes[] = { 50, 100, 200, 300, 500, 750, 1000, 1250, 1500, 2000, 3000 };
+  const TanhPerCoefficientSet *set = GetTanhPerCoefficientSet (model);
+  std::ofstream os (fileName.c_str ());
+  if (set == 0 || !os)
+    {
+      return 0;
+    }
+  WifiMode modes[] = {
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (), WifiPhy::GetOfdmRate12Mbps (),
+    WifiPhy::GetOfdmRate18Mbps (), WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps ()
+  };
+  std::mt19937_64 rng (model);
+  uint64_t samples = 0;
+  os << "mode,nbits,snr_db,per" << (packets != 0 ? ",packets\n" : "\n") << std::setprecision (17);
+  for (uint32_t i = 0; i < sizeof (modes) / sizeof (modes[0]); i++)
+    {
+      uint8_t row = TanhPerModeTable::Classify (modes[i]);
+      for (uint32_t j = 0; j < sizeof (bytes) / sizeof (bytes[0]); j++)
+        {
+          TanhPerCurve curve = GetCurve (*set, row, 8 * bytes[j]);
+          uint32_t steps = static_cast<uint32_t> (std::floor (45 / snrStep + 0.5));
+          for (uint32_t k = 0; k <= steps; k++)
+            {
+              double snrDb = -10 + k * snrStep;
+              double per = GetPer (curve, snrDb);
+              if (packets != 0)
+                {
+                  per = std::binomial_distribution<uint32_t> (packets, per) (rng) / double (packets);
+                }
+              // what a campaign of a few million packets could tell from 0 and 1
+              if (per < 1e-7 || per > 1 - 1e-7)
+                {
+                  continue;
+                }
+              os << modes[i].GetUniqueName () << "," << 8 * bytes[j] << "," << snrDb << "," << per;
+              if (packets != 0)
+                {
+                  os << "," << packets;
+                }
+              os << "\n";
+              samples++;
+            }
+        }
+    }
+  os.close ();
+  return os ? samples : 0;
+}
+
+/**
+ * Print a bank as a TanhPerBank specialisation for tanh-per-banks.h.
+ *
+ * \param os the stream
+ * \param c the bank
+ */
+static void
+PrintBank (std::ostream &os, const TanhPerCoefficientSet &c)
+{
+  os << "template <>\nstruct TanhPerBank<N>\n{\n"
+     << "  static constexpr TanhPerCoefficientSet coefficients = {\n"
+     << std::setprecision (15);
+  for (uint32_t regime = 0; regime < 2; regime++)
+    {
+      os << (regime == 0 ? "    { // arreglo_modelo, PER >= 0.1\n"
+             : "    { // arreglo_modelo1, PER < 0.1\n");
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          const TanhPerCoefficients &r = regime == 0 ? c.low[row] : c.high[row];
+          os << "      { " << r.c1 << ", " << r.c2 << ", " << r.c3 << ", " << r.c4 << ",\n"
+             << "        " << r.d1 << ", " << r.d2 << ", " << r.d3 << ", " << r.d4 << " }"
+             << (row < 7 ? ",\n" : "\n");
+        }
+      os << (regime == 0 ? "    },\n" : "    }\n");
+    }
+  os << "  };\n};\n";
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string samples;
+  std::string output;
+  std::string format = "csv";
+  uint32_t threads = std::max<uint32_t> (std::thread::hardware_concurrency (), 1);
+  std::string synthesize;
+  uint32_t model = 2;
+  double snrStep = 0.01;
+  uint32_t packets = 0;
+  uint32_t reference = 0;
+  double maxDeviation = -1;
+
+  CommandLine cmd;
+  cmd.AddValue ("samples", "CSV file of mode,nbits,snr_db,per samples to fit", samples);
+  cmd.AddValue ("output", "Write the fitted bank to this CSV coefficient file", output);
+  cmd.AddValue ("format", "csv, or cxx to also print the fit as a TanhPerBank", format);
+  cmd.AddValue ("threads", "Number of threads parsing and fitting", threads);
+  cmd.AddValue ("synthesize", "Write samples of ErrorRateModel<model> to this file and exit", synthesize);
+  cmd.AddValue ("model", "N of the ErrorRateModelN --synthesize samples", model);
+  cmd.AddValue ("snr-step", "SNR grid spacing (dB) of --synthesize", snrStep);
+  cmd.AddValue ("packets", "Draw each --synthesize PER from this many packets (0: exact)", packets);
+  cmd.AddValue ("reference", "Report the deviation of the fit from ErrorRateModelN", reference);
+  cmd.AddValue ("max-deviation", "Exit with status 2 if the PER deviation exceeds this", maxDeviation);
+  cmd.Parse (argc, argv);
+  threads = std::max<uint32_t> (threads, 1);
+
+  if (synthesize != "")
+    {
+      uint64_t written = (snrStep > 0) ? Synthesize (synthesize, model, snrStep, packets) : 0;
+      if (written == 0)
+        {
+          std::cerr << "could not write samples of ErrorRateModel" << model << " to " << synthesize << std::endl;
+          return 1;
+        }
+      std::cerr << "wrote " << written << " samples of ErrorRateModel" << model
+                << " to " << synthesize << std::endl;
+      return 0;
+    }
+  if (samples == "" || (format != "csv" && format != "cxx"))
+    {
+      std::cerr << "usage: tanh-per-fit --samples=FILE [--output=FILE] [--format=csv|cxx]" << std::endl;
+      return 1;
+    }
+
+  // parse: each thread takes a share of the file, cut at line ends
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  std::ifstream is (samples.c_str (), std::ios::binary);
+  if (!is)
+    {
+      std::cerr << "could not open " << samples << std::endl;
+      return 1;
+    }
+  is.seekg (0, std::ios::end);
+  std::string text (static_cast<size_t> (is.tellg ()), '\0');
+  is.seekg (0, std::ios::beg);
+  is.read (&text[0], text.size ());
+  std::map<std::string, uint8_t> modeRows = GetModeRows ();
+  std::vector<ParseResult> shares (threads);
+  std::vector<std::thread> workers;
+  const char *begin = text.data ();
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      const char *end = text.data () + text.size () * (t + 1) / threads;
+      while (end < text.data () + text.size () && end[-1] != '\n')
+        {
+          end++;
+        }
+      shares[t].samples = shares[t].skipped = shares[t].malformed = 0;
+      workers.push_back (std::thread (ParseSamples, begin, std::max (begin, end), &modeRows, &shares[t]));
+      begin = std::max (begin, end);
+    }
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join ();
+    }
+
+  // merge the shares
+  uint64_t total = 0, skipped = 0, malformed = 0;
+  FitSizes merged[8];
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      ParseResult &share = shares[t];
+      total += share.samples;
+      skipped += share.skipped;
+      if (malformed == 0 && share.malformed != 0)
+        {
+          std::cerr << "malformed sample line: " << share.firstBad << std::endl;
+        }
+      malformed += share.malformed;
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          for (FitSizes::iterator it = share.sizes[row].begin (); it != share.sizes[row].end (); it++)
+            {
+              std::vector<FitSample> &samples = merged[row][it->first];
+              samples.insert (samples.end (), it->second.begin (), it->second.end ());
+              std::vector<FitSample> ().swap (it->second);
+            }
+        }
+    }
+  if (malformed != 0)
+    {
+      std::cerr << malformed << " malformed sample lines in " << samples << std::endl;
+      return 1;
+    }
+  std::chrono::steady_clock::time_point parsed = std::chrono::steady_clock::now ();
+
+  // fit
+  std::vector<FitRowProblem> problems (8);
+  for (uint32_t row = 0; row < 8; row++)
+    {
+      problems[row].row = row;
+      problems[row].sizes = &merged[row];
+      for (uint32_t r = 0; r < 2; r++)
+        {
+          problems[row].regimes[r].samples = 0;
+          problems[row].regimes[r].weight = 0;
+          problems[row].regimes[r].rms = 0;
+          problems[row].regimes[r].iterations = 0;
+        }
+    }
+  FitRows (problems, std::min<uint32_t> (threads, problems.size ()));
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+
+  TanhPerCoefficientSet bank;
+  bool complete = true;
+  for (uint32_t regime = 0; regime < 2; regime++)
+    {
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          const FitRowProblem &problem = problems[row];
+          const FitRegime &fit = problem.regimes[regime];
+          std::cerr << (regime == 0 ? "low  " : "high ") << "row " << row << ": ";
+          if (fit.error != "")
+            {
+              std::cerr << "not fitted, " << fit.error << std::endl;
+              complete = false;
+              continue;
+            }
+          (regime == 0 ? bank.low : bank.high)[row] = fit.result;
+          std::cerr << fit.samples << " samples, " << fit.groups.size ()
+                    << " chunk sizes, weighted rms residual " << fit.rms << " after "
+                    << fit.iterations << " iterations";
+          if (regime == 0)
+            {
+              std::cerr << ", " << problem.crossed << " samples across the fitted regime switch";
+            }
+          std::cerr << std::endl;
+        }
+    }
+  std::cerr << total << " samples (" << skipped << " with PER 0 or 1 skipped) parsed in "
+            << std::chrono::duration<double> (parsed - start).count () << " s, fitted in "
+            << std::chrono::duration<double> (end - parsed).count () << " s on "
+            << threads << " threads" << std::endl;
+  if (!complete)
+    {
+      std::cerr << "every coefficient row needs samples in both regimes" << std::endl;
+      return 1;
+    }
+
+  if (output != "")
+    {
+      std::string error;
+      TanhPerCoefficientSet check;
+      if (!TanhPerCoefficientFile::WriteCsv (output, bank)
+          || !TanhPerCoefficientFile::Parse (output, check, error))
+        {
+          std::cerr << "could not write " << output << std::endl;
+          return 1;
+        }
+      std::cerr << "wrote the fit to " << output << std::endl;
+    }
+  if (format == "cxx")
+    {
+      PrintBank (std::cout, bank);
+    }
+
+  if (reference != 0)
+    {
+      const TanhPerCoefficientSet *set = GetTanhPerCoefficientSet (reference);
+      if (set == 0)
+        {
+          std::cerr << "no ErrorRateModel" << reference << std::endl;
+          return 1;
+        }
+      // the curves jump where they switch regimes, so samples between the
+      // switches of the fit and of the reference are only counted
+      double worst = 0;
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          double rowWorst = 0;
+          uint64_t between = 0;
+          for (FitSizes::const_iterator it = merged[row].begin (); it != merged[row].end (); it++)
+            {
+              TanhPerCurve fit = GetCurve (bank, row, it->first);
+              TanhPerCurve ref = GetCurve (*set, row, it->first);
+              for (uint32_t j = 0; j < it->second.size (); j++)
+                {
+                  double snrDb = it->second[j].snr;
+                  if (fit.IsHighRegime (snrDb) != ref.IsHighRegime (snrDb))
+                    {
+                      between++;
+                      continue;
+                    }
+                  rowWorst = std::max (rowWorst, std::fabs (GetPer (fit, snrDb) - GetPer (ref, snrDb)));
+                }
+            }
+          std::cerr << "row " << row << ": largest PER deviation from ErrorRateModel"
+                    << reference << " " << rowWorst << ", " << between
+                    << " samples between the regime switches" << std::endl;
+          worst = std::max (worst, rowWorst);
+        }
+      if (maxDeviation >= 0 && !(worst <= maxDeviation))
+        {
+          std::cerr << "PER deviation " << worst << " exceeds " << maxDeviation << std::endl;
+          return 2;
+        }
+    }
+  return 0;
+}
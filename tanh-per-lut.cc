@@ -0,0 +1,257 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include "tanh-per-lut.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+/// Most grid points in one table
+static const size_t LUT_MAX_POINTS = 1 << 22;
+
+TanhPerLutSegment::TanhPerLutSegment ()
+  : m_firstDb (0),
+    m_inverseStep (0),
+    m_storage (1, 0.0),
+    m_values (m_storage.data ()),
+    m_size (1)
+{
+}
+
+TanhPerLutSegment::TanhPerLutSegment (double a, double b, double fromDb, double toDb, double stepDb)
+  : m_firstDb (fromDb),
+    m_inverseStep (1 / stepDb)
+{
+  double points = std::ceil ((toDb - fromDb) / stepDb) + 1;
+  NS_ABORT_MSG_IF (!(points <= LUT_MAX_POINTS), "tanh PER table of " << points << " points");
+  m_storage.resize (static_cast<size_t> (points));
+  for (size_t k = 0; k < m_storage.size (); k++)
+    {
+      double per = (1 - std::tanh (a - b * (fromDb + k * stepDb))) / 2;
+      m_storage[k] = 1 - per;
+    }
+  m_values = m_storage.data ();
+  m_size = m_storage.size ();
+}
+
+TanhPerLutSegment::TanhPerLutSegment (double firstDb, double inverseStep, const double *values, size_t size)
+  : m_firstDb (firstDb),
+    m_inverseStep (inverseStep),
+    m_values (values),
+    m_size (size)
+{
+}
+
+TanhPerLutSegment::TanhPerLutSegment (const TanhPerLutSegment &o)
+  : m_firstDb (o.m_firstDb),
+    m_inverseStep (o.m_inverseStep),
+    m_storage (o.m_storage),
+    m_values (m_storage.empty () ? o.m_values : m_storage.data ()),
+    m_size (o.m_size)
+{
+}
+
+TanhPerLutSegment &
+TanhPerLutSegment::operator= (const TanhPerLutSegment &o)
+{
+  m_firstDb = o.m_firstDb;
+  m_inverseStep = o.m_inverseStep;
+  m_storage = o.m_storage;
+  m_values = m_storage.empty () ? o.m_values : m_storage.data ();
+  m_size = o.m_size;
+  return *this;
+}
+
+size_t
+TanhPerLutSegment::GetSize (void) const
+{
+  return m_size;
+}
+
+size_t
+TanhPerLutSegment::GetOwnedSize (void) const
+{
+  return m_storage.size ();
+}
+
+double
+TanhPerLut::GetErrorBound (double b, double stepDb)
+{
+  return b * b * stepDb * stepDb / (12 * std::sqrt (3.0));
+}
+
+TanhPerLutSegment
+TanhPerLut::Build (double a, double b, const TanhPerCurve &curve, bool high,
+                   double stepDb, double tolerance)
+{
+  if (b == 0)
+    {
+      return TanhPerLutSegment (a, b, 0, 0, 1);
+    }
+  // Half the tolerance goes to the interpolation, half to clamping where
+  // the curve is within tolerance / 2 of 0 or 1, i.e. |a - b snrDb| > u
+  double u = std::log (2 / tolerance) / 2;
+  double fromDb = std::min ((a - u) / b, (a + u) / b);
+  double toDb = std::max ((a - u) / b, (a + u) / b);
+  if (high == curve.highAbove)
+    {
+      fromDb = std::max (fromDb, curve.switchDb);
+    }
+  else
+    {
+      toDb = std::min (toDb, curve.switchDb);
+    }
+  if (fromDb > toDb)
+    {
+      // saturated on the whole side of switchDb this regime covers
+      fromDb = toDb = std::isfinite (curve.switchDb) ? curve.switchDb : 0;
+    }
+  double maxStepDb = std::sqrt (tolerance / 2 / GetErrorBound (b, 1));
+  return TanhPerLutSegment (a, b, fromDb, toDb, std::min (stepDb, maxStepDb));
+}
+
+TanhPerLut::TanhPerLut (const TanhPerCurve &curve, double stepDb, double tolerance)
+  : m_switchDb (curve.switchDb),
+    m_highAbove (curve.highAbove),
+    m_low (Build (curve.aLow, curve.bLow, curve, false, stepDb, tolerance)),
+    m_high (Build (curve.aHigh, curve.bHigh, curve, true, stepDb, tolerance))
+{
+}
+
+TanhPerLut::TanhPerLut (double switchDb, bool highAbove, const TanhPerLutSegment &low,
+                        const TanhPerLutSegment &high)
+  : m_switchDb (switchDb),
+    m_highAbove (highAbove),
+    m_low (low),
+    m_high (high)
+{
+}
+
+size_t
+TanhPerLut::GetMemoryBytes (void) const
+{
+  return sizeof (*this) + (m_low.GetOwnedSize () + m_high.GetOwnedSize ()) * sizeof (double);
+}
+
+TanhPerLutCache::TanhPerLutCache (double stepDb, double tolerance, uint64_t maxBytes, uint32_t minUses)
+  : m_stepDb (stepDb),
+    m_tolerance (tolerance),
+    m_maxBytes (maxBytes),
+    m_minUses (minUses),
+    m_uses (minUses > 1 ? USE_COUNTERS : 0, 0),
+    m_bytes (0),
+    m_peakBytes (0),
+    m_evictions (0)
+{
+}
+
+void
+TanhPerLutCache::Evict (void)
+{
+  while (m_maxBytes != 0 && m_bytes > m_maxBytes && m_lru.size () > 1)
+    {
+      m_bytes -= m_lru.back ().second->GetMemoryBytes ();
+      m_luts.erase (m_lru.back ().first);
+      m_lru.pop_back ();
+      m_evictions++;
+    }
+}
+
+std::shared_ptr<const TanhPerLut>
+TanhPerLutCache::Lookup (uint8_t row, uint32_t nbits, TanhPerCurveCache &curves)
+{
+  std::pair<uint8_t, uint32_t> key = std::make_pair (row, nbits);
+  std::map<std::pair<uint8_t, uint32_t>, std::list<Entry>::iterator>::iterator it = m_luts.find (key);
+  if (it != m_luts.end ())
+    {
+      m_lru.splice (m_lru.begin (), m_lru, it->second);
+      return it->second->second;
+    }
+  if (m_minUses > 1)
+    {
+      // Fibonacci hashing of (row, nbits) into the 12 bits of a counter
+      uint32_t &uses = m_uses[((nbits * 8 + row) * 2654435761U) >> 20];
+      if (++uses < m_minUses)
+        {
+          return std::shared_ptr<const TanhPerLut> ();
+        }
+      uses = 0;
+    }
+  std::shared_ptr<const TanhPerLut> lut =
+    std::make_shared<TanhPerLut> (curves.Lookup (row, nbits), m_stepDb, m_tolerance);
+  m_lru.push_front (Entry (key, lut));
+  m_luts[key] = m_lru.begin ();
+  m_bytes += lut->GetMemoryBytes ();
+  m_peakBytes = std::max (m_peakBytes, m_bytes);
+  Evict ();
+  return lut;
+}
+
+uint64_t
+TanhPerLutCache::GetBytes (void) const
+{
+  return m_bytes;
+}
+
+uint64_t
+TanhPerLutCache::GetPeakBytes (void) const
+{
+  return m_peakBytes;
+}
+
+uint32_t
+TanhPerLutCache::GetSize (void) const
+{
+  return m_lru.size ();
+}
+
+uint64_t
+TanhPerLutCache::GetEvictions (void) const
+{
+  return m_evictions;
+}
+
+double
+TanhPerLutCache::SelfTest (TanhPerCurveCache &curves) const
+{
+  const uint32_t sizes[] = { 8, 112, 160, 4608, 12000, 24000 };
+  const uint32_t points = 4096;
+  double maxError = 0;
+  for (uint8_t row = 0; row < 8; row++)
+    {
+      for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+        {
+          const TanhPerCurve &curve = curves.Lookup (row, sizes[s]);
+          TanhPerLut lut (curve, m_stepDb, m_tolerance);
+          for (uint32_t i = 0; i < points; i++)
+            {
+              double snrDb = -20 + 70 * (i + 0.5) / points;
+              bool high = curve.IsHighRegime (snrDb);
+              double a = high ? curve.aHigh : curve.aLow;
+              double b = high ? curve.bHigh : curve.bLow;
+              double expected = 1 - (1 - std::tanh (a - b * snrDb)) / 2;
+              double error = std::fabs (lut.GetSuccessRate (snrDb) - expected);
+              maxError = (error == error) ? std::max (maxError, error) : HUGE_VAL;
+            }
+        }
+    }
+  return maxError;
+}
+
+} //namespace ns3
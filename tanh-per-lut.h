@@ -0,0 +1,306 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_LUT_H
+#define TANH_PER_LUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "tanh-per-curve-cache.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The success rate (1 + tanh (a - b * snrDb)) / 2 of one PER regime
+ * sampled on a uniform dB grid and read back by linear interpolation.
+ * Outside the grid the curve is within the tolerance it was built for of
+ * 0 or 1, and the value at the nearest end of the grid is returned.
+ */
+class TanhPerLutSegment
+{
+public:
+  TanhPerLutSegment ();
+  /**
+   * Sample a curve over [fromDb, toDb].
+   *
+   * \param a a_R of the curve
+   * \param b b_R of the curve
+   * \param fromDb the lowest SNR (dB) to sample
+   * \param toDb the highest SNR (dB) to sample
+   * \param stepDb the grid spacing (dB)
+   */
+  TanhPerLutSegment (double a, double b, double fromDb, double toDb, double stepDb);
+  /**
+   * \param o the segment to copy
+   */
+  TanhPerLutSegment (const TanhPerLutSegment &o);
+  /**
+   * \param o the segment to copy
+   *
+   * \return this segment
+   */
+  TanhPerLutSegment & operator= (const TanhPerLutSegment &o);
+
+  /**
+   * \param snrDb the SNR in dB
+   *
+   * \return the interpolated success rate at snrDb
+   */
+  double Interpolate (double snrDb) const;
+  /**
+   * \return the number of grid points
+   */
+  size_t GetSize (void) const;
+  /**
+   * \return the number of grid points held by the segment itself, rather
+   *         than by a table file it refers to
+   */
+  size_t GetOwnedSize (void) const;
+
+private:
+  friend class TanhPerTableFile;
+
+  /**
+   * Refer to grid points held elsewhere, e.g. in a mapped table file.
+   *
+   * \param firstDb the SNR (dB) of the first grid point
+   * \param inverseStep 1 / grid spacing (1/dB)
+   * \param values the success rate at each grid point; they must outlive
+   *        the segment
+   * \param size the number of grid points
+   */
+  TanhPerLutSegment (double firstDb, double inverseStep, const double *values, size_t size);
+
+  double m_firstDb;              //!< SNR (dB) of the first grid point
+  double m_inverseStep;          //!< 1 / grid spacing (1/dB)
+  std::vector<double> m_storage; //!< grid points owned by the segment, if any
+  const double *m_values;        //!< success rate at each grid point
+  size_t m_size;                 //!< number of grid points
+};
+
+/**
+ * \ingroup wifi
+ *
+ * The interpolation tables of one TanhPerCurve, one per PER regime, each
+ * covering only its own side of switchDb.  The regime is still chosen with
+ * TanhPerCurve::IsHighRegime, so the tables never interpolate across the
+ * jump between the two fits.
+ *
+ * Linear interpolation of the curve over a step h is off by at most
+ * h^2 / 8 times its largest second derivative, 2 b^2 / (3 sqrt (3)).
+ * Each regime is sampled with the requested step, or with a finer one
+ * where b is so steep that the requested step could not meet the
+ * tolerance, so the tables are always within the tolerance of the curve.
+ */
+class TanhPerLut
+{
+public:
+  /**
+   * \param curve the curve to sample
+   * \param stepDb the largest grid spacing (dB)
+   * \param tolerance the largest absolute error allowed against the curve
+   */
+  TanhPerLut (const TanhPerCurve &curve, double stepDb, double tolerance);
+
+  /**
+   * \param snrDb the SNR in dB
+   *
+   * \return the interpolated success rate at snrDb
+   */
+  double GetSuccessRate (double snrDb) const;
+  /**
+   * \return the number of bytes held by the tables, not counting grid
+   *         points they refer to in a table file
+   */
+  size_t GetMemoryBytes (void) const;
+
+  /**
+   * \param b b_R of a curve
+   * \param stepDb a grid spacing (dB)
+   *
+   * \return the largest interpolation error of the curve over stepDb
+   */
+  static double GetErrorBound (double b, double stepDb);
+
+private:
+  friend class TanhPerTableFile;
+
+  /**
+   * Assemble the tables of a curve from their segments.
+   *
+   * \param switchDb TanhPerCurve::switchDb
+   * \param highAbove TanhPerCurve::highAbove
+   * \param low the table of the arreglo_modelo regime
+   * \param high the table of the arreglo_modelo1 regime
+   */
+  TanhPerLut (double switchDb, bool highAbove, const TanhPerLutSegment &low,
+              const TanhPerLutSegment &high);
+  /**
+   * Sample one regime of a curve.
+   *
+   * \param a a_R of the regime
+   * \param b b_R of the regime
+   * \param curve the curve, for the side of switchDb the regime covers
+   * \param high whether this is the arreglo_modelo1 regime
+   * \param stepDb the largest grid spacing (dB)
+   * \param tolerance the largest absolute error allowed
+   *
+   * \return the table of the regime
+   */
+  static TanhPerLutSegment Build (double a, double b, const TanhPerCurve &curve, bool high,
+                                  double stepDb, double tolerance);
+
+  double m_switchDb;         //!< TanhPerCurve::switchDb
+  bool m_highAbove;          //!< TanhPerCurve::highAbove
+  TanhPerLutSegment m_low;   //!< table of the arreglo_modelo regime
+  TanhPerLutSegment m_high;  //!< table of the arreglo_modelo1 regime
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Builds a TanhPerLut per (row, nbits) pair on first use, from the curves
+ * of a TanhPerCurveCache.  Most scenarios use a few modes and frame
+ * sizes, so only the pairs actually seen are ever built.  When the tables
+ * hold more than a given number of bytes, the least recently used ones
+ * are dropped until they fit again; the table being looked up is always
+ * kept, and a dropped table lives on as long as a caller holds it.
+ *
+ * Tables are keyed by the exact nbits: a_R and b_R depend on nbits through
+ * exp (), so a table shared by a bucket of sizes would be off by more
+ * than the tolerance for most of them.  At the default 0.01 dB and 1e-6 a
+ * table holds about 4600 grid points (37 KB), one tanh evaluation each,
+ * and costs about as much as 1500 analytic evaluations of the curve,
+ * which chunk sizes seen only a few times, such as those cut by
+ * interference, never pay back.  With a minimum number of uses a pair
+ * only gets its table on its minUses-th lookup, and the earlier lookups
+ * return none; the caller evaluates the curve instead.  The lookups are
+ * counted in a fixed array of counters indexed by a hash of the pair, so
+ * counting takes no memory per pair; pairs that share a counter merely
+ * get their tables a little earlier.
+ *
+ * The cache itself is not thread-safe; see TanhPerLutStore.
+ */
+class TanhPerLutCache
+{
+public:
+  /**
+   * \param stepDb the largest grid spacing (dB) of the tables
+   * \param tolerance the largest absolute error allowed against the curves
+   * \param maxBytes the most bytes the tables may hold, or 0 for no limit
+   * \param minUses the number of lookups of a pair that builds its table
+   */
+  TanhPerLutCache (double stepDb, double tolerance, uint64_t maxBytes, uint32_t minUses = 1);
+
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   * \param curves the curve parameters
+   *
+   * \return the tables of the given row for nbits bits, or 0 if the pair
+   *         has been looked up fewer than minUses times
+   */
+  std::shared_ptr<const TanhPerLut> Lookup (uint8_t row, uint32_t nbits, TanhPerCurveCache &curves);
+
+  /**
+   * \return the number of bytes held by the tables
+   */
+  uint64_t GetBytes (void) const;
+  /**
+   * \return the largest number of bytes the tables have held
+   */
+  uint64_t GetPeakBytes (void) const;
+  /**
+   * \return the number of tables held
+   */
+  uint32_t GetSize (void) const;
+  /**
+   * \return the number of tables dropped to stay within the memory cap
+   */
+  uint64_t GetEvictions (void) const;
+
+  /**
+   * Compare tables of every coefficient row against the curves they
+   * sample, for chunk sizes from 1 byte to 3000 bytes, at 4096 SNRs from
+   * -20 dB to 50 dB that do not fall on the grid.  The tables are built
+   * for the test only and are not kept.
+   *
+   * \param curves the curve parameters
+   *
+   * \return the largest absolute error of the tables
+   */
+  double SelfTest (TanhPerCurveCache &curves) const;
+
+private:
+  /// A table and the (row, nbits) pair it was built for
+  typedef std::pair<std::pair<uint8_t, uint32_t>, std::shared_ptr<const TanhPerLut> > Entry;
+
+  /**
+   * Drop least recently used tables until the rest fit in m_maxBytes,
+   * keeping at least the most recently used one.
+   */
+  void Evict (void);
+
+  /// Number of lookup counters used with a minimum number of uses (2^12)
+  static const uint32_t USE_COUNTERS = 4096;
+
+  double m_stepDb;        //!< largest grid spacing (dB)
+  double m_tolerance;     //!< largest absolute error allowed
+  uint64_t m_maxBytes;    //!< memory cap, or 0
+  uint32_t m_minUses;     //!< number of lookups of a pair that builds its table
+  std::vector<uint32_t> m_uses; //!< lookups of pairs without a table, by hash of (row, nbits)
+  uint64_t m_bytes;       //!< bytes held by m_lru
+  uint64_t m_peakBytes;   //!< largest value m_bytes has had
+  uint64_t m_evictions;   //!< number of tables dropped by Evict
+  std::list<Entry> m_lru; //!< tables, most recently used first
+  std::map<std::pair<uint8_t, uint32_t>, std::list<Entry>::iterator> m_luts; //!< m_lru by (row, nbits)
+};
+
+inline double
+TanhPerLutSegment::Interpolate (double snrDb) const
+{
+  double t = (snrDb - m_firstDb) * m_inverseStep;
+  if (!(t > 0))
+    {
+      return m_values[0];
+    }
+  if (t >= m_size - 1)
+    {
+      return m_values[m_size - 1];
+    }
+  size_t k = static_cast<size_t> (t);
+  double fraction = t - k;
+  return m_values[k] + fraction * (m_values[k + 1] - m_values[k]);
+}
+
+inline double
+TanhPerLut::GetSuccessRate (double snrDb) const
+{
+  bool high = m_highAbove ? snrDb > m_switchDb : snrDb < m_switchDb;
+  return high ? m_high.Interpolate (snrDb) : m_low.Interpolate (snrDb);
+}
+
+} //namespace ns3
+
+#endif /* TANH_PER_LUT_H */
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "tanh-per-mode-table.h"
+#include "wifi-phy.h"
+
+namespace ns3 {
+
+TanhPerModeTable::TanhPerModeTable ()
+{
+  for (uint32_t uid = 0; uid < MAX_UIDS; uid++)
+    {
+      m_handlers[uid].store (UNKNOWN, std::memory_order_relaxed);
+    }
+  WifiMode modes[] = {
+    WifiPhy::GetDsssRate1Mbps (), WifiPhy::GetDsssRate2Mbps (),
+    WifiPhy::GetDsssRate5_5Mbps (), WifiPhy::GetDsssRate11Mbps (),
+    WifiPhy::GetErpOfdmRate6Mbps (), WifiPhy::GetErpOfdmRate9Mbps (),
+    WifiPhy::GetErpOfdmRate12Mbps (), WifiPhy::GetErpOfdmRate18Mbps (),
+    WifiPhy::GetErpOfdmRate24Mbps (), WifiPhy::GetErpOfdmRate36Mbps (),
+    WifiPhy::GetErpOfdmRate48Mbps (), WifiPhy::GetErpOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate3MbpsBW10MHz (), WifiPhy::GetOfdmRate4_5MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW10MHz (), WifiPhy::GetOfdmRate9MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW10MHz (), WifiPhy::GetOfdmRate18MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate24MbpsBW10MHz (), WifiPhy::GetOfdmRate27MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate1_5MbpsBW5MHz (), WifiPhy::GetOfdmRate2_25MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate3MbpsBW5MHz (), WifiPhy::GetOfdmRate4_5MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW5MHz (), WifiPhy::GetOfdmRate9MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW5MHz (), WifiPhy::GetOfdmRate13_5MbpsBW5MHz (),
+    WifiPhy::GetHtMcs0 (), WifiPhy::GetHtMcs1 (), WifiPhy::GetHtMcs2 (),
+    WifiPhy::GetHtMcs3 (), WifiPhy::GetHtMcs4 (), WifiPhy::GetHtMcs5 (),
+    WifiPhy::GetHtMcs6 (), WifiPhy::GetHtMcs7 (),
+    WifiPhy::GetVhtMcs0 (), WifiPhy::GetVhtMcs1 (), WifiPhy::GetVhtMcs2 (),
+    WifiPhy::GetVhtMcs3 (), WifiPhy::GetVhtMcs4 (), WifiPhy::GetVhtMcs5 (),
+    WifiPhy::GetVhtMcs6 (), WifiPhy::GetVhtMcs7 (), WifiPhy::GetVhtMcs8 (),
+    WifiPhy::GetVhtMcs9 ()
+  };
+  for (uint32_t i = 0; i < sizeof (modes) / sizeof (modes[0]); i++)
+    {
+      Add (modes[i]);
+    }
+}
+
+uint8_t
+TanhPerModeTable::Add (WifiMode mode)
+{
+  uint32_t uid = mode.GetUid ();
+  uint8_t handler = Classify (mode);
+  if (uid < MAX_UIDS)
+    {
+      m_handlers[uid].store (handler, std::memory_order_relaxed);
+    }
+  return handler;
+}
+
+uint8_t
+TanhPerModeTable::Classify (WifiMode mode)
+{
+  if (mode.GetModulationClass () == WIFI_MOD_CLASS_ERP_OFDM
+      || mode.GetModulationClass () == WIFI_MOD_CLASS_OFDM
+      || mode.GetModulationClass () == WIFI_MOD_CLASS_HT
+      || mode.GetModulationClass () == WIFI_MOD_CLASS_VHT)
+    {
+      if (mode.GetConstellationSize () == 2)
+        {
+          //3Mbps or 4.5Mbps
+          return (mode.GetCodeRate () == WIFI_CODE_RATE_1_2) ? 0 : 1;
+        }
+      else if (mode.GetConstellationSize () == 4)
+        {
+          //6Mbps or 9Mbps
+          return (mode.GetCodeRate () == WIFI_CODE_RATE_1_2) ? 2 : 3;
+        }
+      else if (mode.GetConstellationSize () == 16)
+        {
+          //12Mbps or 18Mbps
+          return (mode.GetCodeRate () == WIFI_CODE_RATE_1_2) ? 4 : 5;
+        }
+      else if (mode.GetConstellationSize () == 64)
+        {
+          //24Mbps or 27Mbps
+          return (mode.GetCodeRate () == WIFI_CODE_RATE_2_3) ? 6 : 7;
+        }
+    }
+  else if (mode.GetModulationClass () == WIFI_MOD_CLASS_DSSS || mode.GetModulationClass () == WIFI_MOD_CLASS_HR_DSSS)
+    {
+      switch (mode.GetDataRate (20, 0, 1))
+        {
+        case 1000000:
+          return DSSS_DBPSK;
+        case 2000000:
+          return DSSS_DQPSK;
+        case 5500000:
+          return DSSS_CCK_5_5;
+        case 11000000:
+          return DSSS_CCK_11;
+        }
+    }
+  return UNSUPPORTED;
+}
+
+} //namespace ns3
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TANH_PER_MODE_TABLE_H
+#define TANH_PER_MODE_TABLE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "wifi-mode.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Maps a WifiMode, by UID, to the way the tanh error models handle it:
+ * an OFDM coefficient row (0..7) or a DSSS success-rate function.  The
+ * classification of a mode by modulation class, constellation size and
+ * code rate is done once per mode instead of once per chunk.
+ *
+ * The standard 802.11a/b/g/p, HT and VHT modes are classified when the
+ * table is built; any other mode is classified on first use.  Lookup may
+ * be called from several threads at once: a handler is a pure function
+ * of the mode, so threads racing to classify the same mode store the
+ * same value.
+ */
+class TanhPerModeTable
+{
+public:
+  /**
+   * Handlers other than the OFDM rows 0..7.
+   */
+  enum
+  {
+    DSSS_DBPSK = 8, //!< DsssErrorRateModel::GetDsssDbpskSuccessRate
+    DSSS_DQPSK,     //!< DsssErrorRateModel::GetDsssDqpskSuccessRate
+    DSSS_CCK_5_5,   //!< DsssErrorRateModel::GetDsssDqpskCck5_5SuccessRate
+    DSSS_CCK_11,    //!< DsssErrorRateModel::GetDsssDqpskCck11SuccessRate
+    UNSUPPORTED,    //!< no fit for this mode: success rate 0
+    UNKNOWN         //!< not classified yet
+  };
+
+  TanhPerModeTable ();
+
+  /**
+   * \param mode the WifiMode of the chunk
+   *
+   * \return the OFDM row (0..7) or the DSSS / UNSUPPORTED handler of mode
+   */
+  uint8_t Lookup (WifiMode mode);
+
+  /**
+   * \param mode a WifiMode
+   *
+   * \return the handler of mode, found by walking its modulation class,
+   *         constellation size and code rate
+   */
+  static uint8_t Classify (WifiMode mode);
+
+private:
+  /**
+   * Classify mode and record it in m_handlers.
+   *
+   * \param mode a WifiMode
+   *
+   * \return the handler of mode
+   */
+  uint8_t Add (WifiMode mode);
+
+  /// Number of WifiMode UIDs whose handler is recorded
+  static const uint32_t MAX_UIDS = 1024;
+
+  std::atomic<uint8_t> m_handlers[MAX_UIDS]; //!< handler by WifiMode UID
+};
+
+inline uint8_t
+TanhPerModeTable::Lookup (WifiMode mode)
+{
+  uint32_t uid = mode.GetUid ();
+  if (uid < MAX_UIDS)
+    {
+      uint8_t handler = m_handlers[uid].load (std::memory_order_relaxed);
+      if (handler != UNKNOWN)
+        {
+          return handler;
+        }
+    }
+  return Add (mode);
+}
+
+} //namespace ns3
+
+#endif /* TANH_PER_MODE_TABLE_H */
@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <map>
+#include <mutex>
+#include "tanh-per-model-store.h"
+
+namespace ns3 {
+
+/// Key of a TanhPerLutStore
+struct TanhPerLutStoreKey
+{
+  const TanhPerCoefficientSet *coefficients; //!< the bank
+  double stepDb;                             //!< largest grid spacing (dB)
+  double tolerance;                          //!< largest absolute error allowed
+  uint64_t maxBytes;                         //!< memory cap, or 0
+  uint32_t minUses;                          //!< lookups of a pair that build its table
+  const TanhPerTableFile *tables;            //!< precomputed tables, or 0
+
+  /**
+   * \param o another key
+   *
+   * \return true if this key sorts before o
+   */
+  bool operator< (const TanhPerLutStoreKey &o) const
+  {
+    if (coefficients != o.coefficients)
+      {
+        return coefficients < o.coefficients;
+      }
+    if (stepDb != o.stepDb)
+      {
+        return stepDb < o.stepDb;
+      }
+    if (tolerance != o.tolerance)
+      {
+        return tolerance < o.tolerance;
+      }
+    if (maxBytes != o.maxBytes)
+      {
+        return maxBytes < o.maxBytes;
+      }
+    if (minUses != o.minUses)
+      {
+        return minUses < o.minUses;
+      }
+    return tables < o.tables;
+  }
+};
+
+/**
+ * \return the mutex guarding the registries of live stores
+ */
+static std::mutex &
+GetRegistryMutex (void)
+{
+  static std::mutex *mutex = new std::mutex ();
+  return *mutex;
+}
+
+/**
+ * \return the live curve stores by bank; never destroyed, so that models
+ *         held by other static objects can still release their store
+ */
+static std::map<const TanhPerCoefficientSet *, TanhPerCurveStore *> &
+GetCurveStores (void)
+{
+  static std::map<const TanhPerCoefficientSet *, TanhPerCurveStore *> *stores =
+    new std::map<const TanhPerCoefficientSet *, TanhPerCurveStore *> ();
+  return *stores;
+}
+
+/**
+ * \return the live lookup table stores by configuration, never destroyed
+ */
+static std::map<TanhPerLutStoreKey, TanhPerLutStore *> &
+GetLutStores (void)
+{
+  static std::map<TanhPerLutStoreKey, TanhPerLutStore *> *stores =
+    new std::map<TanhPerLutStoreKey, TanhPerLutStore *> ();
+  return *stores;
+}
+
+Ptr<TanhPerCurveStore>
+TanhPerCurveStore::Get (const TanhPerCoefficientSet &coefficients)
+{
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  std::map<const TanhPerCoefficientSet *, TanhPerCurveStore *>::iterator it =
+    GetCurveStores ().find (&coefficients);
+  if (it != GetCurveStores ().end ())
+    {
+      return Ptr<TanhPerCurveStore> (it->second);
+    }
+  TanhPerCurveStore *store = new TanhPerCurveStore (coefficients);
+  GetCurveStores ()[&coefficients] = store;
+  return Ptr<TanhPerCurveStore> (store, false);
+}
+
+uint32_t
+TanhPerCurveStore::GetInstanceCount (void)
+{
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  return GetCurveStores ().size ();
+}
+
+TanhPerCurveStore::TanhPerCurveStore (const TanhPerCoefficientSet &coefficients)
+  : m_coefficients (coefficients),
+    m_curves (coefficients)
+{
+}
+
+TanhPerCurveStore::~TanhPerCurveStore ()
+{
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  GetCurveStores ().erase (&m_coefficients);
+}
+
+const TanhPerCoefficientSet &
+TanhPerCurveStore::GetCoefficients (void) const
+{
+  return m_coefficients;
+}
+
+uint64_t
+TanhPerCurveStore::GetHits (void) const
+{
+  return m_curves.GetHits ();
+}
+
+uint64_t
+TanhPerCurveStore::GetMisses (void) const
+{
+  return m_curves.GetMisses ();
+}
+
+bool
+TanhPerCurveStore::FindDsssThreshold (uint8_t handler, uint32_t nbits, double per, double &snrDb) const
+{
+  std::lock_guard<std::mutex> lock (m_dsssMutex);
+  DsssThresholdMap::const_iterator it =
+    m_dsssThresholds.find (std::make_pair (std::make_pair (handler, nbits), per));
+  if (it == m_dsssThresholds.end ())
+    {
+      return false;
+    }
+  snrDb = it->second;
+  return true;
+}
+
+void
+TanhPerCurveStore::AddDsssThreshold (uint8_t handler, uint32_t nbits, double per, double snrDb) const
+{
+  std::lock_guard<std::mutex> lock (m_dsssMutex);
+  if (m_dsssThresholds.size () >= DSSS_THRESHOLD_MAX_ENTRIES)
+    {
+      m_dsssThresholds.clear ();
+    }
+  m_dsssThresholds[std::make_pair (std::make_pair (handler, nbits), per)] = snrDb;
+}
+
+Ptr<TanhPerLutStore>
+TanhPerLutStore::Get (Ptr<TanhPerCurveStore> curves, double stepDb, double tolerance,
+                      uint64_t maxBytes, uint32_t minUses, const TanhPerTableFile *tables)
+{
+  TanhPerLutStoreKey key = { &curves->GetCoefficients (), stepDb, tolerance, maxBytes, minUses, tables };
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  std::map<TanhPerLutStoreKey, TanhPerLutStore *>::iterator it = GetLutStores ().find (key);
+  if (it != GetLutStores ().end ())
+    {
+      return Ptr<TanhPerLutStore> (it->second);
+    }
+  TanhPerLutStore *store = new TanhPerLutStore (curves, stepDb, tolerance, maxBytes, minUses, tables);
+  GetLutStores ()[key] = store;
+  return Ptr<TanhPerLutStore> (store, false);
+}
+
+uint32_t
+TanhPerLutStore::GetInstanceCount (void)
+{
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  return GetLutStores ().size ();
+}
+
+TanhPerLutStore::TanhPerLutStore (Ptr<TanhPerCurveStore> curves, double stepDb, double tolerance,
+                                  uint64_t maxBytes, uint32_t minUses, const TanhPerTableFile *tables)
+  : m_curves (curves),
+    m_stepDb (stepDb),
+    m_tolerance (tolerance),
+    m_maxBytes (maxBytes),
+    m_minUses (minUses),
+    m_tables (tables),
+    m_luts (stepDb, tolerance, maxBytes, minUses)
+{
+}
+
+TanhPerLutStore::~TanhPerLutStore ()
+{
+  TanhPerLutStoreKey key = { &m_curves->GetCoefficients (), m_stepDb, m_tolerance, m_maxBytes,
+                             m_minUses, m_tables };
+  std::lock_guard<std::mutex> lock (GetRegistryMutex ());
+  GetLutStores ().erase (key);
+}
+
+double
+TanhPerLutStore::SelfTest (Ptr<TanhPerCurveStore> curves, double stepDb, double tolerance)
+{
+  static std::map<TanhPerLutStoreKey, double> errors;
+  static std::mutex mutex;
+  TanhPerLutStoreKey key = { &curves->GetCoefficients (), stepDb, tolerance, 0, 1, 0 };
+  std::lock_guard<std::mutex> lock (mutex);
+  std::map<TanhPerLutStoreKey, double>::iterator it = errors.find (key);
+  if (it == errors.end ())
+    {
+      // curves of its own, so that the test does not count towards the
+      // hits and misses of the shared ones
+      TanhPerCurveCache testCurves (curves->GetCoefficients ());
+      TanhPerLutCache tables (stepDb, tolerance, 0);
+      it = errors.insert (std::make_pair (key, tables.SelfTest (testCurves))).first;
+    }
+  return it->second;
+}
+
+uint64_t
+TanhPerLutStore::GetBytes (void) const
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  return m_luts.GetBytes ();
+}
+
+uint64_t
+TanhPerLutStore::GetPeakBytes (void) const
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  return m_luts.GetPeakBytes ();
+}
+
+uint32_t
+TanhPerLutStore::GetSize (void) const
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  return m_luts.GetSize ();
+}
+
+uint64_t
+TanhPerLutStore::GetEvictions (void) const
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  return m_luts.GetEvictions ();
+}
+
+} //namespace ns3
@@ -0,0 +1,253 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_MODEL_STORE_H
+#define TANH_PER_MODEL_STORE_H
+
+#include <stdint.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "tanh-per-coefficients.h"
+#include "tanh-per-curve-cache.h"
+#include "tanh-per-lut.h"
+#include "tanh-per-table-file.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * The derived state of one coefficient bank, shared by every
+ * TanhPerErrorRateModel that uses the bank.
+ *
+ * ns-3 creates one error rate model per PHY, so thousands of models use
+ * the same few banks.  The store is process-wide and reference counted:
+ * Get returns the one instance of a bank, creating it on first use, and
+ * the instance is deleted when the last model drops it.  Its curves are a
+ * pure function of (bank, row, nbits), so the store is immutable as seen
+ * by the models; they are merely computed on first use, lock-free (see
+ * TanhPerCurveCache), so models on several threads can share it.
+ *
+ * The registry behind Get is guarded by a mutex, but the reference count
+ * of a store is not atomic: models should acquire and release stores
+ * while they are being configured and disposed, as ns-3 does outside of
+ * the parallel part of a simulation.
+ */
+class TanhPerCurveStore : public SimpleRefCount<TanhPerCurveStore>
+{
+public:
+  /**
+   * \param coefficients the bank; it must live for the whole program
+   *
+   * \return the store of the bank
+   */
+  static Ptr<TanhPerCurveStore> Get (const TanhPerCoefficientSet &coefficients);
+  /**
+   * \return the number of live stores, one per bank in use
+   */
+  static uint32_t GetInstanceCount (void);
+
+  ~TanhPerCurveStore ();
+
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the curve parameters of the given row for nbits bits
+   */
+  const TanhPerCurve & Lookup (uint8_t row, uint32_t nbits) const;
+  /**
+   * \return the bank the curves are derived from
+   */
+  const TanhPerCoefficientSet & GetCoefficients (void) const;
+  /**
+   * \return the number of lookups served from the memo, by every model
+   */
+  uint64_t GetHits (void) const;
+  /**
+   * \return the number of lookups that computed a new curve
+   */
+  uint64_t GetMisses (void) const;
+  /**
+   * Find a DSSS threshold remembered by AddDsssThreshold.  The DSSS
+   * thresholds have no closed form and are searched by bisection, so
+   * the store remembers them for every model of the bank.
+   *
+   * \param handler the mode table entry of the DSSS mode
+   * \param nbits the number of bits in the chunk
+   * \param per the target packet error rate
+   * \param snrDb set to the threshold (dB) if it is found
+   *
+   * \return true if the threshold was found
+   */
+  bool FindDsssThreshold (uint8_t handler, uint32_t nbits, double per, double &snrDb) const;
+  /**
+   * Remember a DSSS threshold.  At most DSSS_THRESHOLD_MAX_ENTRIES are
+   * kept; past it the thresholds remembered so far are forgotten.
+   *
+   * \param handler the mode table entry of the DSSS mode
+   * \param nbits the number of bits in the chunk
+   * \param per the target packet error rate
+   * \param snrDb the threshold (dB)
+   */
+  void AddDsssThreshold (uint8_t handler, uint32_t nbits, double per, double snrDb) const;
+
+private:
+  friend class TanhPerLutStore;
+
+  /**
+   * \param coefficients the bank
+   */
+  TanhPerCurveStore (const TanhPerCoefficientSet &coefficients);
+
+  /// Most DSSS thresholds remembered
+  static const size_t DSSS_THRESHOLD_MAX_ENTRIES = 4096;
+  /// DSSS thresholds (dB) by ((handler, nbits), per)
+  typedef std::map<std::pair<std::pair<uint8_t, uint32_t>, double>, double> DsssThresholdMap;
+
+  const TanhPerCoefficientSet &m_coefficients; //!< the bank
+  mutable TanhPerCurveCache m_curves;          //!< curves by (row, nbits)
+  mutable DsssThresholdMap m_dsssThresholds;   //!< DSSS thresholds found so far
+  mutable std::mutex m_dsssMutex;              //!< guards m_dsssThresholds
+};
+
+/**
+ * \ingroup wifi
+ *
+ * The lookup tables of one coefficient bank at one resolution, error
+ * bound and memory cap, shared by every TanhPerErrorRateModel configured
+ * alike.  Like TanhPerCurveStore it is process-wide and reference
+ * counted.
+ *
+ * Unlike the curves, the tables are kept in least recently used order,
+ * which every lookup updates, so lookups from several threads take turns
+ * on a mutex.  The critical section only moves one list node; the tables
+ * are read outside of it, through the shared_ptr it returns.
+ *
+ * A store may also be backed by a TanhPerTableFile: the (row, nbits)
+ * pairs the file holds are answered from it, without the mutex, and only
+ * the other pairs are built and kept in least recently used order.
+ */
+class TanhPerLutStore : public SimpleRefCount<TanhPerLutStore>
+{
+public:
+  /**
+   * \param curves the curves to sample
+   * \param stepDb the largest grid spacing (dB) of the tables
+   * \param tolerance the largest absolute error allowed against the curves
+   * \param maxBytes the most bytes the tables may hold, or 0 for no limit
+   * \param minUses the number of lookups of a (row, nbits) pair that
+   *        builds its table (see TanhPerLutCache)
+   * \param tables precomputed tables of the same bank, resolution and
+   *        tolerance, or 0
+   *
+   * \return the store of the given configuration
+   */
+  static Ptr<TanhPerLutStore> Get (Ptr<TanhPerCurveStore> curves, double stepDb,
+                                   double tolerance, uint64_t maxBytes, uint32_t minUses,
+                                   const TanhPerTableFile *tables = 0);
+  /**
+   * \return the number of live stores
+   */
+  static uint32_t GetInstanceCount (void);
+
+  ~TanhPerLutStore ();
+
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the tables of the given row for nbits bits, or 0 if they
+   *         are not built yet
+   */
+  std::shared_ptr<const TanhPerLut> Lookup (uint8_t row, uint32_t nbits) const;
+  /**
+   * Run TanhPerLutCache::SelfTest for a configuration, once per process.
+   *
+   * \param curves the curves to sample
+   * \param stepDb the largest grid spacing (dB) of the tables
+   * \param tolerance the largest absolute error allowed against the curves
+   *
+   * \return the largest error found by the self-test
+   */
+  static double SelfTest (Ptr<TanhPerCurveStore> curves, double stepDb, double tolerance);
+  /**
+   * \return the number of bytes held by the tables
+   */
+  uint64_t GetBytes (void) const;
+  /**
+   * \return the largest number of bytes the tables have held
+   */
+  uint64_t GetPeakBytes (void) const;
+  /**
+   * \return the number of tables held
+   */
+  uint32_t GetSize (void) const;
+  /**
+   * \return the number of tables dropped to stay within the memory cap
+   */
+  uint64_t GetEvictions (void) const;
+
+private:
+  /**
+   * \param curves the curves to sample
+   * \param stepDb the largest grid spacing (dB) of the tables
+   * \param tolerance the largest absolute error allowed against the curves
+   * \param maxBytes the most bytes the tables may hold, or 0 for no limit
+   * \param minUses the number of lookups of a pair that builds its table
+   * \param tables precomputed tables, or 0
+   */
+  TanhPerLutStore (Ptr<TanhPerCurveStore> curves, double stepDb, double tolerance,
+                   uint64_t maxBytes, uint32_t minUses, const TanhPerTableFile *tables);
+
+  Ptr<TanhPerCurveStore> m_curves;  //!< the curves sampled
+  double m_stepDb;                  //!< largest grid spacing (dB)
+  double m_tolerance;               //!< largest absolute error allowed
+  uint64_t m_maxBytes;              //!< memory cap, or 0
+  uint32_t m_minUses;               //!< number of lookups of a pair that builds its table
+  const TanhPerTableFile *m_tables; //!< precomputed tables, or 0
+  mutable std::mutex m_mutex;       //!< serialises access to m_luts
+  mutable TanhPerLutCache m_luts;   //!< tables by (row, nbits) not in m_tables
+};
+
+inline const TanhPerCurve &
+TanhPerCurveStore::Lookup (uint8_t row, uint32_t nbits) const
+{
+  return m_curves.Lookup (row, nbits);
+}
+
+inline std::shared_ptr<const TanhPerLut>
+TanhPerLutStore::Lookup (uint8_t row, uint32_t nbits) const
+{
+  if (m_tables != 0)
+    {
+      std::shared_ptr<const TanhPerLut> lut = m_tables->Find (row, nbits);
+      if (lut)
+        {
+          return lut;
+        }
+    }
+  std::lock_guard<std::mutex> lock (m_mutex);
+  return m_luts.Lookup (row, nbits, m_curves->m_curves);
+}
+
+} //namespace ns3
+
+#endif /* TANH_PER_MODEL_STORE_H */
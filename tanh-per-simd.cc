@@ -0,0 +1,495 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "tanh-per-simd.h"
+#include "tanh-per-coefficients.h"
+#include "tanh-per-curve-cache.h"
+
+#if defined (__x86_64__) && (defined (__GNUC__) || defined (__clang__))
+#define TANH_PER_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace ns3 {
+
+// The polynomial kernels below must round identically in every variant.
+// Every product that feeds a sum is therefore written as an explicit fused
+// multiply-add; a plain a * b + c could be contracted by the compiler in
+// one variant and not in another.
+
+static const double LOG2E = 1.4426950408889634074;
+static const double LN2_HI = 6.93147180369123816490e-01; // low 32 bits are zero
+static const double LN2_LO = 1.90821492927058770002e-10;
+static const double DB_PER_NEPER = 4.3429448190325182765; // 10 / ln (10)
+static const double SQRT2 = 1.4142135623730950488;
+static const double TWO52 = 4503599627370496.0;            // 2^52
+static const double INT_MAGIC = 6755399441055744.0;        // 2^52 + 2^51
+static const uint64_t MANTISSA_MASK = 0x000fffffffffffffULL;
+static const uint64_t ONE_BITS = 0x3ff0000000000000ULL;
+// exp () is evaluated for -2 x clamped to [EXP_MIN, EXP_MAX]: below
+// EXP_MIN the success rate rounds to 1, above EXP_MAX it is below 1e-307.
+static const double EXP_MIN = -50.0;
+static const double EXP_MAX = 709.0;
+
+/// 1 / k! for k = 0..13: Taylor series of exp (r) on |r| <= ln (2) / 2
+static const double EXP_C[14] = {
+  1.0, 1.0, 0.5, 0.16666666666666666, 0.041666666666666664,
+  0.008333333333333333, 0.001388888888888889, 0.0001984126984126984,
+  2.48015873015873e-05, 2.7557319223985893e-06, 2.755731922398589e-07,
+  2.505210838544172e-08, 2.08767569878681e-09, 1.6059043836821613e-10
+};
+/// 2 / (2k + 1) for k = 1..11: series of ln ((1 + s) / (1 - s)) - 2 s in s^2
+static const double LOG_C[11] = {
+  0.6666666666666666, 0.4, 0.2857142857142857, 0.2222222222222222,
+  0.18181818181818182, 0.15384615384615385, 0.13333333333333333,
+  0.11764705882352941, 0.10526315789473684, 0.09523809523809523,
+  0.08695652173913043
+};
+
+static inline uint64_t
+ToBits (double x)
+{
+  uint64_t bits;
+  memcpy (&bits, &x, sizeof (bits));
+  return bits;
+}
+
+static inline double
+FromBits (uint64_t bits)
+{
+  double x;
+  memcpy (&x, &bits, sizeof (x));
+  return x;
+}
+
+/*
+ * libm reference
+ */
+
+static void
+LibmToDb (const double *snr, double *snrDb, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      snrDb[i] = 10 * std::log10 (snr[i]);
+    }
+}
+
+static void
+LibmSuccess (const double *snrDb, const double *a, const double *b, double *successRate, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      double per = (1 - std::tanh (a[i] - b[i] * snrDb[i])) / 2;
+      successRate[i] = 1 - per;
+    }
+}
+
+/*
+ * Portable polynomial kernels; the SIMD variants mirror them lane by lane
+ * and fall back to them for the last n % width elements.
+ */
+
+static inline double
+ScalarToDb (double x)
+{
+  if (!(x > 0) || x == std::numeric_limits<double>::infinity ())
+    {
+      if (x == 0)
+        {
+          return -std::numeric_limits<double>::infinity ();
+        }
+      // +inf stays +inf, negative and NaN give NaN
+      return (x > 0) ? x : std::numeric_limits<double>::quiet_NaN ();
+    }
+  int64_t adjust = 0;
+  if (x < std::numeric_limits<double>::min ())
+    {
+      x *= TWO52;
+      adjust = 52;
+    }
+  uint64_t bits = ToBits (x);
+  double e = static_cast<double> (static_cast<int64_t> (bits >> 52) - 1023 - adjust);
+  double m = FromBits ((bits & MANTISSA_MASK) | ONE_BITS);
+  if (m > SQRT2)
+    {
+      m *= 0.5;
+      e += 1;
+    }
+  // ln (m) = ln (1 + f) = f - (hfsq - s * (hfsq + R)), s = f / (2 + f)
+  double f = m - 1;
+  double s = f / (2 + f);
+  double z = s * s;
+  double r = LOG_C[10];
+  for (int k = 9; k >= 0; k--)
+    {
+      r = std::fma (r, z, LOG_C[k]);
+    }
+  r = r * z;
+  double hfsq = (0.5 * f) * f;
+  double lnm = f - std::fma (-s, hfsq + r, hfsq);
+  double ln = std::fma (e, LN2_HI, std::fma (e, LN2_LO, lnm));
+  return ln * DB_PER_NEPER;
+}
+
+static inline double
+ScalarSuccess (double snrDb, double a, double b)
+{
+  // success = (1 + tanh (x)) / 2 = 1 / (1 + exp (-2 x))
+  double t = -2 * std::fma (-b, snrDb, a);
+  if (t != t)
+    {
+      return t;
+    }
+  t = (EXP_MIN > t) ? EXP_MIN : t;
+  t = (EXP_MAX < t) ? EXP_MAX : t;
+  double k = std::nearbyint (t * LOG2E);
+  double r = std::fma (-k, LN2_HI, t);
+  r = std::fma (-k, LN2_LO, r);
+  double p = EXP_C[13];
+  for (int j = 12; j >= 0; j--)
+    {
+      p = std::fma (p, r, EXP_C[j]);
+    }
+  double scale = FromBits (static_cast<uint64_t> (static_cast<int64_t> (k) + 1023) << 52);
+  return 1 / (1 + p * scale);
+}
+
+static void
+ScalarToDbKernel (const double *snr, double *snrDb, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      snrDb[i] = ScalarToDb (snr[i]);
+    }
+}
+
+static void
+ScalarSuccessKernel (const double *snrDb, const double *a, const double *b, double *successRate, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      successRate[i] = ScalarSuccess (snrDb[i], a[i], b[i]);
+    }
+}
+
+#ifdef TANH_PER_X86_KERNELS
+
+/*
+ * AVX2 + FMA, 4 lanes
+ */
+
+__attribute__ ((target ("avx2,fma")))
+static inline __m256d
+Avx2IntToDouble (__m256i i)
+{
+  // exact for |i| < 2^51
+  __m256d magic = _mm256_set1_pd (INT_MAGIC);
+  __m256i sum = _mm256_add_epi64 (i, _mm256_castpd_si256 (magic));
+  return _mm256_sub_pd (_mm256_castsi256_pd (sum), magic);
+}
+
+__attribute__ ((target ("avx2,fma")))
+static void
+Avx2ToDbKernel (const double *snr, double *snrDb, size_t n)
+{
+  const __m256d zero = _mm256_setzero_pd ();
+  const __m256d inf = _mm256_set1_pd (std::numeric_limits<double>::infinity ());
+  const __m256d nan = _mm256_set1_pd (std::numeric_limits<double>::quiet_NaN ());
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d x = _mm256_loadu_pd (snr + i);
+      __m256d small = _mm256_cmp_pd (x, _mm256_set1_pd (std::numeric_limits<double>::min ()), _CMP_LT_OQ);
+      __m256d xs = _mm256_blendv_pd (x, _mm256_mul_pd (x, _mm256_set1_pd (TWO52)), small);
+      __m256i bits = _mm256_castpd_si256 (xs);
+      __m256i adjust = _mm256_and_si256 (_mm256_castpd_si256 (small), _mm256_set1_epi64x (52));
+      __m256i ei = _mm256_sub_epi64 (_mm256_sub_epi64 (_mm256_srli_epi64 (bits, 52), _mm256_set1_epi64x (1023)), adjust);
+      __m256d e = Avx2IntToDouble (ei);
+      __m256d m = _mm256_castsi256_pd (_mm256_or_si256 (_mm256_and_si256 (bits, _mm256_set1_epi64x (MANTISSA_MASK)),
+                                                        _mm256_set1_epi64x (ONE_BITS)));
+      __m256d big = _mm256_cmp_pd (m, _mm256_set1_pd (SQRT2), _CMP_GT_OQ);
+      m = _mm256_blendv_pd (m, _mm256_mul_pd (m, _mm256_set1_pd (0.5)), big);
+      e = _mm256_blendv_pd (e, _mm256_add_pd (e, _mm256_set1_pd (1.0)), big);
+      __m256d f = _mm256_sub_pd (m, _mm256_set1_pd (1.0));
+      __m256d s = _mm256_div_pd (f, _mm256_add_pd (_mm256_set1_pd (2.0), f));
+      __m256d z = _mm256_mul_pd (s, s);
+      __m256d r = _mm256_set1_pd (LOG_C[10]);
+      for (int k = 9; k >= 0; k--)
+        {
+          r = _mm256_fmadd_pd (r, z, _mm256_set1_pd (LOG_C[k]));
+        }
+      r = _mm256_mul_pd (r, z);
+      __m256d hfsq = _mm256_mul_pd (_mm256_mul_pd (_mm256_set1_pd (0.5), f), f);
+      __m256d lnm = _mm256_sub_pd (f, _mm256_fnmadd_pd (s, _mm256_add_pd (hfsq, r), hfsq));
+      __m256d ln = _mm256_fmadd_pd (e, _mm256_set1_pd (LN2_HI),
+                                    _mm256_fmadd_pd (e, _mm256_set1_pd (LN2_LO), lnm));
+      __m256d db = _mm256_mul_pd (ln, _mm256_set1_pd (DB_PER_NEPER));
+      // special values: 0 -> -inf, +inf -> +inf, negative or NaN -> NaN
+      __m256d positive = _mm256_cmp_pd (x, zero, _CMP_GT_OQ);
+      db = _mm256_blendv_pd (nan, db, positive);
+      db = _mm256_blendv_pd (db, inf, _mm256_cmp_pd (x, inf, _CMP_EQ_OQ));
+      db = _mm256_blendv_pd (db, _mm256_sub_pd (zero, inf), _mm256_cmp_pd (x, zero, _CMP_EQ_OQ));
+      _mm256_storeu_pd (snrDb + i, db);
+    }
+  ScalarToDbKernel (snr + i, snrDb + i, n - i);
+}
+
+__attribute__ ((target ("avx2,fma")))
+static void
+Avx2SuccessKernel (const double *snrDb, const double *a, const double *b, double *successRate, size_t n)
+{
+  const __m256d magic = _mm256_set1_pd (INT_MAGIC);
+  const __m256d one = _mm256_set1_pd (1.0);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d x = _mm256_fnmadd_pd (_mm256_loadu_pd (b + i), _mm256_loadu_pd (snrDb + i), _mm256_loadu_pd (a + i));
+      __m256d t = _mm256_mul_pd (_mm256_set1_pd (-2.0), x);
+      // max/min return their second operand when either is NaN, so NaN propagates
+      t = _mm256_max_pd (_mm256_set1_pd (EXP_MIN), t);
+      t = _mm256_min_pd (_mm256_set1_pd (EXP_MAX), t);
+      __m256d k = _mm256_round_pd (_mm256_mul_pd (t, _mm256_set1_pd (LOG2E)),
+                                   _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      __m256d r = _mm256_fnmadd_pd (k, _mm256_set1_pd (LN2_HI), t);
+      r = _mm256_fnmadd_pd (k, _mm256_set1_pd (LN2_LO), r);
+      __m256d p = _mm256_set1_pd (EXP_C[13]);
+      for (int j = 12; j >= 0; j--)
+        {
+          p = _mm256_fmadd_pd (p, r, _mm256_set1_pd (EXP_C[j]));
+        }
+      __m256i ki = _mm256_sub_epi64 (_mm256_castpd_si256 (_mm256_add_pd (k, magic)), _mm256_castpd_si256 (magic));
+      __m256d scale = _mm256_castsi256_pd (_mm256_slli_epi64 (_mm256_add_epi64 (ki, _mm256_set1_epi64x (1023)), 52));
+      __m256d success = _mm256_div_pd (one, _mm256_add_pd (one, _mm256_mul_pd (p, scale)));
+      _mm256_storeu_pd (successRate + i, success);
+    }
+  ScalarSuccessKernel (snrDb + i, a + i, b + i, successRate + i, n - i);
+}
+
+/*
+ * AVX-512F, 8 lanes
+ */
+
+#if !defined (__clang__)
+// GCC's avx512fintrin.h seeds masked builtins with an uninitialised
+// _mm512_undefined_* value and then warns about it
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__ ((target ("avx512f")))
+static void
+Avx512ToDbKernel (const double *snr, double *snrDb, size_t n)
+{
+  const __m512d zero = _mm512_setzero_pd ();
+  const __m512d inf = _mm512_set1_pd (std::numeric_limits<double>::infinity ());
+  const __m512d nan = _mm512_set1_pd (std::numeric_limits<double>::quiet_NaN ());
+  const __m512d magic = _mm512_set1_pd (INT_MAGIC);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    {
+      __m512d x = _mm512_loadu_pd (snr + i);
+      __mmask8 small = _mm512_cmp_pd_mask (x, _mm512_set1_pd (std::numeric_limits<double>::min ()), _CMP_LT_OQ);
+      __m512d xs = _mm512_mask_mul_pd (x, small, x, _mm512_set1_pd (TWO52));
+      __m512i bits = _mm512_castpd_si512 (xs);
+      __m512i adjust = _mm512_maskz_mov_epi64 (small, _mm512_set1_epi64 (52));
+      __m512i ei = _mm512_sub_epi64 (_mm512_sub_epi64 (_mm512_srli_epi64 (bits, 52), _mm512_set1_epi64 (1023)), adjust);
+      __m512d e = _mm512_sub_pd (_mm512_castsi512_pd (_mm512_add_epi64 (ei, _mm512_castpd_si512 (magic))), magic);
+      __m512d m = _mm512_castsi512_pd (_mm512_or_si512 (_mm512_and_si512 (bits, _mm512_set1_epi64 (MANTISSA_MASK)),
+                                                        _mm512_set1_epi64 (ONE_BITS)));
+      __mmask8 big = _mm512_cmp_pd_mask (m, _mm512_set1_pd (SQRT2), _CMP_GT_OQ);
+      m = _mm512_mask_mul_pd (m, big, m, _mm512_set1_pd (0.5));
+      e = _mm512_mask_add_pd (e, big, e, _mm512_set1_pd (1.0));
+      __m512d f = _mm512_sub_pd (m, _mm512_set1_pd (1.0));
+      __m512d s = _mm512_div_pd (f, _mm512_add_pd (_mm512_set1_pd (2.0), f));
+      __m512d z = _mm512_mul_pd (s, s);
+      __m512d r = _mm512_set1_pd (LOG_C[10]);
+      for (int k = 9; k >= 0; k--)
+        {
+          r = _mm512_fmadd_pd (r, z, _mm512_set1_pd (LOG_C[k]));
+        }
+      r = _mm512_mul_pd (r, z);
+      __m512d hfsq = _mm512_mul_pd (_mm512_mul_pd (_mm512_set1_pd (0.5), f), f);
+      __m512d lnm = _mm512_sub_pd (f, _mm512_fnmadd_pd (s, _mm512_add_pd (hfsq, r), hfsq));
+      __m512d ln = _mm512_fmadd_pd (e, _mm512_set1_pd (LN2_HI),
+                                    _mm512_fmadd_pd (e, _mm512_set1_pd (LN2_LO), lnm));
+      __m512d db = _mm512_mul_pd (ln, _mm512_set1_pd (DB_PER_NEPER));
+      // special values: 0 -> -inf, +inf -> +inf, negative or NaN -> NaN
+      db = _mm512_mask_blend_pd (_mm512_cmp_pd_mask (x, zero, _CMP_GT_OQ), nan, db);
+      db = _mm512_mask_blend_pd (_mm512_cmp_pd_mask (x, inf, _CMP_EQ_OQ), db, inf);
+      db = _mm512_mask_blend_pd (_mm512_cmp_pd_mask (x, zero, _CMP_EQ_OQ), db, _mm512_sub_pd (zero, inf));
+      _mm512_storeu_pd (snrDb + i, db);
+    }
+  ScalarToDbKernel (snr + i, snrDb + i, n - i);
+}
+
+__attribute__ ((target ("avx512f")))
+static void
+Avx512SuccessKernel (const double *snrDb, const double *a, const double *b, double *successRate, size_t n)
+{
+  const __m512d magic = _mm512_set1_pd (INT_MAGIC);
+  const __m512d one = _mm512_set1_pd (1.0);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    {
+      __m512d x = _mm512_fnmadd_pd (_mm512_loadu_pd (b + i), _mm512_loadu_pd (snrDb + i), _mm512_loadu_pd (a + i));
+      __m512d t = _mm512_mul_pd (_mm512_set1_pd (-2.0), x);
+      // same NaN behaviour as the AVX2 max/min
+      t = _mm512_mask_blend_pd (_mm512_cmp_pd_mask (_mm512_set1_pd (EXP_MIN), t, _CMP_GT_OQ), t, _mm512_set1_pd (EXP_MIN));
+      t = _mm512_mask_blend_pd (_mm512_cmp_pd_mask (_mm512_set1_pd (EXP_MAX), t, _CMP_LT_OQ), t, _mm512_set1_pd (EXP_MAX));
+      __m512d k = _mm512_roundscale_pd (_mm512_mul_pd (t, _mm512_set1_pd (LOG2E)),
+                                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      __m512d r = _mm512_fnmadd_pd (k, _mm512_set1_pd (LN2_HI), t);
+      r = _mm512_fnmadd_pd (k, _mm512_set1_pd (LN2_LO), r);
+      __m512d p = _mm512_set1_pd (EXP_C[13]);
+      for (int j = 12; j >= 0; j--)
+        {
+          p = _mm512_fmadd_pd (p, r, _mm512_set1_pd (EXP_C[j]));
+        }
+      __m512i ki = _mm512_sub_epi64 (_mm512_castpd_si512 (_mm512_add_pd (k, magic)), _mm512_castpd_si512 (magic));
+      __m512d scale = _mm512_castsi512_pd (_mm512_slli_epi64 (_mm512_add_epi64 (ki, _mm512_set1_epi64 (1023)), 52));
+      __m512d success = _mm512_div_pd (one, _mm512_add_pd (one, _mm512_mul_pd (p, scale)));
+      _mm512_storeu_pd (successRate + i, success);
+    }
+  ScalarSuccessKernel (snrDb + i, a + i, b + i, successRate + i, n - i);
+}
+
+#if !defined (__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif /* TANH_PER_X86_KERNELS */
+
+static const TanhPerKernels g_libmKernels = { "libm", &LibmToDb, &LibmSuccess };
+static const TanhPerKernels g_scalarKernels = { "scalar", &ScalarToDbKernel, &ScalarSuccessKernel };
+#ifdef TANH_PER_X86_KERNELS
+static const TanhPerKernels g_avx2Kernels = { "avx2", &Avx2ToDbKernel, &Avx2SuccessKernel };
+static const TanhPerKernels g_avx512Kernels = { "avx512", &Avx512ToDbKernel, &Avx512SuccessKernel };
+#endif
+
+const TanhPerKernels &
+GetTanhPerLibmKernels (void)
+{
+  return g_libmKernels;
+}
+
+const TanhPerKernels *
+GetTanhPerKernels (const std::string &name)
+{
+  if (name == "libm")
+    {
+      return &g_libmKernels;
+    }
+  if (name == "scalar")
+    {
+      return &g_scalarKernels;
+    }
+#ifdef TANH_PER_X86_KERNELS
+  __builtin_cpu_init ();
+  if (name == "avx2" && __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"))
+    {
+      return &g_avx2Kernels;
+    }
+  if (name == "avx512" && __builtin_cpu_supports ("avx512f"))
+    {
+      return &g_avx512Kernels;
+    }
+#endif
+  return 0;
+}
+
+static const TanhPerKernels *
+SelectVectorKernels (void)
+{
+  const char *preferred[] = { "avx512", "avx2" };
+  for (size_t i = 0; i < sizeof (preferred) / sizeof (preferred[0]); i++)
+    {
+      const TanhPerKernels *kernels = GetTanhPerKernels (preferred[i]);
+      if (kernels != 0)
+        {
+          return kernels;
+        }
+    }
+  return &g_scalarKernels;
+}
+
+const TanhPerKernels &
+GetTanhPerVectorKernels (void)
+{
+  static const TanhPerKernels *kernels = SelectVectorKernels ();
+  return *kernels;
+}
+
+double
+CheckTanhPerKernels (const TanhPerKernels &kernels, const TanhPerKernels &reference)
+{
+  const uint32_t sizes[] = { 8, 80, 400, 800, 4000, 8000, 12000, 24000 };
+  const uint32_t nSizes = sizeof (sizes) / sizeof (sizes[0]);
+  std::vector<double> snr;
+  for (double db = -20; db <= 50; db += 0.05)
+    {
+      snr.push_back (std::pow (10.0, db / 10));
+    }
+  size_t n = snr.size ();
+  std::vector<double> snrDb (n), refSnrDb (n), a (n), b (n), success (n), refSuccess (n);
+  kernels.toDb (&snr[0], &snrDb[0], n);
+  reference.toDb (&snr[0], &refSnrDb[0], n);
+  for (size_t i = 0; i < n; i++)
+    {
+      if (!(std::fabs (snrDb[i] - refSnrDb[i]) <= 1e-12))
+        {
+          return std::numeric_limits<double>::infinity ();
+        }
+    }
+
+  double maxError = 0;
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      const TanhPerCoefficientSet *set = GetTanhPerCoefficientSet (model);
+      for (uint32_t row = 0; row < 8; row++)
+        {
+          for (uint32_t regime = 0; regime < 2; regime++)
+            {
+              const TanhPerCoefficients &c = regime ? set->high[row] : set->low[row];
+              for (uint32_t j = 0; j < nSizes; j++)
+                {
+                  double curveA, curveB;
+                  TanhPerCurveCache::ComputeParameters (c, sizes[j], curveA, curveB);
+                  std::fill (a.begin (), a.end (), curveA);
+                  std::fill (b.begin (), b.end (), curveB);
+                  kernels.success (&refSnrDb[0], &a[0], &b[0], &success[0], n);
+                  reference.success (&refSnrDb[0], &a[0], &b[0], &refSuccess[0], n);
+                  for (size_t i = 0; i < n; i++)
+                    {
+                      double error = std::fabs (success[i] - refSuccess[i]);
+                      if (!(error <= maxError))
+                        {
+                          maxError = (error == error) ? error : std::numeric_limits<double>::infinity ();
+                        }
+                    }
+                }
+            }
+        }
+    }
+  return maxError;
+}
+
+} //namespace ns3
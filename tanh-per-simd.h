@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TANH_PER_SIMD_H
+#define TANH_PER_SIMD_H
+
+#include <stddef.h>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * Set snrDb[i] = 10 log10 (snr[i]) for every i < n.
+ */
+typedef void (*TanhPerDbKernel) (const double *snr, double *snrDb, size_t n);
+/**
+ * Set successRate[i] = 1 - (1 - tanh (a[i] - b[i] * snrDb[i])) / 2 for
+ * every i < n.
+ */
+typedef void (*TanhPerSuccessKernel) (const double *snrDb, const double *a, const double *b,
+                                      double *successRate, size_t n);
+
+/**
+ * \ingroup wifi
+ *
+ * The array kernels used by TanhPerErrorRateModel::GetChunkSuccessRateBatch.
+ *
+ * The "libm" kernels call std::log10 and std::tanh and reproduce the
+ * scalar model code bit for bit.  The "scalar", "avx2" and "avx512"
+ * kernels evaluate log10 and the success rate 1 / (1 + exp (-2 x)) with
+ * the same polynomials and the same sequence of fused multiply-adds, so
+ * they return bit-identical results on every CPU; only their speed
+ * differs.  Against libm they differ by a few ULP (see
+ * CheckTanhPerKernels).
+ */
+struct TanhPerKernels
+{
+  const char *name;             //!< "libm", "scalar", "avx2" or "avx512"
+  TanhPerDbKernel toDb;         //!< SNR to dB conversion
+  TanhPerSuccessKernel success; //!< success rate of the tanh curve
+};
+
+/**
+ * \return the std::log10 / std::tanh reference kernels
+ */
+const TanhPerKernels & GetTanhPerLibmKernels (void);
+/**
+ * \return the fastest polynomial kernels the running CPU supports
+ */
+const TanhPerKernels & GetTanhPerVectorKernels (void);
+/**
+ * \param name "libm", "scalar", "avx2" or "avx512"
+ *
+ * \return the named kernels, or 0 if they are unknown or the running CPU
+ *         does not support them
+ */
+const TanhPerKernels * GetTanhPerKernels (const std::string &name);
+
+/**
+ * Compare two sets of kernels over every coefficient row of the
+ * ErrorRateModel2..9 banks, both PER regimes, chunk sizes from 1 byte to
+ * 3000 bytes and SNRs from -20 dB to 50 dB.
+ *
+ * \param kernels the kernels to check
+ * \param reference the kernels to compare against
+ *
+ * \return the largest absolute difference of the success rates, or
+ *         infinity if the SNR to dB conversion of any point differs by
+ *         more than 1e-12 dB
+ */
+double CheckTanhPerKernels (const TanhPerKernels &kernels, const TanhPerKernels &reference);
+
+} //namespace ns3
+
+#endif /* TANH_PER_SIMD_H */
@@ -0,0 +1,51 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "tanh-per-static-curves.h"
+
+namespace ns3 {
+
+// one instantiation per registered model
+template class TanhPerStaticCurves<2>;
+template class TanhPerStaticCurves<3>;
+template class TanhPerStaticCurves<4>;
+template class TanhPerStaticCurves<5>;
+template class TanhPerStaticCurves<6>;
+template class TanhPerStaticCurves<7>;
+template class TanhPerStaticCurves<8>;
+template class TanhPerStaticCurves<9>;
+
+TanhPerCurveFunction
+GetTanhPerStaticCurveFunction (const TanhPerCoefficientSet &coefficients)
+{
+  static const TanhPerCurveFunction functions[] = {
+    &TanhPerStaticCurves<2>::Compute, &TanhPerStaticCurves<3>::Compute,
+    &TanhPerStaticCurves<4>::Compute, &TanhPerStaticCurves<5>::Compute,
+    &TanhPerStaticCurves<6>::Compute, &TanhPerStaticCurves<7>::Compute,
+    &TanhPerStaticCurves<8>::Compute, &TanhPerStaticCurves<9>::Compute
+  };
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      if (&coefficients == GetTanhPerCoefficientSet (model))
+        {
+          return functions[model - 2];
+        }
+    }
+  return 0;
+}
+
+} //namespace ns3
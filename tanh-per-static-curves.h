@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_STATIC_CURVES_H
+#define TANH_PER_STATIC_CURVES_H
+
+#include <stdint.h>
+#include <cmath>
+#include "tanh-per-banks.h"
+#include "tanh-per-curve-cache.h"
+
+namespace ns3 {
+
+/**
+ * Compute the curve of one coefficient row for a chunk size.
+ *
+ * \param row the coefficient row (0..7)
+ * \param nbits the number of bits in the chunk
+ * \param curve set to the curve
+ */
+typedef void (*TanhPerCurveFunction) (uint8_t row, uint32_t nbits, TanhPerCurve &curve);
+
+/**
+ * \ingroup wifi
+ *
+ * The curve computation of TanhPerCurveCache, specialised on the bank of
+ * ErrorRateModelN.  Every coefficient is a compile-time constant, so the
+ * compiler emits each of the 8 rows as straight-line code with the
+ * coefficients folded into it, and the row is selected by a jump table
+ * instead of indexing into the bank.  The operations are the same as
+ * TanhPerCurveCache::ComputeParameters, so the curves are bit-identical.
+ *
+ * \tparam N the model number N of ErrorRateModelN (2..9)
+ */
+template <uint32_t N>
+class TanhPerStaticCurves
+{
+public:
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   * \param curve set to the curve of the row for nbits bits
+   */
+  static void Compute (uint8_t row, uint32_t nbits, TanhPerCurve &curve);
+  /**
+   * Evaluate the success rate without any cache, as the generic code
+   * does from a runtime bank.
+   *
+   * \param row the coefficient row (0..7)
+   * \param snrDb the SNR (dB)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the success rate
+   */
+  static double GetSuccessRate (uint8_t row, double snrDb, uint32_t nbits);
+
+private:
+  /**
+   * \tparam Row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   * \param curve set to the curve of Row for nbits bits
+   */
+  template <uint8_t Row>
+  static void ComputeRow (uint32_t nbits, TanhPerCurve &curve);
+};
+
+template <uint32_t N>
+template <uint8_t Row>
+inline void
+TanhPerStaticCurves<N>::ComputeRow (uint32_t nbits, TanhPerCurve &curve)
+{
+  const TanhPerCoefficientSet &bank = TanhPerBank<N>::coefficients;
+  curve.aLow = bank.low[Row].c1 * std::exp (bank.low[Row].d1 * nbits)
+    + bank.low[Row].c2 * std::exp (bank.low[Row].d2 * nbits);
+  curve.bLow = bank.low[Row].c3 * std::exp (bank.low[Row].d3 * nbits)
+    + bank.low[Row].c4 * std::exp (bank.low[Row].d4 * nbits);
+  curve.aHigh = bank.high[Row].c1 * std::exp (bank.high[Row].d1 * nbits)
+    + bank.high[Row].c2 * std::exp (bank.high[Row].d2 * nbits);
+  curve.bHigh = bank.high[Row].c3 * std::exp (bank.high[Row].d3 * nbits)
+    + bank.high[Row].c4 * std::exp (bank.high[Row].d4 * nbits);
+  TanhPerCurveCache::SetRegimeSwitch (curve);
+}
+
+template <uint32_t N>
+void
+TanhPerStaticCurves<N>::Compute (uint8_t row, uint32_t nbits, TanhPerCurve &curve)
+{
+  switch (row)
+    {
+    case 0:
+      ComputeRow<0> (nbits, curve);
+      break;
+    case 1:
+      ComputeRow<1> (nbits, curve);
+      break;
+    case 2:
+      ComputeRow<2> (nbits, curve);
+      break;
+    case 3:
+      ComputeRow<3> (nbits, curve);
+      break;
+    case 4:
+      ComputeRow<4> (nbits, curve);
+      break;
+    case 5:
+      ComputeRow<5> (nbits, curve);
+      break;
+    case 6:
+      ComputeRow<6> (nbits, curve);
+      break;
+    default:
+      ComputeRow<7> (nbits, curve);
+      break;
+    }
+}
+
+template <uint32_t N>
+double
+TanhPerStaticCurves<N>::GetSuccessRate (uint8_t row, double snrDb, uint32_t nbits)
+{
+  TanhPerCurve curve;
+  Compute (row, nbits, curve);
+  bool high = curve.IsHighRegime (snrDb);
+  double a = high ? curve.aHigh : curve.aLow;
+  double b = high ? curve.bHigh : curve.bLow;
+  return 1 - (1 - std::tanh (a - b * snrDb)) / 2;
+}
+
+/**
+ * \param coefficients a coefficient bank
+ *
+ * \return TanhPerStaticCurves<N>::Compute if the bank is that of
+ *         ErrorRateModelN, or 0 for any other bank
+ */
+TanhPerCurveFunction GetTanhPerStaticCurveFunction (const TanhPerCoefficientSet &coefficients);
+
+} //namespace ns3
+
+#endif /* TANH_PER_STATIC_CURVES_H */
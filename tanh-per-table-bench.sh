@@ -0,0 +1,64 @@
+#!/bin/sh
+#
+# Cold start and memory of a parameter-sweep campaign: PROCESSES copies of
+# the same simulation started at once, with the tanh PER lookup tables
+# built by every process ("private") and attached read-only from one
+# table file ("shared", the TableFile attribute).
+#
+# Usage: tanh-per-table-bench.sh [BENCH] [PROCESSES] [MODEL] [HOLD]
+#   BENCH      error-rate-model-bench binary (./build/error-rate-model-bench)
+#   PROCESSES  processes started at once (64)
+#   MODEL      N of the ErrorRateModelN tabulated (2)
+#   HOLD       seconds each process waits before reading its memory, so
+#              that all of them are alive at that time (2)
+#
+# setup_ms is the time from model creation to the end of the first use of
+# every table; process start-up before it is the same for both layouts.
+# RSS counts shared pages in full in every process, PSS divides them among
+# the processes that map them, and private is what no other process
+# shares.  TABLE_SIZES (bytes, comma separated) overrides the chunk sizes.
+
+BENCH=${1:-./build/error-rate-model-bench}
+PROCESSES=${2:-64}
+MODEL=${3:-2}
+HOLD=${4:-2}
+SIZES=${TABLE_SIZES:-50,100,200,300,500,750,1000,1250,1500,2000,3000}
+DIR=$(mktemp -d "${TMPDIR:-/tmp}/tanh-per-table-bench.XXXXXX") || exit 1
+trap 'rm -rf "$DIR"' EXIT
+
+"$BENCH" --models="$MODEL" --table-sizes="$SIZES" --write-tables="$DIR/tables.bin" || exit 1
+echo "table file: $(wc -c < "$DIR/tables.bin") bytes, $PROCESSES processes, ErrorRateModel$MODEL"
+
+for layout in private shared; do
+  if [ "$layout" = shared ]; then
+    TABLE_FILE="--table-file=$DIR/tables.bin"
+  else
+    TABLE_FILE=
+  fi
+  i=0
+  while [ "$i" -lt "$PROCESSES" ]; do
+    "$BENCH" --models="$MODEL" --table-sizes="$SIZES" --cold-start --hold="$HOLD" \
+             $TABLE_FILE > "$DIR/$layout.$i" &
+    i=$((i + 1))
+  done
+  wait
+  cat "$DIR/$layout".* | awk -v layout="$layout" '
+    {
+      for (f = 1; f <= NF; f++)
+        {
+          split ($f, kv, "=")
+          sum[kv[1]] += kv[2]
+        }
+      n++
+    }
+    END {
+      if (n == 0)
+        {
+          print layout ": no process reported"
+          exit 1
+        }
+      printf "%-8s setup %.2f ms, RSS %.0f kB, PSS %.0f kB, private %.0f kB per process; PSS %.0f kB in all\n",
+             layout, sum["setup_ms"] / n, sum["rss_kb"] / n, sum["pss_kb"] / n,
+             sum["private_kb"] / n, sum["pss_kb"]
+    }' || exit 1
+done
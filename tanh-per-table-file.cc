@@ -0,0 +1,386 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include "tanh-per-table-file.h"
+#include "fnv-hash.h"
+#include "tanh-per-curve-cache.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TanhPerTableFile");
+
+/// Header of a table file; the bank, the index and the grid points follow it
+struct TanhPerTableFileHeader
+{
+  char magic[8];            //!< TABLE_MAGIC
+  uint32_t byteOrder;       //!< TABLE_BYTE_ORDER, as written by the host
+  uint32_t tables;          //!< number of index entries
+  double stepDb;            //!< largest grid spacing (dB)
+  double tolerance;         //!< largest absolute error allowed
+  uint64_t fileBytes;       //!< size of the whole file
+  uint64_t samplesChecksum; //!< FNV-1a of the grid points
+  uint64_t checksum;        //!< FNV-1a of the header, with this field 0, the bank and the index
+  uint64_t reserved;        //!< 0; pads the header to 64 bytes
+};
+
+/// Location of the grid points of one TanhPerLutSegment in a table file
+struct TanhPerTableFileSegment
+{
+  double firstDb;     //!< SNR (dB) of the first grid point
+  double inverseStep; //!< 1 / grid spacing (1/dB)
+  uint64_t offset;    //!< offset of the first grid point in the file (bytes)
+  uint64_t size;      //!< number of grid points
+};
+
+/// Index entry of the TanhPerLut of one (row, nbits) pair in a table file
+struct TanhPerTableFileEntry
+{
+  uint32_t row;                 //!< coefficient row
+  uint32_t nbits;               //!< chunk size
+  double switchDb;              //!< TanhPerCurve::switchDb
+  uint64_t highAbove;           //!< TanhPerCurve::highAbove
+  TanhPerTableFileSegment low;  //!< arreglo_modelo table
+  TanhPerTableFileSegment high; //!< arreglo_modelo1 table
+};
+
+static_assert (sizeof (TanhPerTableFileHeader) == 64, "table file header is not packed");
+static_assert (sizeof (TanhPerTableFileEntry) == 88, "table file entry is not packed");
+
+/// Magic number of a table file, with its format version
+static const char TABLE_MAGIC[8] = { 'T', 'P', 'E', 'R', 'T', 'B', 'L', '1' };
+/// Reads back differently on a host of the other byte order
+static const uint32_t TABLE_BYTE_ORDER = 0x01020304;
+/// Alignment of the grid points in a table file (bytes)
+static const uint64_t TABLE_ALIGNMENT = 64;
+
+/**
+ * \param header a table file header
+ * \param coefficients the bank that follows it
+ * \param entries the index that follows the bank
+ *
+ * \return the checksum the header should hold
+ */
+static uint64_t
+GetChecksum (const TanhPerTableFileHeader &header, const TanhPerCoefficientSet &coefficients,
+             const TanhPerTableFileEntry *entries)
+{
+  TanhPerTableFileHeader zeroed = header;
+  zeroed.checksum = 0;
+  uint64_t hash = HashBytes (&zeroed, sizeof (zeroed));
+  hash = HashBytes (&coefficients, sizeof (coefficients), hash);
+  return HashBytes (entries, header.tables * sizeof (TanhPerTableFileEntry), hash);
+}
+
+/**
+ * \param tables the number of index entries
+ *
+ * \return the offset of the first grid point in a table file
+ */
+static uint64_t
+GetSamplesOffset (uint32_t tables)
+{
+  uint64_t offset = sizeof (TanhPerTableFileHeader) + sizeof (TanhPerCoefficientSet)
+    + uint64_t (tables) * sizeof (TanhPerTableFileEntry);
+  return (offset + TABLE_ALIGNMENT - 1) / TABLE_ALIGNMENT * TABLE_ALIGNMENT;
+}
+
+TanhPerTableFile::TanhPerTableFile ()
+  : m_mapping (0),
+    m_bytes (0),
+    m_coefficients (0),
+    m_stepDb (0),
+    m_tolerance (0)
+{
+}
+
+TanhPerTableFile::~TanhPerTableFile ()
+{
+  m_tables.clear ();
+  if (m_mapping != 0)
+    {
+      munmap (const_cast<char *> (m_mapping), m_bytes);
+    }
+}
+
+const TanhPerCoefficientSet &
+TanhPerTableFile::GetCoefficients (void) const
+{
+  return *m_coefficients;
+}
+
+double
+TanhPerTableFile::GetResolution (void) const
+{
+  return m_stepDb;
+}
+
+double
+TanhPerTableFile::GetMaxError (void) const
+{
+  return m_tolerance;
+}
+
+uint32_t
+TanhPerTableFile::GetSize (void) const
+{
+  return m_tables.size ();
+}
+
+uint64_t
+TanhPerTableFile::GetMappedBytes (void) const
+{
+  return m_bytes;
+}
+
+bool
+TanhPerTableFile::Verify (void) const
+{
+  const TanhPerTableFileHeader &header = *reinterpret_cast<const TanhPerTableFileHeader *> (m_mapping);
+  uint64_t offset = GetSamplesOffset (header.tables);
+  return HashBytes (m_mapping + offset, m_bytes - offset) == header.samplesChecksum;
+}
+
+bool
+TanhPerTableFile::Write (const std::string &fileName, const TanhPerCoefficientSet &coefficients,
+                         const std::vector<uint32_t> &sizes, double stepDb, double tolerance,
+                         std::string &error)
+{
+  if (!(stepDb > 0) || !(tolerance > 0))
+    {
+      error = "the grid spacing and the tolerance must be positive";
+      return false;
+    }
+  std::vector<uint32_t> nbits (sizes);
+  std::sort (nbits.begin (), nbits.end ());
+  nbits.erase (std::unique (nbits.begin (), nbits.end ()), nbits.end ());
+
+  // build and check the tables
+  TanhPerCurveCache curves (coefficients);
+  std::vector<TanhPerLut> luts;
+  std::vector<TanhPerTableFileEntry> entries;
+  for (uint8_t row = 0; row < 8; row++)
+    {
+      for (size_t i = 0; i < nbits.size (); i++)
+        {
+          const TanhPerCurve &curve = curves.Lookup (row, nbits[i]);
+          luts.push_back (TanhPerLut (curve, stepDb, tolerance));
+          const uint32_t points = 1024;
+          for (uint32_t k = 0; k < points; k++)
+            {
+              // off the grid, across both regimes and both saturated ends
+              double snrDb = -20 + 70 * (k + 0.5) / points;
+              bool high = curve.IsHighRegime (snrDb);
+              double a = high ? curve.aHigh : curve.aLow;
+              double b = high ? curve.bHigh : curve.bLow;
+              double expected = 1 - (1 - std::tanh (a - b * snrDb)) / 2;
+              if (!(std::abs (luts.back ().GetSuccessRate (snrDb) - expected) <= tolerance))
+                {
+                  std::ostringstream os;
+                  os << "table of row " << +row << " for " << nbits[i] << " bits is off by "
+                     << std::abs (luts.back ().GetSuccessRate (snrDb) - expected) << " at " << snrDb << " dB";
+                  error = os.str ();
+                  return false;
+                }
+            }
+          TanhPerTableFileEntry entry;
+          memset (&entry, 0, sizeof (entry));
+          entry.row = row;
+          entry.nbits = nbits[i];
+          entry.switchDb = curve.switchDb;
+          entry.highAbove = curve.highAbove;
+          entries.push_back (entry);
+        }
+    }
+
+  // lay out the grid points after the index
+  uint64_t offset = GetSamplesOffset (entries.size ());
+  for (size_t i = 0; i < entries.size (); i++)
+    {
+      const TanhPerLutSegment *segments[] = { &luts[i].m_low, &luts[i].m_high };
+      TanhPerTableFileSegment *located[] = { &entries[i].low, &entries[i].high };
+      for (uint32_t s = 0; s < 2; s++)
+        {
+          located[s]->firstDb = segments[s]->m_firstDb;
+          located[s]->inverseStep = segments[s]->m_inverseStep;
+          located[s]->offset = offset;
+          located[s]->size = segments[s]->GetSize ();
+          offset += segments[s]->GetSize () * sizeof (double);
+        }
+    }
+
+  TanhPerTableFileHeader header;
+  memset (&header, 0, sizeof (header));
+  memcpy (header.magic, TABLE_MAGIC, sizeof (TABLE_MAGIC));
+  header.byteOrder = TABLE_BYTE_ORDER;
+  header.tables = entries.size ();
+  header.stepDb = stepDb;
+  header.tolerance = tolerance;
+  header.fileBytes = offset;
+  uint64_t samplesChecksum = HashBytes (0, 0);
+  const char padding[TABLE_ALIGNMENT] = {};
+  uint64_t indexEnd = sizeof (header) + sizeof (coefficients) + entries.size () * sizeof (TanhPerTableFileEntry);
+  uint64_t paddingBytes = GetSamplesOffset (entries.size ()) - indexEnd;
+  for (size_t i = 0; i < luts.size (); i++)
+    {
+      samplesChecksum = HashBytes (luts[i].m_low.m_values, luts[i].m_low.GetSize () * sizeof (double),
+                                   samplesChecksum);
+      samplesChecksum = HashBytes (luts[i].m_high.m_values, luts[i].m_high.GetSize () * sizeof (double),
+                                   samplesChecksum);
+    }
+  header.samplesChecksum = samplesChecksum;
+  header.checksum = GetChecksum (header, coefficients, entries.data ());
+
+  std::ostringstream temporary;
+  temporary << fileName << "." << getpid () << ".tmp";
+  std::ofstream os (temporary.str ().c_str (), std::ios::binary);
+  os.write (reinterpret_cast<const char *> (&header), sizeof (header));
+  os.write (reinterpret_cast<const char *> (&coefficients), sizeof (coefficients));
+  os.write (reinterpret_cast<const char *> (entries.data ()), entries.size () * sizeof (TanhPerTableFileEntry));
+  os.write (padding, paddingBytes);
+  for (size_t i = 0; i < luts.size (); i++)
+    {
+      os.write (reinterpret_cast<const char *> (luts[i].m_low.m_values), luts[i].m_low.GetSize () * sizeof (double));
+      os.write (reinterpret_cast<const char *> (luts[i].m_high.m_values), luts[i].m_high.GetSize () * sizeof (double));
+    }
+  os.close ();
+  if (os.fail () || rename (temporary.str ().c_str (), fileName.c_str ()) != 0)
+    {
+      error = fileName + ": " + strerror (errno);
+      unlink (temporary.str ().c_str ());
+      return false;
+    }
+  return true;
+}
+
+/**
+ * \return the mutex guarding the attached table files
+ */
+static std::mutex &
+GetOpenMutex (void)
+{
+  static std::mutex *mutex = new std::mutex ();
+  return *mutex;
+}
+
+/**
+ * \return the attached table files by name; never destroyed, as the
+ *         stores of the models refer to them until the end of the program
+ */
+static std::map<std::string, const TanhPerTableFile *> &
+GetOpenFiles (void)
+{
+  static std::map<std::string, const TanhPerTableFile *> *files =
+    new std::map<std::string, const TanhPerTableFile *> ();
+  return *files;
+}
+
+const TanhPerTableFile *
+TanhPerTableFile::Open (const std::string &fileName, std::string &error)
+{
+  std::lock_guard<std::mutex> lock (GetOpenMutex ());
+  std::map<std::string, const TanhPerTableFile *>::iterator it = GetOpenFiles ().find (fileName);
+  if (it != GetOpenFiles ().end ())
+    {
+      return it->second;
+    }
+
+  int fd = open (fileName.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      error = fileName + ": " + strerror (errno);
+      return 0;
+    }
+  struct stat st;
+  void *mapping = MAP_FAILED;
+  if (fstat (fd, &st) == 0 && size_t (st.st_size) >= GetSamplesOffset (0))
+    {
+      mapping = mmap (0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+  close (fd);
+  if (mapping == MAP_FAILED)
+    {
+      error = fileName + ": not a tanh PER table file";
+      return 0;
+    }
+  TanhPerTableFile *file = new TanhPerTableFile ();
+  file->m_mapping = static_cast<const char *> (mapping);
+  file->m_bytes = st.st_size;
+
+  const TanhPerTableFileHeader &header = *reinterpret_cast<const TanhPerTableFileHeader *> (file->m_mapping);
+  const TanhPerCoefficientSet *coefficients = reinterpret_cast<const TanhPerCoefficientSet *> (&header + 1);
+  const TanhPerTableFileEntry *entries = reinterpret_cast<const TanhPerTableFileEntry *> (coefficients + 1);
+  if (memcmp (header.magic, TABLE_MAGIC, sizeof (TABLE_MAGIC)) != 0
+      || header.byteOrder != TABLE_BYTE_ORDER
+      || header.fileBytes != file->m_bytes
+      || GetSamplesOffset (header.tables) > file->m_bytes
+      || header.checksum != GetChecksum (header, *coefficients, entries))
+    {
+      error = fileName + ": not a tanh PER table file, or corrupt";
+      delete file;
+      return 0;
+    }
+  file->m_coefficients = coefficients;
+  file->m_stepDb = header.stepDb;
+  file->m_tolerance = header.tolerance;
+  uint64_t samples = GetSamplesOffset (header.tables);
+  for (uint32_t i = 0; i < header.tables; i++)
+    {
+      const TanhPerTableFileEntry &entry = entries[i];
+      const TanhPerTableFileSegment *segments[] = { &entry.low, &entry.high };
+      for (uint32_t s = 0; s < 2; s++)
+        {
+          const TanhPerTableFileSegment &segment = *segments[s];
+          if (entry.row > 7 || segment.size == 0 || segment.offset < samples
+              || segment.offset % sizeof (double) != 0
+              || segment.offset > file->m_bytes
+              || segment.size > (file->m_bytes - segment.offset) / sizeof (double)
+              || !std::isfinite (segment.firstDb)
+              || !(segment.inverseStep > 0 && std::isfinite (segment.inverseStep)))
+            {
+              error = fileName + ": table out of bounds, or with an invalid grid";
+              delete file;
+              return 0;
+            }
+        }
+      TanhPerLutSegment low (entry.low.firstDb, entry.low.inverseStep,
+                             reinterpret_cast<const double *> (file->m_mapping + entry.low.offset),
+                             entry.low.size);
+      TanhPerLutSegment high (entry.high.firstDb, entry.high.inverseStep,
+                              reinterpret_cast<const double *> (file->m_mapping + entry.high.offset),
+                              entry.high.size);
+      file->m_tables[std::make_pair (uint8_t (entry.row), entry.nbits)] =
+        std::shared_ptr<const TanhPerLut> (new TanhPerLut (entry.switchDb, entry.highAbove != 0, low, high));
+    }
+  NS_LOG_INFO ("attached " << fileName << ": " << header.tables << " tables, "
+                           << file->m_bytes << " bytes");
+  GetOpenFiles ()[fileName] = file;
+  return file;
+}
+
+} //namespace ns3
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TANH_PER_TABLE_FILE_H
+#define TANH_PER_TABLE_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "tanh-per-coefficients.h"
+#include "tanh-per-lut.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * A read-only file of precomputed lookup tables: a coefficient bank (the
+ * arreglo_modelo / arreglo_modelo1 rows) and the TanhPerLut of each row
+ * for a list of chunk sizes, as TanhPerLutCache would build them at the
+ * resolution and tolerance recorded in the file.
+ *
+ * The file is mapped shared and read-only, and the tables refer to its
+ * pages instead of copying them, so every process on a host that attaches
+ * the same file shares one copy of the bank and the tables in the page
+ * cache; a process only pays for the small index it builds over them.
+ * Attaching checks the header, the bank and the index against a checksum
+ * and every table against the bounds of the file, but does not read the
+ * grid points, which would fault in the whole file; Verify checks those
+ * as well.
+ */
+class TanhPerTableFile
+{
+public:
+  /**
+   * Attach a table file, once per process: later calls with the same
+   * name return the same object.
+   *
+   * \param fileName the table file
+   * \param error set to the reason if the file cannot be attached
+   *
+   * \return the tables, which live for the whole program, or 0 on error
+   */
+  static const TanhPerTableFile * Open (const std::string &fileName, std::string &error);
+  /**
+   * Build the tables of every coefficient row for the given chunk sizes,
+   * check them against the curves, and write them with the bank to a
+   * table file.  The file is written to a temporary name that is then
+   * renamed, so processes attaching it meanwhile never see half a file.
+   *
+   * \param fileName the table file
+   * \param coefficients the bank
+   * \param sizes the chunk sizes (bits) to tabulate
+   * \param stepDb the largest grid spacing (dB) of the tables
+   * \param tolerance the largest absolute error allowed against the curves
+   * \param error set to the reason if the file cannot be written
+   *
+   * \return true if the file was written
+   */
+  static bool Write (const std::string &fileName, const TanhPerCoefficientSet &coefficients,
+                     const std::vector<uint32_t> &sizes, double stepDb, double tolerance,
+                     std::string &error);
+
+  ~TanhPerTableFile ();
+
+  /**
+   * \return the bank, in the mapped file
+   */
+  const TanhPerCoefficientSet & GetCoefficients (void) const;
+  /**
+   * \return the largest grid spacing (dB) the tables were built with
+   */
+  double GetResolution (void) const;
+  /**
+   * \return the largest absolute error the tables were built for
+   */
+  double GetMaxError (void) const;
+  /**
+   * \return the number of (row, nbits) tables in the file
+   */
+  uint32_t GetSize (void) const;
+  /**
+   * \return the size of the mapped file (bytes)
+   */
+  uint64_t GetMappedBytes (void) const;
+  /**
+   * \param row the coefficient row (0..7)
+   * \param nbits the number of bits in the chunk
+   *
+   * \return the tables of the given row for nbits bits, or 0 if the file
+   *         has none
+   */
+  std::shared_ptr<const TanhPerLut> Find (uint8_t row, uint32_t nbits) const;
+  /**
+   * Check the grid points against their checksum, reading the whole file.
+   *
+   * \return true if they match
+   */
+  bool Verify (void) const;
+
+private:
+  TanhPerTableFile ();
+  TanhPerTableFile (const TanhPerTableFile &);
+  TanhPerTableFile & operator= (const TanhPerTableFile &);
+
+  /// Tables by (row, nbits)
+  typedef std::map<std::pair<uint8_t, uint32_t>, std::shared_ptr<const TanhPerLut> > TableMap;
+
+  const char *m_mapping;                       //!< the mapped file
+  size_t m_bytes;                              //!< size of m_mapping
+  const TanhPerCoefficientSet *m_coefficients; //!< the bank, in m_mapping
+  double m_stepDb;                             //!< largest grid spacing (dB)
+  double m_tolerance;                          //!< largest absolute error allowed
+  TableMap m_tables;                           //!< views of the tables in m_mapping
+};
+
+inline std::shared_ptr<const TanhPerLut>
+TanhPerTableFile::Find (uint8_t row, uint32_t nbits) const
+{
+  TableMap::const_iterator it = m_tables.find (std::make_pair (row, nbits));
+  return it != m_tables.end () ? it->second : std::shared_ptr<const TanhPerLut> ();
+}
+
+} //namespace ns3
+
+#endif /* TANH_PER_TABLE_FILE_H */
@@ -0,0 +1,282 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/ofdm-convolutional-code.h"
+#include "ns3/ofdm-link-simulator.h"
+#include "ns3/ofdm-viterbi-simd.h"
+
+using namespace ns3;
+
+/**
+ * \return the 20 MHz OFDM modes, from 6 to 54 Mbps
+ */
+static std::vector<WifiMode>
+GetOfdmModes (void)
+{
+  std::vector<WifiMode> modes;
+  modes.push_back (WifiPhy::GetOfdmRate6Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate9Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate12Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate18Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate24Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate36Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate48Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate54Mbps ());
+  return modes;
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief The OFDM link simulator, its code and its random streams
+ */
+class OfdmLinkSimulatorTest : public TestCase
+{
+public:
+  OfdmLinkSimulatorTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+OfdmLinkSimulatorTest::OfdmLinkSimulatorTest ()
+  : TestCase ("The OFDM link simulator decodes clean packets and is reproducible on any number of threads")
+{
+}
+
+void
+OfdmLinkSimulatorTest::DoRun (void)
+{
+  // Philox4x32-10 known answer (Random123 kat_vectors, zero key and counter)
+  OfdmLinkRng zero (0, 0);
+  uint32_t known[] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (zero.GetInteger (), known[i], "Philox output " << i);
+    }
+
+  // noise-free soft bits decode to the message at every code rate
+  const uint32_t nbits = 6 * 200;
+  WifiCodeRate rates[] = { WIFI_CODE_RATE_1_2, WIFI_CODE_RATE_2_3, WIFI_CODE_RATE_3_4 };
+  size_t sentBits[] = { 2 * nbits, 3 * nbits / 2, 4 * nbits / 3 };
+  OfdmConvolutionalCode code;
+  OfdmLinkRng rng (1, 2);
+  std::vector<uint8_t> bits (nbits, 0);
+  for (uint32_t i = 0; i < nbits - 6; i++)
+    {
+      bits[i] = rng.GetInteger () & 1;
+    }
+  std::vector<uint8_t> coded (2 * nbits);
+  OfdmConvolutionalCode::Encode (&bits[0], nbits, &coded[0]);
+  for (uint32_t r = 0; r < 3; r++)
+    {
+      std::vector<uint8_t> sent (OfdmConvolutionalCode::GetPuncturedSize (nbits, rates[r]));
+      OfdmConvolutionalCode::Puncture (&coded[0], nbits, rates[r], &sent[0]);
+      std::vector<float> soft (sent.size ());
+      for (uint32_t i = 0; i < sent.size (); i++)
+        {
+          soft[i] = sent[i] ? -1 : 1;
+        }
+      std::vector<float> depunctured (2 * nbits);
+      std::vector<uint8_t> decoded (nbits);
+      OfdmConvolutionalCode::Depuncture (&soft[0], nbits, rates[r], &depunctured[0]);
+      code.Decode (&depunctured[0], nbits, &decoded[0]);
+      NS_TEST_ASSERT_MSG_EQ (sent.size (), sentBits[r], "punctured size at rate " << rates[r]);
+      NS_TEST_ASSERT_MSG_EQ ((decoded == bits), true, "decoded message at rate " << rates[r]);
+    }
+
+  // every packet survives a clean channel and none a drowned one
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  for (uint32_t i = 0; i < modes.size (); i++)
+    {
+      OfdmLinkSimulator simulator (modes[i]);
+      for (uint32_t packet = 0; packet < 4; packet++)
+        {
+          OfdmLinkRng stream (i, packet);
+          NS_TEST_ASSERT_MSG_EQ (simulator.SimulatePacket (8 * 100, 1e4, stream), false,
+                                 modes[i].GetUniqueName () << " at 40 dB");
+          NS_TEST_ASSERT_MSG_EQ (simulator.SimulatePacket (8 * 100, 0.1, stream), true,
+                                 modes[i].GetUniqueName () << " at -10 dB");
+        }
+    }
+
+  // the counts of a run do not depend on the number of threads
+  std::vector<OfdmLinkPoint> points;
+  for (uint32_t i = 0; i < modes.size (); i += 7)
+    {
+      for (double db = (i == 0 ? -1 : 16); db <= (i == 0 ? 2 : 19); db += 1)
+        {
+          OfdmLinkPoint point;
+          point.mode = modes[i];
+          point.nbits = 8 * 50;
+          point.snrDb = db;
+          points.push_back (point);
+        }
+    }
+  std::vector<OfdmLinkPoint> single = points;
+  OfdmLinkSimulator::Run (single, 3, 10, 200, 7, 1);
+  for (uint32_t threads = 2; threads <= 4; threads += 2)
+    {
+      std::vector<OfdmLinkPoint> parallel = points;
+      OfdmLinkSimulator::Run (parallel, 3, 10, 200, 7, threads);
+      for (uint32_t i = 0; i < points.size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (parallel[i].packets, single[i].packets, "point " << i << ", " << threads << " threads");
+          NS_TEST_ASSERT_MSG_EQ (parallel[i].errors, single[i].errors, "point " << i << ", " << threads << " threads");
+        }
+    }
+  for (uint32_t i = 0; i < points.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((single[i].errors >= 10 || single[i].packets == 200), true, "point " << i << " complete");
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (single[i].errors, single[i].packets, "point " << i);
+    }
+  NS_TEST_ASSERT_MSG_GT (single.front ().errors, single.back ().errors, "PER falls with the SNR");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief The Viterbi kernels against each other and the reference decoder
+ */
+class OfdmViterbiKernelTest : public TestCase
+{
+public:
+  OfdmViterbiKernelTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+OfdmViterbiKernelTest::OfdmViterbiKernelTest ()
+  : TestCase ("The SIMD Viterbi kernels decide as the scalar kernel and decode as the reference decoder")
+{
+}
+
+void
+OfdmViterbiKernelTest::DoRun (void)
+{
+  const uint32_t nbits = 6 * 5 * 40;
+  const OfdmViterbiKernels *scalar = GetOfdmViterbiKernels ("scalar");
+  NS_TEST_ASSERT_MSG_NE (scalar, 0, "the scalar kernel is always available");
+  std::vector<const OfdmViterbiKernels *> kernels;
+  const char *names[] = { "ssse3", "avx2" };
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      if (GetOfdmViterbiKernels (names[i]) != 0)
+        {
+          kernels.push_back (GetOfdmViterbiKernels (names[i]));
+        }
+    }
+  NS_TEST_ASSERT_MSG_EQ (GetOfdmViterbiKernels ("mmx"), 0, "unknown kernel");
+
+  // the same decisions for any soft bits, from the weakest to the
+  // strongest and with runs of erasures
+  std::vector<int16_t> soft (2 * nbits);
+  std::vector<uint64_t> expected (nbits);
+  std::vector<uint64_t> decisions (nbits);
+  for (uint32_t word = 0; word < 40; word++)
+    {
+      OfdmLinkRng rng (7, word);
+      int32_t range = 1 + (word % 4 == 3 ? OFDM_VITERBI_MAX_SOFT : word * 3 % OFDM_VITERBI_MAX_SOFT);
+      for (uint32_t i = 0; i < 2 * nbits; i++)
+        {
+          soft[i] = (word % 5 == 4 && i % 4 > 1) ? 0 : int16_t (int32_t (rng.GetInteger () % (2 * range + 1)) - range);
+        }
+      scalar->decide (&soft[0], nbits, &expected[0]);
+      for (uint32_t k = 0; k < kernels.size (); k++)
+        {
+          kernels[k]->decide (&soft[0], nbits, &decisions[0]);
+          NS_TEST_ASSERT_MSG_EQ ((decisions == expected), true, kernels[k]->name << ", word " << word);
+        }
+    }
+
+  // noise-free code words decode exactly at every rate, and noisy ones as
+  // the floating point decoder does, up to the quantisation
+  WifiCodeRate rates[] = { WIFI_CODE_RATE_1_2, WIFI_CODE_RATE_2_3, WIFI_CODE_RATE_3_4, WIFI_CODE_RATE_5_6 };
+  double sigma[] = { 0.8, 0.65, 0.55, 0.5 };
+  std::vector<uint8_t> bits (nbits, 0);
+  std::vector<uint8_t> coded (2 * nbits);
+  std::vector<float> depunctured (2 * nbits);
+  std::vector<uint8_t> decoded (nbits);
+  std::vector<uint8_t> reference (nbits);
+  OfdmConvolutionalCode code;
+  for (uint32_t r = 0; r < 4; r++)
+    {
+      uint64_t errors = 0;
+      uint64_t referenceErrors = 0;
+      for (uint32_t word = 0; word < 20; word++)
+        {
+          OfdmLinkRng rng (r, word);
+          for (uint32_t i = 0; i + 6 < nbits; i++)
+            {
+              bits[i] = rng.GetInteger () & 1;
+            }
+          OfdmConvolutionalCode::Encode (&bits[0], nbits, &coded[0]);
+          std::vector<uint8_t> sent (OfdmConvolutionalCode::GetPuncturedSize (nbits, rates[r]));
+          OfdmConvolutionalCode::Puncture (&coded[0], nbits, rates[r], &sent[0]);
+          std::vector<float> received (sent.size ());
+          for (uint32_t i = 0; i < sent.size (); i++)
+            {
+              double x;
+              double y;
+              rng.GetNormals (x, y);
+              double noise = (word == 0) ? 0 : sigma[r] * x;
+              received[i] = float (2 * ((sent[i] ? -1 : 1) + noise) / (sigma[r] * sigma[r]));
+            }
+          OfdmConvolutionalCode::Depuncture (&received[0], nbits, rates[r], &depunctured[0]);
+          code.Decode (&depunctured[0], nbits, &decoded[0]);
+          code.DecodeReference (&depunctured[0], nbits, &reference[0]);
+          if (word == 0)
+            {
+              NS_TEST_ASSERT_MSG_EQ ((decoded == bits), true, "noise-free word at rate " << rates[r]);
+              NS_TEST_ASSERT_MSG_EQ ((reference == bits), true, "noise-free word at rate " << rates[r]);
+            }
+          for (uint32_t i = 0; i < nbits; i++)
+            {
+              errors += decoded[i] != bits[i];
+              referenceErrors += reference[i] != bits[i];
+            }
+        }
+      NS_TEST_ASSERT_MSG_GT (referenceErrors, 0, "the noise causes errors at rate " << rates[r]);
+      NS_TEST_ASSERT_MSG_LT (errors, 2 * referenceErrors + 20, code.GetKernelName () << " at rate " << rates[r]);
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief OFDM link simulator test suite
+ */
+class OfdmLinkSimulatorTestSuite : public TestSuite
+{
+public:
+  OfdmLinkSimulatorTestSuite ();
+};
+
+OfdmLinkSimulatorTestSuite::OfdmLinkSimulatorTestSuite ()
+  : TestSuite ("ofdm-link-simulator", UNIT)
+{
+  AddTestCase (new OfdmLinkSimulatorTest, TestCase::QUICK);
+  AddTestCase (new OfdmViterbiKernelTest, TestCase::QUICK);
+}
+
+static OfdmLinkSimulatorTestSuite ofdmLinkSimulatorTestSuite; ///< the test suite
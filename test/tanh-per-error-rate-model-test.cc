@@ -0,0 +1,1551 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <float.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/dsss-error-rate-model.h"
+#include "ns3/error-rate-model2.h"
+#include "ns3/error-rate-model5.h"
+#include "ns3/ofdm-fec-bound.h"
+#include "ns3/tanh-per-error-rate-model.h"
+#include "ns3/tanh-per-coefficients.h"
+#include "ns3/tanh-per-coefficient-file.h"
+#include "ns3/tanh-per-curve-cache.h"
+#include "ns3/tanh-per-lut.h"
+#include "ns3/tanh-per-mode-table.h"
+#include "ns3/tanh-per-model-store.h"
+#include "ns3/tanh-per-simd.h"
+#include "ns3/tanh-per-static-curves.h"
+#include "ns3/tanh-per-table-file.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("TanhPerErrorRateModelTest");
+
+/**
+ * \return one 20 MHz OFDM mode per coefficient row, in row order
+ */
+static std::vector<WifiMode>
+GetOfdmModes (void)
+{
+  std::vector<WifiMode> modes;
+  modes.push_back (WifiPhy::GetOfdmRate6Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate9Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate12Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate18Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate24Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate36Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate48Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate54Mbps ());
+  return modes;
+}
+
+/**
+ * The success rate exactly as ErrorRateModel2..9 computed it before
+ * they shared an engine: evaluate arreglo_modelo, and switch to
+ * arreglo_modelo1 once -10 log10 (PER) exceeds 10.
+ */
+static double
+GetReferenceSuccessRate (const TanhPerCoefficientSet &set, uint8_t row, double snr, uint32_t nbits)
+{
+  snr = 10 * std::log10 (snr);
+  const TanhPerCoefficients *c = &set.low[row];
+  double a_R = c->c1 * exp (c->d1 * nbits) + c->c2 * exp (c->d2 * nbits);
+  double b_R = c->c3 * exp (c->d3 * nbits) + c->c4 * exp (c->d4 * nbits);
+  double PER_paper = (1 - tanh (a_R - b_R * (snr))) / 2;
+  double PER_paper_log = -10 * log10 (PER_paper);
+  if (PER_paper_log > 10)
+    {
+      c = &set.high[row];
+      a_R = c->c1 * exp (c->d1 * nbits) + c->c2 * exp (c->d2 * nbits);
+      b_R = c->c3 * exp (c->d3 * nbits) + c->c4 * exp (c->d4 * nbits);
+      PER_paper = (1 - tanh (a_R - b_R * (snr))) / 2;
+    }
+  return 1 - PER_paper;
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief GetChunkSuccessRate of every model, row and regime against the
+ *        original per-model code
+ */
+class TanhPerReferenceTest : public TestCase
+{
+public:
+  TanhPerReferenceTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerReferenceTest::TanhPerReferenceTest ()
+  : TestCase ("GetChunkSuccessRate matches the original ErrorRateModel2..9 code")
+{
+}
+
+void
+TanhPerReferenceTest::DoRun (void)
+{
+  const uint32_t sizes[] = { 8, 8 * 50, 8 * 1500, 8 * 3000 };
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  WifiTxVector txVector;
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+      erm->SetAttribute ("CoefficientSet", UintegerValue (model));
+      const TanhPerCoefficientSet &set = *GetTanhPerCoefficientSet (model);
+      for (uint8_t row = 0; row < 8; row++)
+        {
+          for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+            {
+              for (double db = -10; db <= 40; db += 0.1)
+                {
+                  double snr = std::pow (10.0, db / 10);
+                  double expected = GetReferenceSuccessRate (set, row, snr, sizes[s]);
+                  NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (modes[row], txVector, snr, sizes[s]), expected,
+                                         "model " << model << " row " << +row << " nbits " << sizes[s]
+                                                  << " snr " << db << " dB");
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief GetChunkSuccessRateBatch against GetChunkSuccessRate, for OFDM
+ *        and DSSS modes and mixed chunk sizes
+ */
+class TanhPerBatchTest : public TestCase
+{
+public:
+  TanhPerBatchTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerBatchTest::TanhPerBatchTest ()
+  : TestCase ("GetChunkSuccessRateBatch matches GetChunkSuccessRate")
+{
+}
+
+void
+TanhPerBatchTest::DoRun (void)
+{
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  modes.push_back (WifiPhy::GetDsssRate1Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate2Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate5_5Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate11Mbps ());
+  modes.push_back (WifiPhy::GetHtMcs7 ());
+
+  // more chunks than one batch block, with runs of equal and changing
+  // sizes; SNRs of 0 to 30 dB, as the DSSS formulas take the dB value
+  const size_t n = 300;
+  std::vector<double> snr (n);
+  std::vector<uint32_t> nbits (n);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < n; i++)
+    {
+      state = state * 1103515245 + 12345;
+      snr[i] = std::pow (10.0, ((state >> 8) % 3000) / 1000.0);
+      nbits[i] = (i % 7 < 4) ? 12000 : 8 * (1 + (state >> 16) % 3000);
+    }
+
+  WifiTxVector txVector;
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  std::vector<double> successRate (n);
+  for (size_t m = 0; m < modes.size (); m++)
+    {
+      erm->GetChunkSuccessRateBatch (modes[m], txVector, &snr[0], &nbits[0], &successRate[0], n);
+      for (size_t i = 0; i < n; i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (successRate[i], erm->GetChunkSuccessRate (modes[m], txVector, snr[i], nbits[i]),
+                                 "mode " << modes[m] << " chunk " << i);
+        }
+    }
+
+  // the DSSS formulas have always been handed the SNR in dB
+  double dsss = erm->GetChunkSuccessRate (WifiPhy::GetDsssRate11Mbps (), txVector, 4.0, 1000);
+  NS_TEST_ASSERT_MSG_EQ (dsss, DsssErrorRateModel::GetDsssDqpskCck11SuccessRate (10 * std::log10 (4.0), 1000),
+                         "DSSS chunks use the CCK 11 Mbps formula");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief ErrorRateModelN TypeIds, the CoefficientSet attribute and the
+ *        curve cache counters
+ */
+class TanhPerTypeIdTest : public TestCase
+{
+public:
+  TanhPerTypeIdTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerTypeIdTest::TanhPerTypeIdTest ()
+  : TestCase ("ErrorRateModelN selects coefficient set N")
+{
+}
+
+void
+TanhPerTypeIdTest::DoRun (void)
+{
+  WifiMode mode = WifiPhy::GetOfdmRate12MbpsBW10MHz ();
+  WifiTxVector txVector;
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      std::ostringstream name;
+      name << "ns3::ErrorRateModel" << model;
+      ObjectFactory factory;
+      factory.SetTypeId (name.str ());
+      Ptr<TanhPerErrorRateModel> byType = factory.Create<TanhPerErrorRateModel> ();
+      NS_TEST_ASSERT_MSG_EQ ((byType != Ptr<TanhPerErrorRateModel> ()), true, name.str () << " is a TanhPerErrorRateModel");
+
+      factory.SetTypeId ("ns3::TanhPerErrorRateModel");
+      factory.Set ("CoefficientSet", UintegerValue (model));
+      Ptr<TanhPerErrorRateModel> byAttribute = factory.Create<TanhPerErrorRateModel> ();
+      UintegerValue set;
+      byAttribute->GetAttribute ("CoefficientSet", set);
+      NS_TEST_ASSERT_MSG_EQ (set.Get (), model, "CoefficientSet reads back");
+
+      for (double db = 0; db <= 20; db += 0.5)
+        {
+          double snr = std::pow (10.0, db / 10);
+          NS_TEST_ASSERT_MSG_EQ (byType->GetChunkSuccessRate (mode, txVector, snr, 8000),
+                                 byAttribute->GetChunkSuccessRate (mode, txVector, snr, 8000),
+                                 name.str () << " at " << db << " dB");
+        }
+    }
+
+  Ptr<TanhPerErrorRateModel> erm = CreateObject<ErrorRateModel2> ();
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      erm->GetChunkSuccessRate (mode, txVector, 10.0, (i % 2) ? 800 : 1600);
+    }
+  UintegerValue hits, misses;
+  erm->GetAttribute ("CurveCacheHits", hits);
+  erm->GetAttribute ("CurveCacheMisses", misses);
+  NS_TEST_ASSERT_MSG_EQ (misses.Get (), 2, "one miss per chunk size");
+  NS_TEST_ASSERT_MSG_EQ (hits.Get (), 8, "every other lookup is a hit");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Mode to coefficient row dispatch
+ */
+class TanhPerModeTableTest : public TestCase
+{
+public:
+  TanhPerModeTableTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerModeTableTest::TanhPerModeTableTest ()
+  : TestCase ("WifiModes map to the right coefficient row or DSSS handler")
+{
+}
+
+void
+TanhPerModeTableTest::DoRun (void)
+{
+  TanhPerModeTable table;
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  for (uint8_t row = 0; row < 8; row++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (+table.Lookup (modes[row]), +row, modes[row]);
+    }
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetErpOfdmRate54Mbps ()), 7, "ERP-OFDM");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetOfdmRate27MbpsBW10MHz ()), 7, "10 MHz OFDM");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetOfdmRate1_5MbpsBW5MHz ()), 0, "5 MHz OFDM");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetHtMcs5 ()), 6, "HT 64-QAM 2/3");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetVhtMcs7 ()), 7, "VHT 64-QAM 5/6 uses the 3/4 row");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetVhtMcs8 ()), +TanhPerModeTable::UNSUPPORTED, "256-QAM");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetDsssRate1Mbps ()), +TanhPerModeTable::DSSS_DBPSK, "1 Mbps");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetDsssRate2Mbps ()), +TanhPerModeTable::DSSS_DQPSK, "2 Mbps");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetDsssRate5_5Mbps ()), +TanhPerModeTable::DSSS_CCK_5_5, "5.5 Mbps");
+  NS_TEST_ASSERT_MSG_EQ (+table.Lookup (WifiPhy::GetDsssRate11Mbps ()), +TanhPerModeTable::DSSS_CCK_11, "11 Mbps");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Accuracy of the polynomial kernels against libm
+ */
+class TanhPerKernelTest : public TestCase
+{
+public:
+  TanhPerKernelTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerKernelTest::TanhPerKernelTest ()
+  : TestCase ("Polynomial kernels are bit-identical to each other and within 1e-13 of libm")
+{
+}
+
+void
+TanhPerKernelTest::DoRun (void)
+{
+  const char *names[] = { "scalar", "avx2", "avx512" };
+  const TanhPerKernels &scalar = *GetTanhPerKernels ("scalar");
+  for (uint32_t i = 0; i < sizeof (names) / sizeof (names[0]); i++)
+    {
+      const TanhPerKernels *kernels = GetTanhPerKernels (names[i]);
+      if (kernels == 0)
+        {
+          // not supported by this CPU
+          continue;
+        }
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (CheckTanhPerKernels (*kernels, GetTanhPerLibmKernels ()), 1e-13, names[i]);
+      NS_TEST_ASSERT_MSG_EQ (CheckTanhPerKernels (*kernels, scalar), 0, names[i]);
+    }
+
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  erm->SetAttribute ("VectorKernel", BooleanValue (true));
+  BooleanValue vector;
+  erm->GetAttribute ("VectorKernel", vector);
+  NS_TEST_ASSERT_MSG_EQ (vector.Get (), true, "VectorKernel reads back");
+  Ptr<ErrorRateModel2> reference = CreateObject<ErrorRateModel2> ();
+  WifiTxVector txVector;
+  WifiMode mode = WifiPhy::GetOfdmRate24Mbps ();
+  for (double db = -5; db <= 30; db += 0.25)
+    {
+      double snr = std::pow (10.0, db / 10);
+      double expected = reference->GetChunkSuccessRate (mode, txVector, snr, 12000);
+      // single chunks keep the libm kernels, batches use the vector ones
+      NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (mode, txVector, snr, 12000), expected,
+                             "single chunk at " << db << " dB");
+      double snrs[16];
+      uint32_t nbits[16];
+      double successRate[16];
+      std::fill (snrs, snrs + 16, snr);
+      std::fill (nbits, nbits + 16, 12000);
+      erm->GetChunkSuccessRateBatch (mode, txVector, snrs, nbits, successRate, 16);
+      for (uint32_t i = 0; i < 16; i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ_TOL (successRate[i], expected, 1e-13, "vector kernels at " << db << " dB");
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Curves specialised on a bank match the generic computation
+ */
+class TanhPerStaticCurvesTest : public TestCase
+{
+public:
+  TanhPerStaticCurvesTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerStaticCurvesTest::TanhPerStaticCurvesTest ()
+  : TestCase ("Curves specialised on the bank of ErrorRateModelN are bit-identical to the generic ones")
+{
+}
+
+void
+TanhPerStaticCurvesTest::DoRun (void)
+{
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      const TanhPerCoefficientSet &bank = *GetTanhPerCoefficientSet (model);
+      TanhPerCurveFunction compute = GetTanhPerStaticCurveFunction (bank);
+      NS_TEST_ASSERT_MSG_NE (compute, 0, "model " << model);
+      if (compute == 0)
+        {
+          continue;
+        }
+      for (uint8_t row = 0; row < 8; row++)
+        {
+          for (uint32_t nbits = 8; nbits <= 96000; nbits = nbits * 3 / 2 + 8)
+            {
+              TanhPerCurve expected;
+              TanhPerCurveCache::ComputeParameters (bank.low[row], nbits, expected.aLow, expected.bLow);
+              TanhPerCurveCache::ComputeParameters (bank.high[row], nbits, expected.aHigh, expected.bHigh);
+              TanhPerCurveCache::SetRegimeSwitch (expected);
+              TanhPerCurve curve;
+              compute (row, nbits, curve);
+              NS_TEST_ASSERT_MSG_EQ (curve.aLow, expected.aLow, "model " << model << " row " << +row << " nbits " << nbits);
+              NS_TEST_ASSERT_MSG_EQ (curve.bLow, expected.bLow, "model " << model << " row " << +row << " nbits " << nbits);
+              NS_TEST_ASSERT_MSG_EQ (curve.aHigh, expected.aHigh, "model " << model << " row " << +row << " nbits " << nbits);
+              NS_TEST_ASSERT_MSG_EQ (curve.bHigh, expected.bHigh, "model " << model << " row " << +row << " nbits " << nbits);
+              NS_TEST_ASSERT_MSG_EQ (curve.switchDb, expected.switchDb, "model " << model << " row " << +row << " nbits " << nbits);
+              NS_TEST_ASSERT_MSG_EQ (curve.highAbove, expected.highAbove, "model " << model << " row " << +row << " nbits " << nbits);
+            }
+        }
+    }
+
+  // a copy of a bank is not specialised on, and is still served
+  TanhPerCoefficientSet copy = *GetTanhPerCoefficientSet (5);
+  NS_TEST_ASSERT_MSG_EQ (GetTanhPerStaticCurveFunction (copy), 0, "copy of a bank");
+
+  Ptr<ErrorRateModel5> erm = CreateObject<ErrorRateModel5> ();
+  WifiTxVector txVector;
+  WifiMode mode = WifiPhy::GetOfdmRate36Mbps ();
+  uint8_t row = TanhPerModeTable::Classify (mode);
+  for (double db = -5; db <= 30; db += 0.25)
+    {
+      double snr = std::pow (10.0, db / 10);
+      NS_TEST_ASSERT_MSG_EQ_TOL (TanhPerStaticCurves<5>::GetSuccessRate (row, db, 1500 * 8),
+                                 erm->GetChunkSuccessRate (mode, txVector, snr, 1500 * 8), 1e-14,
+                                 "uncached success rate at " << db << " dB");
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Lookup tables stay within LookupTableMaxError of the curves
+ */
+class TanhPerLookupTableTest : public TestCase
+{
+public:
+  TanhPerLookupTableTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerLookupTableTest::TanhPerLookupTableTest ()
+  : TestCase ("Lookup tables are within their maximum error of the analytic curves")
+{
+}
+
+void
+TanhPerLookupTableTest::DoRun (void)
+{
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  WifiTxVector txVector;
+  // a coarse grid with a tight bound must be refined to meet it
+  const double resolutions[] = { 0.01, 0.1, 1 };
+  const double maxErrors[] = { 1e-6, 1e-4, 1e-8 };
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      Ptr<TanhPerErrorRateModel> reference = CreateObject<TanhPerErrorRateModel> ();
+      reference->SetCoefficientSet (model);
+      for (uint32_t r = 0; r < sizeof (resolutions) / sizeof (resolutions[0]); r++)
+        {
+          Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+          erm->SetCoefficientSet (model);
+          erm->SetAttribute ("LookupTableResolution", DoubleValue (resolutions[r]));
+          erm->SetAttribute ("LookupTableMaxError", DoubleValue (maxErrors[r]));
+          erm->SetAttribute ("LookupTable", BooleanValue (true));
+          for (uint8_t row = 0; row < modes.size (); row++)
+            {
+              for (double db = -10.0137; db <= 40; db += 0.0731)
+                {
+                  double snr = std::pow (10.0, db / 10);
+                  uint32_t nbits = (row % 2) ? 8 * 1500 : 8 * 40;
+                  NS_TEST_ASSERT_MSG_EQ_TOL (erm->GetChunkSuccessRate (modes[row], txVector, snr, nbits),
+                                             reference->GetChunkSuccessRate (modes[row], txVector, snr, nbits),
+                                             maxErrors[r], "model " << model << " row " << +row
+                                             << " at " << db << " dB, " << resolutions[r] << " dB grid");
+                }
+            }
+        }
+    }
+
+  TanhPerCurve curve = { 10, 0.5, 20, 1, 12.4, true };
+  NS_TEST_ASSERT_MSG_EQ_TOL (TanhPerLut::GetErrorBound (0.5, 0.1), 0.25 * 0.01 / (12 * std::sqrt (3.0)),
+                             1e-18, "error bound");
+  TanhPerLut lut (curve, 0.01, 1e-6);
+  NS_TEST_ASSERT_MSG_EQ_TOL (lut.GetSuccessRate (-1000), 1.0, 1e-6, "saturated below the grid");
+  NS_TEST_ASSERT_MSG_EQ_TOL (lut.GetSuccessRate (12.4), (1 + std::tanh (10 - 0.5 * 12.4)) / 2, 1e-6,
+                             "switchDb belongs to the arreglo_modelo regime");
+  NS_TEST_ASSERT_MSG_EQ_TOL (lut.GetSuccessRate (12.5), (1 + std::tanh (20 - 12.5)) / 2, 1e-6,
+                             "arreglo_modelo1 regime above switchDb");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Lookup tables are built on first use and evicted least recently
+ *        used first
+ */
+class TanhPerLookupTableCacheTest : public TestCase
+{
+public:
+  TanhPerLookupTableCacheTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerLookupTableCacheTest::TanhPerLookupTableCacheTest ()
+  : TestCase ("Lookup tables are built lazily and bounded by LookupTableMaxBytes")
+{
+}
+
+void
+TanhPerLookupTableCacheTest::DoRun (void)
+{
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  erm->SetAttribute ("LookupTable", BooleanValue (true));
+  UintegerValue bytes;
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_EQ (bytes.Get (), 0, "the self-test keeps no table");
+  WifiTxVector txVector;
+  erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8000);
+  erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 20, 8000);
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_GT (bytes.Get (), 0, "one table built on first use");
+  // a new cap switches to the tables shared by models with that cap
+  erm->SetAttribute ("LookupTableMaxBytes", UintegerValue (1));
+  erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8000);
+  erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate54Mbps (), txVector, 100, 8000);
+  UintegerValue evictions;
+  erm->GetAttribute ("LookupTableEvictions", evictions);
+  NS_TEST_ASSERT_MSG_EQ (evictions.Get (), 1, "a cap below one table keeps only the latest");
+  erm->Dispose ();
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_EQ (bytes.Get (), 0, "Dispose drops the tables");
+
+  TanhPerCurveCache curves (g_errorRateModel2Coefficients);
+  uint64_t a = TanhPerLut (curves.Lookup (3, 800), 0.01, 1e-6).GetMemoryBytes ();
+  uint64_t c = TanhPerLut (curves.Lookup (3, 24000), 0.01, 1e-6).GetMemoryBytes ();
+  TanhPerLutCache cache (0.01, 1e-6, a + c);
+  cache.Lookup (3, 800, curves);
+  cache.Lookup (3, 8000, curves);
+  cache.Lookup (3, 800, curves);
+  cache.Lookup (3, 24000, curves);
+  NS_TEST_ASSERT_MSG_EQ (cache.GetEvictions (), 1, "the 8000-bit table was least recently used");
+  NS_TEST_ASSERT_MSG_EQ (cache.GetBytes (), a + c, "the 800 and 24000-bit tables are left");
+  NS_TEST_ASSERT_MSG_GT (cache.GetPeakBytes (), a + c, "the peak includes the evicted table");
+  cache.Lookup (3, 800, curves);
+  NS_TEST_ASSERT_MSG_EQ (cache.GetEvictions (), 1, "the 800-bit table is still resident");
+  NS_TEST_ASSERT_MSG_EQ (cache.GetSize (), 2, "two tables resident");
+
+  // a pair looked up fewer than LookupTableMinUses times is evaluated analytically
+  Ptr<ErrorRateModel2> analytic = CreateObject<ErrorRateModel2> ();
+  erm = CreateObject<ErrorRateModel2> ();
+  erm->SetAttribute ("LookupTableMinUses", UintegerValue (3));
+  erm->SetAttribute ("LookupTable", BooleanValue (true));
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8008),
+                             analytic->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8008),
+                             "a pair without a table takes the analytic path");
+    }
+  // a batch looks each run of equal chunk sizes up once
+  std::vector<double> snrs (100);
+  std::vector<uint32_t> sizes (100, 8016);
+  std::vector<double> batch (100);
+  for (uint32_t i = 0; i < snrs.size (); i++)
+    {
+      snrs[i] = 1 + 0.2 * i;
+    }
+  erm->GetChunkSuccessRateBatch (WifiPhy::GetOfdmRate24Mbps (), txVector, &snrs[0], &sizes[0], &batch[0], batch.size ());
+  for (uint32_t i = 0; i < snrs.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (batch[i], analytic->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, snrs[i], 8016),
+                             "chunk " << i << " of a batch without a table");
+    }
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_EQ (bytes.Get (), 0, "no table before the third lookup");
+  NS_TEST_ASSERT_MSG_EQ_TOL (erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8008),
+                             analytic->GetChunkSuccessRate (WifiPhy::GetOfdmRate24Mbps (), txVector, 10, 8008),
+                             1e-6, "the table agrees with the curve");
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_GT (bytes.Get (), 0, "the third lookup builds the table");
+  erm->Dispose ();
+
+  // the self-test of a new configuration leaves the shared curves alone
+  uint64_t lookups = analytic->GetCurveCacheHits () + analytic->GetCurveCacheMisses ();
+  analytic->SetLookupTableResolution (0.0123);
+  analytic->SetLookupTable (true);
+  NS_TEST_ASSERT_MSG_EQ (analytic->GetCurveCacheHits () + analytic->GetCurveCacheMisses (), lookups,
+                         "no curve lookups from the self-test");
+}
+
+/**
+ * \return the resident set size of the process in bytes, or 0 if it
+ *         cannot be read
+ */
+static uint64_t
+GetResidentBytes (void)
+{
+  std::ifstream statm ("/proc/self/statm");
+  uint64_t size = 0;
+  uint64_t resident = 0;
+  if (!(statm >> size >> resident))
+    {
+      return 0;
+    }
+  return resident * sysconf (_SC_PAGESIZE);
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief GetChunkLogSuccessRate against GetChunkSuccessRate and, where
+ *        the latter runs out of digits, against the asymptotes of the curve
+ */
+class TanhPerLogSuccessTest : public TestCase
+{
+public:
+  TanhPerLogSuccessTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerLogSuccessTest::TanhPerLogSuccessTest ()
+  : TestCase ("GetChunkLogSuccessRate is the log of GetChunkSuccessRate, to full precision")
+{
+}
+
+void
+TanhPerLogSuccessTest::DoRun (void)
+{
+  const uint32_t sizes[] = { 8, 8 * 50, 8 * 1500, 8 * 3000 };
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  WifiTxVector txVector;
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+      erm->SetCoefficientSet (model);
+      TanhPerCurveCache curves (*GetTanhPerCoefficientSet (model));
+      for (uint8_t row = 0; row < 8; row++)
+        {
+          for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+            {
+              const TanhPerCurve &curve = curves.Lookup (row, sizes[s]);
+              for (double db = -30; db <= 60; db += 0.25)
+                {
+                  double snr = std::pow (10.0, db / 10);
+                  double successRate = erm->GetChunkSuccessRate (modes[row], txVector, snr, sizes[s]);
+                  double logSuccessRate = erm->GetChunkLogSuccessRate (modes[row], txVector, snr, sizes[s]);
+                  NS_TEST_ASSERT_MSG_LT_OR_EQ (logSuccessRate, 0, "a log probability");
+                  NS_TEST_ASSERT_MSG_EQ_TOL (std::exp (logSuccessRate), successRate, 1e-14,
+                                             "model " << model << " row " << +row << " nbits " << sizes[s]
+                                                      << " snr " << db << " dB");
+                  // where tanh saturates, the log is known from the asymptotes
+                  double snrDb = 10 * std::log10 (snr);
+                  double x = curve.IsHighRegime (snrDb) ? curve.aHigh - curve.bHigh * snrDb
+                                                        : curve.aLow - curve.bLow * snrDb;
+                  if (x > 20)
+                    {
+                      NS_TEST_ASSERT_MSG_EQ_TOL (logSuccessRate, -std::exp (-2 * x), 1e-14 * std::exp (-2 * x),
+                                                 "success rate within 1e-17 of 1, at " << db << " dB");
+                    }
+                  else if (x < -20)
+                    {
+                      NS_TEST_ASSERT_MSG_EQ_TOL (logSuccessRate, 2 * x, 1e-14 * -x,
+                                                 "success rate below 1e-17, at " << db << " dB");
+                    }
+                }
+            }
+        }
+    }
+
+  // the batch form, OFDM chunks of mixed sizes and DSSS chunks
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  std::vector<WifiMode> batchModes = modes;
+  batchModes.push_back (WifiPhy::GetDsssRate1Mbps ());
+  batchModes.push_back (WifiPhy::GetDsssRate11Mbps ());
+  const size_t n = 200;
+  std::vector<double> snr (n);
+  std::vector<uint32_t> nbits (n);
+  std::vector<double> logSuccessRate (n);
+  for (size_t i = 0; i < n; i++)
+    {
+      snr[i] = std::pow (10.0, (i % 40) / 10.0);
+      nbits[i] = 8 * (1 + (i / 3) % 1500);
+    }
+  for (size_t m = 0; m < batchModes.size (); m++)
+    {
+      erm->GetChunkLogSuccessRateBatch (batchModes[m], txVector, &snr[0], &nbits[0], &logSuccessRate[0], n);
+      for (size_t i = 0; i < n; i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (logSuccessRate[i], erm->GetChunkLogSuccessRate (batchModes[m], txVector, snr[i], nbits[i]),
+                                 "mode " << batchModes[m] << " chunk " << i);
+        }
+    }
+  double dsss = erm->GetChunkSuccessRate (WifiPhy::GetDsssRate11Mbps (), txVector, 4.0, 1000);
+  NS_TEST_ASSERT_MSG_EQ (erm->GetChunkLogSuccessRate (WifiPhy::GetDsssRate11Mbps (), txVector, 4.0, 1000),
+                         std::log (dsss), "DSSS chunks take the log of the success rate");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief GetFrameSuccessRate and GetFrameLogSuccessRate against the
+ *        chunk-by-chunk product
+ */
+class TanhPerFrameTest : public TestCase
+{
+public:
+  TanhPerFrameTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerFrameTest::TanhPerFrameTest ()
+  : TestCase ("GetFrameSuccessRate matches the product of GetChunkSuccessRate")
+{
+}
+
+void
+TanhPerFrameTest::DoRun (void)
+{
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  modes.push_back (WifiPhy::GetDsssRate1Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate11Mbps ());
+  modes.push_back (WifiPhy::GetHtMcs3 ());
+  // more chunks than one batch block; SINRs of 5 to 35 dB keep the
+  // frames of every mode from all failing
+  const size_t chunks[] = { 0, 1, 10, 100, 130 };
+  const size_t n = 130;
+  std::vector<double> snr (n);
+  std::vector<uint32_t> nbits (n);
+  uint32_t state = 4242;
+  for (size_t i = 0; i < n; i++)
+    {
+      state = state * 1103515245 + 12345;
+      snr[i] = std::pow (10.0, 0.5 + ((state >> 8) % 3000) / 1000.0);
+      nbits[i] = 8 * (1 + (state >> 16) % 200);
+    }
+
+  WifiTxVector txVector;
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  for (uint32_t vector = 0; vector < 2; vector++)
+    {
+      erm->SetVectorKernel (vector == 1);
+      for (size_t m = 0; m < modes.size (); m++)
+        {
+          for (size_t c = 0; c < sizeof (chunks) / sizeof (chunks[0]); c++)
+            {
+              double expected = 1;
+              // the absolute rounding error of each chunk is relative to
+              // its success rate in the log domain
+              double tolerance = 1e-14;
+              for (size_t i = 0; i < chunks[c]; i++)
+                {
+                  double successRate = erm->GetChunkSuccessRate (modes[m], txVector, snr[i], nbits[i]);
+                  expected *= successRate;
+                  tolerance += 1e-15 * (1 + 1 / successRate);
+                }
+              double frame = erm->GetFrameSuccessRate (modes[m], txVector, &snr[0], &nbits[0], chunks[c]);
+              if (vector == 0 || chunks[c] < 8)
+                {
+                  NS_TEST_ASSERT_MSG_EQ (frame, expected, "mode " << modes[m] << ", " << chunks[c] << " chunks");
+                }
+              else
+                {
+                  // single chunks keep the libm kernels
+                  NS_TEST_ASSERT_MSG_EQ_TOL (frame, expected, 1e-13 * chunks[c],
+                                             "mode " << modes[m] << ", " << chunks[c] << " chunks");
+                }
+              double logFrame = erm->GetFrameLogSuccessRate (modes[m], txVector, &snr[0], &nbits[0], chunks[c]);
+              if (expected > 1e-300)
+                {
+                  NS_TEST_ASSERT_MSG_EQ_TOL (logFrame, std::log (expected), tolerance,
+                                             "log of mode " << modes[m] << ", " << chunks[c] << " chunks");
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief GetSnrForTargetPer against GetChunkSuccessRate around and above
+ *        the threshold
+ */
+class TanhPerThresholdTest : public TestCase
+{
+public:
+  TanhPerThresholdTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerThresholdTest::TanhPerThresholdTest ()
+  : TestCase ("GetSnrForTargetPer inverts GetChunkSuccessRate")
+{
+}
+
+void
+TanhPerThresholdTest::DoRun (void)
+{
+  const uint32_t sizes[] = { 8, 8 * 50, 8 * 1500, 8 * 3000 };
+  // 0.1 is where the regimes meet; the fits jump there, by more than the
+  // gap between some of these targets
+  const double pers[] = { 0.5, 0.1, 0.05, 1e-2, 1e-3, 1e-6 };
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  WifiTxVector txVector;
+  for (uint32_t model = 2; model <= 9; model++)
+    {
+      Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+      erm->SetCoefficientSet (model);
+      for (uint8_t row = 0; row < 8; row++)
+        {
+          for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+            {
+              for (uint32_t p = 0; p < sizeof (pers) / sizeof (pers[0]); p++)
+                {
+                  double snr = erm->GetSnrForTargetPer (modes[row], sizes[s], pers[p]);
+                  double db = 10 * std::log10 (snr);
+                  NS_TEST_ASSERT_MSG_EQ (std::isfinite (db), true, "every curve reaches " << pers[p]);
+                  // the curves are not monotonic across the regime switch,
+                  // so check that the target is missed just below the
+                  // threshold and met everywhere above it
+                  double below = 1 - erm->GetChunkSuccessRate (modes[row], txVector, std::pow (10.0, (db - 1e-7) / 10), sizes[s]);
+                  NS_TEST_ASSERT_MSG_GT (below, pers[p], "model " << model << " row " << +row << " nbits " << sizes[s]
+                                                                  << ": target missed below " << db << " dB");
+                  for (double above = db + 1e-7; above < db + 30; above += 0.01)
+                    {
+                      double per = 1 - erm->GetChunkSuccessRate (modes[row], txVector, std::pow (10.0, above / 10), sizes[s]);
+                      NS_TEST_ASSERT_MSG_LT_OR_EQ (per, pers[p] * (1 + 1e-9),
+                                                   "model " << model << " row " << +row << " nbits " << sizes[s]
+                                                            << ": target met at " << above << " dB");
+                    }
+                  NS_TEST_ASSERT_MSG_EQ (erm->GetSnrForTargetPer (modes[row], sizes[s], pers[p]), snr,
+                                         "the same threshold again");
+                }
+            }
+        }
+    }
+
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  WifiMode dsss[] = { WifiPhy::GetDsssRate1Mbps (), WifiPhy::GetDsssRate11Mbps () };
+  for (uint32_t d = 0; d < 2; d++)
+    {
+      double snr = erm->GetSnrForTargetPer (dsss[d], 8000, 0.1);
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (1 - erm->GetChunkSuccessRate (dsss[d], txVector, snr, 8000), 0.1,
+                                   "target met at the " << dsss[d] << " threshold");
+      NS_TEST_ASSERT_MSG_GT (1 - erm->GetChunkSuccessRate (dsss[d], txVector, snr * (1 - 1e-6), 8000), 0.1,
+                             "target missed below the " << dsss[d] << " threshold");
+      NS_TEST_ASSERT_MSG_EQ (CreateObject<ErrorRateModel2> ()->GetSnrForTargetPer (dsss[d], 8000, 0.1), snr,
+                             "the " << dsss[d] << " threshold is shared by the models of the bank");
+    }
+  NS_TEST_ASSERT_MSG_EQ (erm->GetSnrForTargetPer (modes[0], 8000, 0), std::numeric_limits<double>::infinity (),
+                         "a PER of 0 is never reached");
+  NS_TEST_ASSERT_MSG_EQ (erm->GetSnrForTargetPer (modes[0], 8000, 1), 0, "a PER of 1 always is");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief SelectBestMode against the argmax of rate times GetChunkSuccessRate
+ */
+class TanhPerBestModeTest : public TestCase
+{
+public:
+  TanhPerBestModeTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerBestModeTest::TanhPerBestModeTest ()
+  : TestCase ("SelectBestMode picks the candidate with the highest goodput")
+{
+}
+
+void
+TanhPerBestModeTest::DoRun (void)
+{
+  std::vector<WifiMode> ofdm = GetOfdmModes ();
+  std::vector<WifiMode> mixed;
+  mixed.push_back (WifiPhy::GetDsssRate1Mbps ());
+  mixed.push_back (WifiPhy::GetDsssRate11Mbps ());
+  mixed.push_back (WifiPhy::GetErpOfdmRate6Mbps ());
+  mixed.push_back (WifiPhy::GetErpOfdmRate24Mbps ());
+  mixed.push_back (WifiPhy::GetHtMcs7 ());
+  mixed.push_back (WifiPhy::GetOfdmRate54Mbps ());
+  const std::vector<WifiMode> *candidates[] = { &ofdm, &mixed };
+
+  WifiTxVector txVector;
+  for (uint32_t config = 0; config < 3; config++)
+    {
+      Ptr<ErrorRateModel5> erm = CreateObject<ErrorRateModel5> ();
+      erm->SetVectorKernel (config == 1);
+      erm->SetLookupTable (config == 2);
+      for (uint32_t c = 0; c < 2; c++)
+        {
+          const std::vector<WifiMode> &modes = *candidates[c];
+          for (double db = -5; db <= 35; db += 0.05)
+            {
+              double snr = std::pow (10.0, db / 10);
+              uint32_t nbits = 8 * (100 + uint32_t (db * 97 + 500) % 1400);
+              size_t best = 0;
+              double bestGoodput = -1;
+              for (size_t i = 0; i < modes.size (); i++)
+                {
+                  double successRate = erm->GetChunkSuccessRate (modes[i], txVector, snr, nbits);
+                  if (!(successRate >= 0 && successRate <= 1))
+                    {
+                      continue;
+                    }
+                  double goodput = modes[i].GetDataRate (20, 800, 1) * successRate;
+                  if (goodput > bestGoodput)
+                    {
+                      best = i;
+                      bestGoodput = goodput;
+                    }
+                }
+              NS_TEST_ASSERT_MSG_EQ (erm->SelectBestMode (snr, nbits, modes, txVector), modes[best],
+                                     "configuration " << config << " at " << db << " dB, " << nbits << " bits");
+            }
+        }
+    }
+  // far below every curve all goodputs are 0, and the first candidate wins
+  Ptr<ErrorRateModel5> erm = CreateObject<ErrorRateModel5> ();
+  NS_TEST_ASSERT_MSG_EQ (erm->SelectBestMode (1e-6, 12000, ofdm, txVector), ofdm[0], "ties go to the first candidate");
+  // below 0 dB the DSSS models give inf (1 Mbps) and NaN (2 Mbps)
+  std::vector<WifiMode> dsss;
+  dsss.push_back (WifiPhy::GetDsssRate1Mbps ());
+  dsss.push_back (WifiPhy::GetDsssRate2Mbps ());
+  dsss.push_back (WifiPhy::GetErpOfdmRate6Mbps ());
+  NS_TEST_ASSERT_MSG_EQ (std::isfinite (erm->GetChunkSuccessRate (dsss[0], txVector, 0.5, 12000)), false,
+                         "the 1 Mbps DSSS success rate at -3 dB is not finite");
+  NS_TEST_ASSERT_MSG_EQ (erm->SelectBestMode (0.5, 12000, dsss, txVector), dsss[2],
+                         "DSSS candidates without a success rate are passed over");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Coefficient sets loaded from CSV and JSON files, and their cache
+ */
+class TanhPerCoefficientFileTest : public TestCase
+{
+public:
+  TanhPerCoefficientFileTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerCoefficientFileTest::TanhPerCoefficientFileTest ()
+  : TestCase ("Coefficient files parse to their bank and are cached in a validated binary file")
+{
+}
+
+void
+TanhPerCoefficientFileTest::DoRun (void)
+{
+  const TanhPerCoefficientSet &bank = *GetTanhPerCoefficientSet (5);
+  const char *tmp = getenv ("TMPDIR");
+  std::ostringstream prefix;
+  prefix << (tmp != 0 ? tmp : "/tmp") << "/tanh-per-coefficients-" << getpid ();
+  std::string csv = prefix.str () + ".csv";
+  std::string json = prefix.str () + ".json";
+  std::string cache = TanhPerCoefficientFile::GetCacheFileName (csv);
+  unlink (cache.c_str ());
+
+  // CSV round trip
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::WriteCsv (csv, bank), true, "write " << csv);
+  TanhPerCoefficientSet parsed;
+  std::string error;
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Parse (csv, parsed, error), true, error);
+  NS_TEST_ASSERT_MSG_EQ (memcmp (&parsed, &bank, sizeof (bank)), 0, "CSV round trip");
+
+  // the first load compiles the cache, later ones reuse the bank
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Map (csv), 0, "no cache yet");
+  const TanhPerCoefficientSet *loaded = TanhPerCoefficientFile::Load (csv, error);
+  NS_TEST_ASSERT_MSG_NE (loaded, 0, error);
+  NS_TEST_ASSERT_MSG_EQ (memcmp (loaded, &bank, sizeof (bank)), 0, "loaded bank");
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Load (csv, error), loaded, "loaded once");
+  const TanhPerCoefficientSet *mapped = TanhPerCoefficientFile::Map (csv);
+  NS_TEST_ASSERT_MSG_NE (mapped, 0, "cache written by the first load");
+  NS_TEST_ASSERT_MSG_EQ (memcmp (mapped, &bank, sizeof (bank)), 0, "mapped bank");
+  TanhPerCoefficientFile::Unmap (mapped);
+
+  // a corrupt cache is rejected, and a rewritten one accepted
+  {
+    std::fstream f (cache.c_str (), std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp (100);
+    f.put ('\x55');
+  }
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Map (csv), 0, "corrupt cache");
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::WriteCache (csv, bank), true, "rewrite cache");
+  mapped = TanhPerCoefficientFile::Map (csv);
+  NS_TEST_ASSERT_MSG_NE (mapped, 0, "rewritten cache");
+  TanhPerCoefficientFile::Unmap (mapped);
+  // as is one left behind by a change of the file
+  {
+    std::ofstream f (csv.c_str (), std::ios::app);
+    f << "# edited\n";
+  }
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Map (csv), 0, "stale cache");
+
+  // a model using the file answers like the model the bank came from
+  Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+  erm->SetAttribute ("CoefficientFile", StringValue (csv));
+  StringValue fileName;
+  erm->GetAttribute ("CoefficientFile", fileName);
+  NS_TEST_ASSERT_MSG_EQ (fileName.Get (), csv, "CoefficientFile reads back");
+  Ptr<ErrorRateModel5> reference = CreateObject<ErrorRateModel5> ();
+  Ptr<ErrorRateModel2> fallback = CreateObject<ErrorRateModel2> ();
+  WifiTxVector txVector;
+  WifiMode mode = WifiPhy::GetOfdmRate24Mbps ();
+  for (double db = -5; db <= 30; db += 0.25)
+    {
+      double snr = std::pow (10.0, db / 10);
+      NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (mode, txVector, snr, 12000),
+                             reference->GetChunkSuccessRate (mode, txVector, snr, 12000),
+                             "file bank at " << db << " dB");
+    }
+  erm->SetAttribute ("CoefficientFile", StringValue (""));
+  NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (mode, txVector, 10, 12000),
+                         fallback->GetChunkSuccessRate (mode, txVector, 10, 12000),
+                         "back to the built-in bank");
+
+  // JSON, with a metadata member
+  {
+    std::ofstream f (json.c_str ());
+    f << std::setprecision (17) << "{\n  \"antenna\": \"2x2\",\n";
+    for (uint32_t table = 0; table < 2; table++)
+      {
+        f << (table == 0 ? "  \"low\": [\n" : ",\n  \"high\": [\n");
+        for (uint32_t row = 0; row < 8; row++)
+          {
+            const TanhPerCoefficients &c = table == 0 ? bank.low[row] : bank.high[row];
+            f << "    [" << c.c1 << ", " << c.c2 << ", " << c.c3 << ", " << c.c4 << ", "
+              << c.d1 << ", " << c.d2 << ", " << c.d3 << ", " << c.d4 << "]" << (row < 7 ? ",\n" : "\n");
+          }
+        f << "  ]";
+      }
+    f << "\n}\n";
+  }
+  memset (&parsed, 0, sizeof (parsed));
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Parse (json, parsed, error), true, error);
+  NS_TEST_ASSERT_MSG_EQ (memcmp (&parsed, &bank, sizeof (bank)), 0, "JSON");
+
+  // malformed files are reported
+  {
+    std::ofstream f (csv.c_str ());
+    f << "low,0,1,2,3,4,5,6,7,8\n";
+  }
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Parse (csv, parsed, error), false, "missing rows");
+  NS_TEST_ASSERT_MSG_NE (error.find ("no low row 1"), std::string::npos, error);
+  {
+    std::ofstream f (csv.c_str ());
+    f << "high,3,1,2,3,x,5,6,7,8\n";
+  }
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Parse (csv, parsed, error), false, "bad number");
+  NS_TEST_ASSERT_MSG_NE (error.find (":1:"), std::string::npos, error);
+  {
+    std::ofstream f (json.c_str ());
+    f << "{ \"low\": [[1, 2]] }";
+  }
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCoefficientFile::Parse (json, parsed, error), false, "short JSON row");
+
+  unlink (csv.c_str ());
+  unlink (json.c_str ());
+  unlink (cache.c_str ());
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Precomputed lookup tables attached from a mapped file
+ */
+class TanhPerTableFileTest : public TestCase
+{
+public:
+  TanhPerTableFileTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerTableFileTest::TanhPerTableFileTest ()
+  : TestCase ("Tables attached from a file match the tables the model builds itself")
+{
+}
+
+void
+TanhPerTableFileTest::DoRun (void)
+{
+  const TanhPerCoefficientSet &bank = *GetTanhPerCoefficientSet (5);
+  const char *tmp = getenv ("TMPDIR");
+  std::ostringstream prefix;
+  prefix << (tmp != 0 ? tmp : "/tmp") << "/tanh-per-tables-" << getpid ();
+  std::string fileName = prefix.str () + ".bin";
+  std::vector<uint32_t> sizes;
+  sizes.push_back (12000);
+  sizes.push_back (400);
+  sizes.push_back (4000);
+  std::string error;
+  NS_TEST_ASSERT_MSG_EQ (TanhPerTableFile::Write (fileName, bank, sizes, 0.01, 1e-6, error), true, error);
+
+  const TanhPerTableFile *tables = TanhPerTableFile::Open (fileName, error);
+  NS_TEST_ASSERT_MSG_NE (tables, 0, error);
+  NS_TEST_ASSERT_MSG_EQ (TanhPerTableFile::Open (fileName, error), tables, "attached once");
+  NS_TEST_ASSERT_MSG_EQ (tables->GetSize (), 24, "8 rows x 3 sizes");
+  NS_TEST_ASSERT_MSG_EQ (memcmp (&tables->GetCoefficients (), &bank, sizeof (bank)), 0, "bank");
+  NS_TEST_ASSERT_MSG_EQ (tables->Verify (), true, "grid points");
+  NS_TEST_ASSERT_MSG_EQ (tables->GetResolution (), 0.01, "resolution");
+  NS_TEST_ASSERT_MSG_EQ (tables->GetMaxError (), 1e-6, "error bound");
+  NS_TEST_ASSERT_MSG_EQ (bool (tables->Find (3, 1000)), false, "size not in the file");
+
+  // the mapped tables answer exactly as the ones a model builds itself,
+  // without adding to its own
+  Ptr<TanhPerErrorRateModel> erm = CreateObject<TanhPerErrorRateModel> ();
+  erm->SetAttribute ("TableFile", StringValue (fileName));
+  StringValue tableFile;
+  erm->GetAttribute ("TableFile", tableFile);
+  NS_TEST_ASSERT_MSG_EQ (tableFile.Get (), fileName, "TableFile reads back");
+  Ptr<ErrorRateModel5> reference = CreateObject<ErrorRateModel5> ();
+  reference->SetLookupTable (true);
+  WifiTxVector txVector;
+  WifiMode modes[] = { WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate54Mbps () };
+  for (uint32_t m = 0; m < 3; m++)
+    {
+      for (uint32_t s = 0; s < sizes.size (); s++)
+        {
+          for (double db = -5; db <= 30; db += 0.13)
+            {
+              double snr = std::pow (10.0, db / 10);
+              NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (modes[m], txVector, snr, sizes[s]),
+                                     reference->GetChunkSuccessRate (modes[m], txVector, snr, sizes[s]),
+                                     "mode " << m << ", " << sizes[s] << " bits at " << db << " dB");
+            }
+        }
+    }
+  UintegerValue bytes;
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_EQ (bytes.Get (), 0, "no tables of its own");
+  NS_TEST_ASSERT_MSG_EQ (erm->GetChunkSuccessRate (modes[1], txVector, 10, 1000),
+                         reference->GetChunkSuccessRate (modes[1], txVector, 10, 1000), "size not in the file");
+  erm->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_GT (bytes.Get (), 0, "size not in the file is tabulated by the model");
+
+  // damaged files are refused, or caught by Verify
+  std::ifstream is (fileName.c_str (), std::ios::binary);
+  std::string contents ((std::istreambuf_iterator<char> (is)), std::istreambuf_iterator<char> ());
+  const char *damage[] = { "index", "samples", "truncated" };
+  for (uint32_t d = 0; d < 3; d++)
+    {
+      std::string damaged = contents;
+      if (d == 0)
+        {
+          damaged[64 + sizeof (TanhPerCoefficientSet) + 10] ^= 1;
+        }
+      else if (d == 1)
+        {
+          damaged[damaged.size () - 100] ^= 1;
+        }
+      else
+        {
+          damaged.resize (damaged.size () - 8);
+        }
+      std::ostringstream name;
+      name << prefix.str () << "-" << damage[d] << ".bin";
+      {
+        std::ofstream os (name.str ().c_str (), std::ios::binary);
+        os << damaged;
+      }
+      const TanhPerTableFile *opened = TanhPerTableFile::Open (name.str (), error);
+      if (d == 1)
+        {
+          NS_TEST_ASSERT_MSG_NE (opened, 0, error);
+          NS_TEST_ASSERT_MSG_EQ (opened->Verify (), false, "damaged grid point");
+        }
+      else
+        {
+          NS_TEST_ASSERT_MSG_EQ (opened, 0, damage[d]);
+        }
+      unlink (name.str ().c_str ());
+    }
+  unlink (fileName.c_str ());
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Models of the same bank share their derived state
+ */
+class TanhPerSharingTest : public TestCase
+{
+public:
+  TanhPerSharingTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Create models and evaluate a few chunks with each, as PHYs would.
+   *
+   * \param models the list to add the models to
+   * \param n the number of models to add
+   */
+  void AddModels (std::vector<Ptr<TanhPerErrorRateModel> > &models, uint32_t n);
+};
+
+TanhPerSharingTest::TanhPerSharingTest ()
+  : TestCase ("Models share one store per bank and RSS stays flat as they multiply")
+{
+}
+
+void
+TanhPerSharingTest::AddModels (std::vector<Ptr<TanhPerErrorRateModel> > &models, uint32_t n)
+{
+  WifiTxVector txVector;
+  const uint32_t sizes[] = { 8 * 40, 8 * 576, 8 * 1500 };
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<TanhPerErrorRateModel> erm = CreateObject<ErrorRateModel2> ();
+      erm->SetAttribute ("LookupTable", BooleanValue (true));
+      for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+        {
+          erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate6Mbps (), txVector, 3.0, sizes[s]);
+          erm->GetChunkSuccessRate (WifiPhy::GetOfdmRate54Mbps (), txVector, 300.0, sizes[s]);
+        }
+      models.push_back (erm);
+    }
+}
+
+void
+TanhPerSharingTest::DoRun (void)
+{
+  uint32_t curveStores = TanhPerCurveStore::GetInstanceCount ();
+  uint32_t lutStores = TanhPerLutStore::GetInstanceCount ();
+  std::vector<Ptr<TanhPerErrorRateModel> > models;
+  AddModels (models, 100);
+  Ptr<TanhPerErrorRateModel> byAttribute = CreateObject<TanhPerErrorRateModel> ();
+  byAttribute->SetCoefficientSet (2);
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCurveStore::GetInstanceCount (), curveStores + 1, "one curve store per bank");
+  NS_TEST_ASSERT_MSG_EQ (TanhPerLutStore::GetInstanceCount (), lutStores + 1, "one table store per configuration");
+  UintegerValue bytes;
+  models[0]->GetAttribute ("LookupTableBytes", bytes);
+  uint64_t tableBytes = bytes.Get ();
+  NS_TEST_ASSERT_MSG_GT (tableBytes, 0, "tables built");
+
+  uint64_t before = GetResidentBytes ();
+  AddModels (models, 4900);
+  uint64_t after = GetResidentBytes ();
+  models.back ()->GetAttribute ("LookupTableBytes", bytes);
+  NS_TEST_ASSERT_MSG_EQ (bytes.Get (), tableBytes, "5000 models hold the tables of one");
+  if (before != 0 && after != 0)
+    {
+      // a copy of the tables per model would be hundreds of kilobytes each
+      uint64_t perModel = (after > before) ? (after - before) / 4900 : 0;
+      NS_TEST_ASSERT_MSG_LT (perModel, 4096, "RSS growth per model");
+    }
+
+  models.clear ();
+  byAttribute = 0;
+  NS_TEST_ASSERT_MSG_EQ (TanhPerCurveStore::GetInstanceCount (), curveStores, "the last model frees the store");
+  NS_TEST_ASSERT_MSG_EQ (TanhPerLutStore::GetInstanceCount (), lutStores, "the last model frees the tables");
+}
+
+/**
+ * A private copy of the ErrorRateModel2 bank for TanhPerThreadTest.  The
+ * shared stores are keyed by bank, so models built on a copy start from
+ * empty caches regardless of what the other tests have looked up.
+ */
+static const TanhPerCoefficientSet g_threadTestCoefficients = g_errorRateModel2Coefficients;
+/**
+ * A second copy, for the single-threaded reference models.
+ */
+static const TanhPerCoefficientSet g_threadReferenceCoefficients = g_errorRateModel2Coefficients;
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Models evaluated from several threads at once
+ */
+class TanhPerThreadTest : public TestCase
+{
+public:
+  TanhPerThreadTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Evaluate the chunks of one thread: each through GetChunkSuccessRate
+   * of the analytic model, and all of them in batches of the table model.
+   *
+   * \param analytic the model evaluating the curves
+   * \param table the model answering from the lookup tables
+   * \param seed the seed of the thread's chunk sequence
+   * \param successRate set to the analytic success rate of each chunk
+   * \param tableSuccessRate set to the table success rate of each chunk
+   */
+  static void Run (Ptr<const TanhPerErrorRateModel> analytic, Ptr<const TanhPerErrorRateModel> table,
+                   uint32_t seed, std::vector<double> *successRate, std::vector<double> *tableSuccessRate);
+
+  static const uint32_t CHUNKS = 20000; //!< chunks per thread
+};
+
+TanhPerThreadTest::TanhPerThreadTest ()
+  : TestCase ("Models evaluated from several threads match single-threaded evaluation")
+{
+}
+
+void
+TanhPerThreadTest::Run (Ptr<const TanhPerErrorRateModel> analytic, Ptr<const TanhPerErrorRateModel> table,
+                        uint32_t seed, std::vector<double> *successRate, std::vector<double> *tableSuccessRate)
+{
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  WifiTxVector txVector;
+  const size_t block = 100;
+  std::vector<double> snr (block);
+  std::vector<uint32_t> nbits (block);
+  uint32_t state = seed;
+  successRate->resize (CHUNKS);
+  tableSuccessRate->resize (CHUNKS);
+  for (uint32_t i = 0; i < CHUNKS; i += block)
+    {
+      // one mode per block, chunk sizes mostly unseen by the other threads
+      state = state * 1103515245 + 12345;
+      WifiMode mode = modes[(state >> 16) % modes.size ()];
+      for (size_t j = 0; j < block; j++)
+        {
+          state = state * 1103515245 + 12345;
+          snr[j] = std::pow (10.0, ((state >> 8) % 3000) / 100.0 / 10.0);
+          nbits[j] = 8 * (1 + ((state >> 12) % 12) * 250);
+          (*successRate)[i + j] = analytic->GetChunkSuccessRate (mode, txVector, snr[j], nbits[j]);
+        }
+      table->GetChunkSuccessRateBatch (mode, txVector, &snr[0], &nbits[0], &(*tableSuccessRate)[i], block);
+    }
+}
+
+void
+TanhPerThreadTest::DoRun (void)
+{
+  const uint32_t threads = std::max (4u, std::thread::hardware_concurrency ());
+  // models are created and configured before the threads start, as ns-3
+  // does before running a simulation; the tables are capped well below
+  // the chunk sizes used so that the threads also race on evictions
+  std::vector<Ptr<TanhPerErrorRateModel> > analytic;
+  std::vector<Ptr<TanhPerErrorRateModel> > table;
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      analytic.push_back (CreateObject<TanhPerErrorRateModel> (g_threadTestCoefficients));
+      table.push_back (CreateObject<TanhPerErrorRateModel> (g_threadTestCoefficients));
+      table.back ()->SetAttribute ("LookupTable", BooleanValue (true));
+      table.back ()->SetAttribute ("LookupTableMaxBytes", UintegerValue (1 << 20));
+    }
+
+  std::vector<std::vector<double> > successRate (threads);
+  std::vector<std::vector<double> > tableSuccessRate (threads);
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers.push_back (std::thread (&TanhPerThreadTest::Run, analytic[t], table[t], t % 2,
+                                      &successRate[t], &tableSuccessRate[t]));
+    }
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join ();
+    }
+
+  Ptr<TanhPerErrorRateModel> referenceAnalytic = CreateObject<TanhPerErrorRateModel> (g_threadReferenceCoefficients);
+  Ptr<TanhPerErrorRateModel> referenceTable = CreateObject<TanhPerErrorRateModel> (g_threadReferenceCoefficients);
+  referenceTable->SetAttribute ("LookupTable", BooleanValue (true));
+  for (uint32_t seed = 0; seed < 2; seed++)
+    {
+      std::vector<double> expected;
+      std::vector<double> tableExpected;
+      Run (referenceAnalytic, referenceTable, seed, &expected, &tableExpected);
+      for (uint32_t t = seed; t < threads; t += 2)
+        {
+          for (uint32_t i = 0; i < CHUNKS; i++)
+            {
+              NS_TEST_ASSERT_MSG_EQ (successRate[t][i], expected[i], "thread " << t << " chunk " << i);
+              NS_TEST_ASSERT_MSG_EQ (tableSuccessRate[t][i], tableExpected[i],
+                                     "thread " << t << " chunk " << i << " from the tables");
+            }
+        }
+    }
+
+  // every thread counted its lookups, and the curves were computed at
+  // most once per (row, nbits) however the threads raced
+  uint64_t lookups = analytic[0]->GetCurveCacheHits () + analytic[0]->GetCurveCacheMisses ();
+  NS_TEST_ASSERT_MSG_GT_OR_EQ (lookups, uint64_t (threads) * CHUNKS, "lookups counted");
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (analytic[0]->GetCurveCacheMisses (), 2 * 8 * 12u, "one miss per curve");
+  UintegerValue evictions;
+  table[0]->GetAttribute ("LookupTableEvictions", evictions);
+  NS_TEST_ASSERT_MSG_GT (evictions.Get (), 0, "tables dropped while in use by other threads");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief The Horner form of the analytic FEC bound against the per-term form
+ */
+class TanhPerFecBoundTest : public TestCase
+{
+public:
+  TanhPerFecBoundTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TanhPerFecBoundTest::TanhPerFecBoundTest ()
+  : TestCase ("The Horner form of CalculatePe matches the per-term std::pow form to 16 DBL_EPSILON")
+{
+}
+
+void
+TanhPerFecBoundTest::DoRun (void)
+{
+  const uint32_t bValues[] = { 1, 2, 3, 5 };
+  const uint32_t points = 2000;
+  std::vector<double> p (points);
+  std::vector<double> pe (points);
+  for (uint32_t i = 0; i < points; i++)
+    {
+      // 1e-12 to 0.5
+      p[i] = 0.5 * std::pow (2e-12, 1 - double (i) / (points - 1));
+    }
+  for (uint32_t r = 0; r < 4; r++)
+    {
+      OfdmFecBound::CalculatePeBatch (&p[0], bValues[r], &pe[0], points);
+      for (uint32_t i = 0; i < points; i++)
+        {
+          double reference = OfdmFecBound::CalculatePeReference (p[i], bValues[r]);
+          double value = OfdmFecBound::CalculatePe (p[i], bValues[r]);
+          NS_TEST_ASSERT_MSG_EQ_TOL (value, reference, 16 * DBL_EPSILON * reference, "b = " << bValues[r] << ", p = " << p[i]);
+          NS_TEST_ASSERT_MSG_EQ (pe[i], value, "batch, b = " << bValues[r] << ", p = " << p[i]);
+        }
+      NS_TEST_ASSERT_MSG_EQ (OfdmFecBound::CalculatePe (0, bValues[r]), 0, "b = " << bValues[r] << ", p = 0");
+    }
+
+  uint16_t constellation = 0;
+  uint32_t bValue = 0;
+  NS_TEST_ASSERT_MSG_EQ (OfdmFecBound::GetParameters (WifiPhy::GetOfdmRate54Mbps (), constellation, bValue), true, "OFDM");
+  NS_TEST_ASSERT_MSG_EQ (constellation, 64, "64-QAM");
+  NS_TEST_ASSERT_MSG_EQ (bValue, 3, "rate 3/4");
+  NS_TEST_ASSERT_MSG_EQ (OfdmFecBound::GetParameters (WifiPhy::GetHtMcs7 (), constellation, bValue), true, "HT");
+  NS_TEST_ASSERT_MSG_EQ (bValue, 5, "rate 5/6");
+  NS_TEST_ASSERT_MSG_EQ (OfdmFecBound::GetParameters (WifiPhy::GetDsssRate11Mbps (), constellation, bValue), false, "DSSS");
+
+  // the batch API answers as the single chunk one, DSSS through the
+  // usual model
+  Ptr<ErrorRateModel2> erm = CreateObject<ErrorRateModel2> ();
+  WifiTxVector txVector;
+  std::vector<WifiMode> modes = GetOfdmModes ();
+  modes.push_back (WifiPhy::GetHtMcs7 ());
+  modes.push_back (WifiPhy::GetDsssRate11Mbps ());
+  std::vector<double> snr;
+  std::vector<uint32_t> nbits;
+  for (double db = -5; db <= 35; db += 0.1)
+    {
+      snr.push_back (std::pow (10.0, db / 10));
+      nbits.push_back (8 * (20 + uint32_t (db * 37 + 400) % 1480));
+    }
+  std::vector<double> successRate (snr.size ());
+  for (uint32_t m = 0; m < modes.size (); m++)
+    {
+      erm->GetFecChunkSuccessRateBatch (modes[m], txVector, &snr[0], &nbits[0], &successRate[0], snr.size ());
+      bool fec = OfdmFecBound::GetParameters (modes[m], constellation, bValue);
+      for (uint32_t i = 0; i < snr.size (); i++)
+        {
+          double expected = fec ? erm->GetFecChunkSuccessRate (modes[m], txVector, snr[i], nbits[i])
+                                : erm->GetChunkSuccessRate (modes[m], txVector, snr[i], nbits[i]);
+          NS_TEST_ASSERT_MSG_EQ (successRate[i], expected, modes[m].GetUniqueName () << ", chunk " << i);
+          NS_TEST_ASSERT_MSG_EQ ((successRate[i] >= 0 && successRate[i] <= 1), true, modes[m].GetUniqueName ());
+        }
+    }
+  NS_TEST_ASSERT_MSG_GT (erm->GetFecChunkSuccessRate (modes[0], txVector, 100, 8000), 0.99, "BPSK 1/2 at 20 dB");
+  NS_TEST_ASSERT_MSG_LT (erm->GetFecChunkSuccessRate (modes[7], txVector, 10, 8000), 0.01, "64-QAM 3/4 at 10 dB");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Tanh PER error rate model test suite
+ */
+class TanhPerErrorRateModelTestSuite : public TestSuite
+{
+public:
+  TanhPerErrorRateModelTestSuite ();
+};
+
+TanhPerErrorRateModelTestSuite::TanhPerErrorRateModelTestSuite ()
+  : TestSuite ("tanh-per-error-rate-model", UNIT)
+{
+  AddTestCase (new TanhPerReferenceTest, TestCase::QUICK);
+  AddTestCase (new TanhPerBatchTest, TestCase::QUICK);
+  AddTestCase (new TanhPerTypeIdTest, TestCase::QUICK);
+  AddTestCase (new TanhPerModeTableTest, TestCase::QUICK);
+  AddTestCase (new TanhPerKernelTest, TestCase::QUICK);
+  AddTestCase (new TanhPerStaticCurvesTest, TestCase::QUICK);
+  AddTestCase (new TanhPerLookupTableTest, TestCase::QUICK);
+  AddTestCase (new TanhPerLookupTableCacheTest, TestCase::QUICK);
+  AddTestCase (new TanhPerLogSuccessTest, TestCase::QUICK);
+  AddTestCase (new TanhPerFrameTest, TestCase::QUICK);
+  AddTestCase (new TanhPerThresholdTest, TestCase::QUICK);
+  AddTestCase (new TanhPerBestModeTest, TestCase::QUICK);
+  AddTestCase (new TanhPerCoefficientFileTest, TestCase::QUICK);
+  AddTestCase (new TanhPerTableFileTest, TestCase::QUICK);
+  AddTestCase (new TanhPerSharingTest, TestCase::QUICK);
+  AddTestCase (new TanhPerThreadTest, TestCase::QUICK);
+  AddTestCase (new TanhPerFecBoundTest, TestCase::QUICK);
+}
+
+static TanhPerErrorRateModelTestSuite tanhPerErrorRateModelTestSuite; ///< the test suite
@@ -0,0 +1,161 @@
+#!/bin/sh
+#
+# Write the golden file that error-rate-model-bench --golden holds every
+# path to, from the ErrorRateModel2..9 sources as they were before they
+# were optimised, so the check compares against the original models and
+# not against the tree being tested.
+#
+# Usage: write-baseline-golden.sh [BUILD] [REVISION] [OUTPUT]
+#   BUILD     a configured and built standalone CMake tree (./build)
+#   REVISION  the commit holding the original models (the root commit)
+#   OUTPUT    the golden file (test/baseline.golden)
+#
+# The original error-rate-modelN.{h,cc} are taken from REVISION with git,
+# compiled against the ns-3 stand-ins of BUILD, and evaluated through
+# GetChunkSuccessRate over models 2..9, every OFDM, ERP-OFDM, HT, VHT and
+# DSSS mode, five MPDU sizes and -10 to 40 dB in 1 dB steps.  Success
+# rates that are not finite (the DSSS models below 0 dB, which are handed
+# the SNR in dB) are stored as NaN, which --golden leaves out.
+
+SOURCE=$(cd "$(dirname "$0")" && pwd)
+BUILD=${1:-./build}
+REVISION=${2:-$(git -C "$SOURCE" rev-list --max-parents=0 HEAD)}
+OUTPUT=${3:-$SOURCE/test/baseline.golden}
+DIR=$(mktemp -d "${TMPDIR:-/tmp}/write-baseline-golden.XXXXXX") || exit 1
+trap 'rm -rf "$DIR"' EXIT
+
+n=2
+while [ "$n" -le 9 ]; do
+  git -C "$SOURCE" show "$REVISION:error-rate-model$n.h" > "$DIR/error-rate-model$n.h" || exit 1
+  git -C "$SOURCE" show "$REVISION:error-rate-model$n.cc" > "$DIR/error-rate-model$n.cc" || exit 1
+  n=$((n + 1))
+done
+
+cat > "$DIR/write-golden.cc" <<'EOF'
+#include <stdint.h>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ns3/fnv-hash.h"
+#include "ns3/wifi-phy.h"
+#include "error-rate-model2.h"
+#include "error-rate-model3.h"
+#include "error-rate-model4.h"
+#include "error-rate-model5.h"
+#include "error-rate-model6.h"
+#include "error-rate-model7.h"
+#include "error-rate-model8.h"
+#include "error-rate-model9.h"
+
+using namespace ns3;
+
+template <typename T>
+static void
+WriteRaw (std::ostream &os, const T &value)
+{
+  os.write (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+int
+main (int argc, char *argv[])
+{
+  Ptr<ErrorRateModel> models[] = {
+    CreateObject<ErrorRateModel2> (), CreateObject<ErrorRateModel3> (),
+    CreateObject<ErrorRateModel4> (), CreateObject<ErrorRateModel5> (),
+    CreateObject<ErrorRateModel6> (), CreateObject<ErrorRateModel7> (),
+    CreateObject<ErrorRateModel8> (), CreateObject<ErrorRateModel9> ()
+  };
+  // the order of GetAllModes in error-rate-model-bench.cc
+  WifiMode modes[] = {
+    WifiPhy::GetDsssRate1Mbps (), WifiPhy::GetDsssRate2Mbps (),
+    WifiPhy::GetDsssRate5_5Mbps (), WifiPhy::GetDsssRate11Mbps (),
+    WifiPhy::GetErpOfdmRate6Mbps (), WifiPhy::GetErpOfdmRate9Mbps (),
+    WifiPhy::GetErpOfdmRate12Mbps (), WifiPhy::GetErpOfdmRate18Mbps (),
+    WifiPhy::GetErpOfdmRate24Mbps (), WifiPhy::GetErpOfdmRate36Mbps (),
+    WifiPhy::GetErpOfdmRate48Mbps (), WifiPhy::GetErpOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate6Mbps (), WifiPhy::GetOfdmRate9Mbps (),
+    WifiPhy::GetOfdmRate12Mbps (), WifiPhy::GetOfdmRate18Mbps (),
+    WifiPhy::GetOfdmRate24Mbps (), WifiPhy::GetOfdmRate36Mbps (),
+    WifiPhy::GetOfdmRate48Mbps (), WifiPhy::GetOfdmRate54Mbps (),
+    WifiPhy::GetOfdmRate3MbpsBW10MHz (), WifiPhy::GetOfdmRate4_5MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW10MHz (), WifiPhy::GetOfdmRate9MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW10MHz (), WifiPhy::GetOfdmRate18MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate24MbpsBW10MHz (), WifiPhy::GetOfdmRate27MbpsBW10MHz (),
+    WifiPhy::GetOfdmRate1_5MbpsBW5MHz (), WifiPhy::GetOfdmRate2_25MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate3MbpsBW5MHz (), WifiPhy::GetOfdmRate4_5MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate6MbpsBW5MHz (), WifiPhy::GetOfdmRate9MbpsBW5MHz (),
+    WifiPhy::GetOfdmRate12MbpsBW5MHz (), WifiPhy::GetOfdmRate13_5MbpsBW5MHz (),
+    WifiPhy::GetHtMcs0 (), WifiPhy::GetHtMcs1 (), WifiPhy::GetHtMcs2 (),
+    WifiPhy::GetHtMcs3 (), WifiPhy::GetHtMcs4 (), WifiPhy::GetHtMcs5 (),
+    WifiPhy::GetHtMcs6 (), WifiPhy::GetHtMcs7 (),
+    WifiPhy::GetVhtMcs0 (), WifiPhy::GetVhtMcs1 (), WifiPhy::GetVhtMcs2 (),
+    WifiPhy::GetVhtMcs3 (), WifiPhy::GetVhtMcs4 (), WifiPhy::GetVhtMcs5 (),
+    WifiPhy::GetVhtMcs6 (), WifiPhy::GetVhtMcs7 (), WifiPhy::GetVhtMcs8 (),
+    WifiPhy::GetVhtMcs9 ()
+  };
+  const uint32_t nModels = sizeof (models) / sizeof (models[0]);
+  const uint32_t nModes = sizeof (modes) / sizeof (modes[0]);
+  std::vector<uint32_t> sizes;
+  const uint32_t bytes[] = { 14, 20, 576, 1500, 2304 };
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      sizes.push_back (8 * bytes[i]);
+    }
+  std::vector<double> snrDb;
+  for (int32_t i = -10; i <= 40; i++)
+    {
+      snrDb.push_back (i);
+    }
+
+  std::vector<double> values;
+  WifiTxVector txVector;
+  for (uint32_t m = 0; m < nModels; m++)
+    {
+      for (uint32_t i = 0; i < nModes; i++)
+        {
+          for (uint32_t s = 0; s < sizes.size (); s++)
+            {
+              for (uint32_t k = 0; k < snrDb.size (); k++)
+                {
+                  double value = models[m]->GetChunkSuccessRate (modes[i], txVector,
+                                                                 std::pow (10.0, snrDb[k] / 10), sizes[s]);
+                  values.push_back (std::isfinite (value) ? value : std::numeric_limits<double>::quiet_NaN ());
+                }
+            }
+        }
+    }
+
+  std::ofstream os (argv[1], std::ios::binary);
+  os.write ("TPERGLD1", 8);
+  WriteRaw (os, static_cast<uint32_t> (0x01020304));
+  WriteRaw (os, nModels);
+  WriteRaw (os, nModes);
+  WriteRaw (os, static_cast<uint32_t> (sizes.size ()));
+  WriteRaw (os, static_cast<uint32_t> (snrDb.size ()));
+  for (uint32_t m = 0; m < nModels; m++)
+    {
+      WriteRaw (os, m + 2);
+    }
+  for (uint32_t i = 0; i < nModes; i++)
+    {
+      std::string name = modes[i].GetUniqueName ();
+      WriteRaw (os, static_cast<uint16_t> (name.size ()));
+      os.write (name.data (), name.size ());
+    }
+  os.write (reinterpret_cast<const char *> (&sizes[0]), sizes.size () * sizeof (uint32_t));
+  os.write (reinterpret_cast<const char *> (&snrDb[0]), snrDb.size () * sizeof (double));
+  os.write (reinterpret_cast<const char *> (&values[0]), values.size () * sizeof (double));
+  WriteRaw (os, HashBytes (&values[0], values.size () * sizeof (double)));
+  std::cerr << "wrote " << values.size () << " success rates to " << argv[1] << std::endl;
+  return os.good () ? 0 : 1;
+}
+EOF
+
+# ns-3 headers pull in NS_ASSERT, which the stand-ins leave to ns3/assert.h
+${CXX:-c++} -O2 -std=c++11 -include ns3/assert.h -I"$DIR" -I"$BUILD/include" -I"$SOURCE/standalone/model" \
+  "$DIR/write-golden.cc" "$DIR"/error-rate-model[2-9].cc "$BUILD/libns3-standalone.a" \
+  -o "$DIR/write-golden" -lpthread || exit 1
+"$DIR/write-golden" "$OUTPUT"